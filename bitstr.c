@@ -9,11 +9,71 @@
  */
 
 #include "bitstr.h"
+#include "desstats.h"
 #define CHAR_LEN 8
 
-static char *to_bstr(unsigned char c);
+static void to_bstr(unsigned char c, char *str);
 static unsigned char to_char(char *str);
-static char *str_clone(char *s, size_t len);
+static _Bool str_copy(char *str, char *out, size_t size);
+static void str_reverse(char *str, size_t len);
+static void *std_alloc(size_t size, void *ctx);
+static void std_free(void *ptr, void *ctx);
+
+static bstr_alloc_func alloc_func = &std_alloc;     //allocator hook
+static bstr_free_func free_func = &std_free;
+static void *alloc_ctx = NULL;
+
+/**
+ * Sets the allocator used by every function that returns dynamically 
+ * allocated memory, in both bitstr.c and des.c. The context is passed to 
+ * both functions, for example a per-thread arena. Passing NULL for either 
+ * function restores malloc() and free(). The allocator is shared by all 
+ * threads, so set it before any other thread uses the library. 
+ *
+ * PARAMETERS: 
+ * alloc   - the allocate function
+ * dealloc - the free function
+ * ctx     - the context passed to both functions
+ */
+void bstr_set_allocator(bstr_alloc_func alloc, bstr_free_func dealloc,
+        void *ctx) {
+    if (alloc == NULL || dealloc == NULL) {
+        alloc_func = &std_alloc;
+        free_func = &std_free;
+        alloc_ctx = NULL;
+    } else {
+        alloc_func = alloc;
+        free_func = dealloc;
+        alloc_ctx = ctx;
+    }
+}
+
+/**
+ * Allocates memory with the allocator set by bstr_set_allocator(), or 
+ * malloc() if none is set. 
+ *
+ * PARAMETERS: 
+ * size - the number of bytes to allocate
+ *
+ * RETURNS: 
+ * The allocated memory, or NULL if any error occurred. 
+ */
+void *bstr_alloc(size_t size) {
+    DES_STAT_ALLOC(size);
+    return alloc_func(size, alloc_ctx);
+}
+
+/**
+ * Frees memory returned by any allocating function of the library, with 
+ * the allocator set by bstr_set_allocator(). 
+ *
+ * PARAMETERS: 
+ * ptr - the memory to free
+ */
+void bstr_free(void *ptr) {
+    if (ptr != NULL)
+        free_func(ptr, alloc_ctx);
+}
 
 /**
  * Returns the length of the specified bit string. If the specified string 
@@ -53,17 +113,39 @@ char *bstr_new(char *str) {
     if (str == NULL || *str == '\0')
         return NULL;        //input invalid
 
-    size_t len = CHAR_LEN * strlen(str);
-    char *bits = malloc((len + 1) * (sizeof *bits));
-    if (bits != NULL) {
-        bits[len] = '\0';
-        size_t i = 0, j = 0;
-        for (i = 0; i < len; i += CHAR_LEN)
-            memcpy(bits + i, to_bstr(str[j++]), CHAR_LEN * (sizeof *str));
-    }
+    size_t size = CHAR_LEN * strlen(str) + 1;
+    char *bits = bstr_alloc(size * (sizeof *bits));
+    if (bits != NULL)
+        bstr_new_r(str, bits, size);
     return bits;
 }
 
+/**
+ * Converts a whole string into a bit string, stored in the specified 
+ * buffer instead of allocating. The buffer must have room for 8x the size 
+ * of the input string, plus the terminator. 
+ *
+ * PARAMETERS: 
+ * str  - the string to convert
+ * out  - the buffer to store the bit string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_new_r(char *str, char *out, size_t size) {
+    if (str == NULL || *str == '\0' || out == NULL)
+        return NULL;        //input invalid
+
+    size_t len = CHAR_LEN * strlen(str);
+    if (size <= len)
+        return NULL;        //buffer too small
+    for (size_t i = 0; i < len; i += CHAR_LEN)
+        to_bstr(str[i / CHAR_LEN], out + i);
+    out[len] = '\0';
+    return out;
+}
+
 /**
  * Constructs the original string from the specified bit string. The 
  * constructed string will be dynamically allocated. The input bit string 
@@ -81,16 +163,40 @@ char *bstr_original(char *str) {
     if (len == 0 || len % CHAR_LEN != 0)
         return NULL;        //input invalid
 
-    size_t bstrlen = len / CHAR_LEN;
-    char *new = malloc((bstrlen + 1) * (sizeof *new));
-    if (new != NULL) {
-        new[bstrlen] = '\0';
-        for (size_t i = 0; i < bstrlen; i++)
-            new[i] = to_char(str + (i * 8));
-    }
+    size_t size = len / CHAR_LEN + 1;
+    char *new = bstr_alloc(size * (sizeof *new));
+    if (new != NULL)
+        bstr_original_r(str, new, size);
     return new;
 }
 
+/**
+ * Constructs the original string from the specified bit string, stored in 
+ * the specified buffer instead of allocating. The buffer must have room 
+ * for 1/8 the length of the bit string, plus the terminator. 
+ *
+ * PARAMETERS: 
+ * str  - the bit string to reconstruct
+ * out  - the buffer to store the original string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_original_r(char *str, char *out, size_t size) {
+    size_t len = bstr_len(str);
+    if (len == 0 || len % CHAR_LEN != 0 || out == NULL)
+        return NULL;        //input invalid
+
+    size_t bstrlen = len / CHAR_LEN;
+    if (size <= bstrlen)
+        return NULL;        //buffer too small
+    for (size_t i = 0; i < bstrlen; i++)
+        out[i] = to_char(str + (i * 8));
+    out[bstrlen] = '\0';
+    return out;
+}
+
 /**
  * Pads the specified bit string until its length is the same as n. If the 
  * specified string is not a bit string or the n is 0, then this 
@@ -110,18 +216,43 @@ char *bstr_pad(char *str, size_t n) {
     size_t len = bstr_len(str);
     if (len == 0 || n == 0)
         return NULL;                //param error
-    if (n <= len)
-        return str_clone(str, n);   //no need for padding
-
-    char *new = malloc((n + 1) * (sizeof *new));
-    if (new != NULL) {
-        new[n] = '\0';
-        memcpy(new, str, len * (sizeof *new));
-        memset(new + len, '0', (n - len) * (sizeof *new));
-    }
+
+    char *new = bstr_alloc((n + 1) * (sizeof *new));
+    if (new != NULL)
+        bstr_pad_r(str, n, new, n + 1);
     return new;
 }
 
+/**
+ * Pads the specified bit string until its length is the same as n, stored 
+ * in the specified buffer instead of allocating. The buffer must have room 
+ * for n bits plus the terminator, and may be the same as the input. The 
+ * padding will always be 0. 
+ *
+ * PARAMETERS: 
+ * str  - the bit string to pad
+ * n    - the new length
+ * out  - the buffer to store the padded bit string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_pad_r(char *str, size_t n, char *out, size_t size) {
+    size_t len = bstr_len(str);
+    if (len == 0 || n == 0 || out == NULL || size <= n)
+        return NULL;                //param error
+
+    if (n <= len) {
+        memmove(out, str, n * (sizeof *out));   //no need for padding
+    } else {
+        memmove(out, str, len * (sizeof *out));
+        memset(out + len, '0', (n - len) * (sizeof *out));
+    }
+    out[n] = '\0';
+    return out;
+}
+
 /**
  * Left rotates the specified bit string. The return type of this function 
  * indicates whether the operation is successful or not. If true is returned, 
@@ -143,16 +274,30 @@ _Bool bstr_lrot(char *str, uint32_t n) {
         return true;     //no rotates needed
 
     n %= len;               //reduce to smallest n
-    size_t rotlen = len - n;
-    char *temp = malloc(n * (sizeof *temp));
-    if (temp != NULL) {
-        memcpy(temp, str, n * (sizeof *str));          //backup rotated bits
-        memmove(str, str + n, rotlen * (sizeof *str));
-        memcpy(str + rotlen, temp, n * (sizeof *str)); //restore rotated bits
-        free(temp);
-        return true;
-    }
-    return false;    //memory issue
+    str_reverse(str, n);    //rotate by three reversals, no temp buffer
+    str_reverse(str + n, len - n);
+    str_reverse(str, len);
+    return true;
+}
+
+/**
+ * Left rotates the specified bit string, stored in the specified buffer. 
+ * The buffer must have room for the bit string plus the terminator, and 
+ * may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * str  - the bit string to rotate
+ * n    - the number of shifts
+ * out  - the buffer to store the rotated bit string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_lrot_r(char *str, uint32_t n, char *out, size_t size) {
+    if (!str_copy(str, out, size))
+        return NULL;
+    return (bstr_lrot(out, n) ? out : NULL);
 }
 
 /**
@@ -176,16 +321,30 @@ _Bool bstr_rrot(char *str, uint32_t n) {
         return true;     //no rotates needed
 
     n %= len;               //reduce to smallest n
-    size_t rotlen = len - n;
-    char *temp = malloc(n * (sizeof *temp));
-    if (temp != NULL) {
-        memcpy(temp, str + rotlen, n * (sizeof *str));  //backup rotated bits
-        memmove(str + n, str, rotlen * (sizeof *str));
-        memcpy(str, temp, n * (sizeof *str));           //restore bits
-        free(temp);
-        return true;
-    }
-    return false;    //memory issue
+    str_reverse(str, len);  //rotate by three reversals, no temp buffer
+    str_reverse(str, n);
+    str_reverse(str + n, len - n);
+    return true;
+}
+
+/**
+ * Right rotates the specified bit string, stored in the specified buffer. 
+ * The buffer must have room for the bit string plus the terminator, and 
+ * may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * str  - the bit string to rotate
+ * n    - the number of shifts
+ * out  - the buffer to store the rotated bit string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_rrot_r(char *str, uint32_t n, char *out, size_t size) {
+    if (!str_copy(str, out, size))
+        return NULL;
+    return (bstr_rrot(out, n) ? out : NULL);
 }
 
 /**
@@ -211,6 +370,32 @@ _Bool bstr_xor(char *a, char *b) {
     return true;
 }
 
+/**
+ * Performs XOR on the given bit strings, stored in the specified buffer 
+ * instead of the left oprand. The buffer must have room for the bit 
+ * strings plus the terminator, and may be the same as either oprand. 
+ *
+ * PARAMETERS: 
+ * a    - the left oprand
+ * b    - the right oprand
+ * out  - the buffer to store the result
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_xor_r(char *a, char *b, char *out, size_t size) {
+    size_t alen = bstr_len(a);
+    size_t blen = bstr_len(b);
+    if (alen == 0 || blen == 0 || alen != blen || out == NULL || size <= alen)
+        return NULL;        //a or b is invalid, or length differ
+
+    for (size_t i = 0; i < alen; i++)
+        out[i] = ((a[i] - '0') ^ (b[i] - '0')) + '0';
+    out[alen] = '\0';
+    return out;
+}
+
 /**
  * Flips the specified bit string, changing every 1 to 0 and 0 to 1. If any 
  * error occured with the input, then false will be returned. Otherwise 
@@ -242,7 +427,7 @@ _Bool bstr_flip(char *str) {
  *
  * PARAMETERS: 
  * str - the string to swap
- * 
+ *
  * RETURNS: 
  * 1 (true) if this function is successful, 0 (false) otherwise. 
  */
@@ -261,24 +446,35 @@ _Bool bstr_swap(char *str) {
 }
 
 /**
- * Converts a single character to binary notation (8 bits). The resulting 
- * binary will be stored in a string. 
+ * Swaps the specified bit string like bstr_swap(), stored in the 
+ * specified buffer. The buffer must have room for the bit string plus the 
+ * terminator, and may be the same as the input. 
  *
  * PARAMETERS: 
- * c - the character to convert
+ * str  - the string to swap
+ * out  - the buffer to store the swapped bit string
+ * size - the size of the buffer
  *
  * RETURNS: 
- * The bit string representation, or 0 if any error occurred. 
+ * The buffer, or NULL if any error occurred. 
  */
-static char *to_bstr(unsigned char c) {
-    static char str[] = "00000000";
-    memset(str, '0', 8  * (sizeof *str));
-
-    int bi = CHAR_LEN - 1;     //length index of bit string
-    do {
-        str[bi--] = (c & 1) + '0';
-    } while ((c >>= 1) > 0);
-    return str;
+char *bstr_swap_r(char *str, char *out, size_t size) {
+    if (!str_copy(str, out, size))
+        return NULL;
+    return (bstr_swap(out) ? out : NULL);
+}
+
+/**
+ * Converts a single character to binary notation (8 bits). The resulting 
+ * binary will be stored in the specified string, without a terminator. 
+ *
+ * PARAMETERS: 
+ * c   - the character to convert
+ * str - the string to store the 8 bits
+ */
+static void to_bstr(unsigned char c, char *str) {
+    for (int bi = CHAR_LEN - 1; bi >= 0; bi--, c >>= 1)
+        str[bi] = (c & 1) + '0';
 }
 
 /**
@@ -304,35 +500,64 @@ static unsigned char to_char(char *str) {
 }
 
 /**
- * Clones a bit string. If any memory error or parameter error occurred, 
- * then NULL will be returned. 
- *
- * NOTE: this function is mainly used in the situation where if a function 
- * needs to return a dynamically allocated string, but somehow needed to 
- * return the original unchanged string based on the situation. Returning 
- * the original string will lead to memory issues later on because the 
- * caller function will not have any knowledge on whether the returned 
- * string is the original input string or a new dynamically allocated 
- * string. If the function need to return the original input string, then
- * this function will be invoked to return a clone of the original string, 
- * ensuring that the returned string is newly created on the heap to avoid 
- * any memory issues caused by other areas of the program later on. 
+ * Copies a bit string into the specified buffer, with the terminator. The 
+ * buffer may overlap the bit string. 
  *
  * PARAMETERS: 
- * s   - the bit string to clone
- * len - the length of the bit string, cache this for improved performance
+ * str  - the bit string to copy
+ * out  - the buffer to copy into
+ * size - the size of the buffer
  *
  * RETURNS: 
- * A pointer to the new bit string, or NULL if any error occurred. 
+ * 1 (true) if the bit string is copied, 0 (false) otherwise. 
  */
-static char *str_clone(char *s, size_t len) {
-    if (s == NULL || len == 0)
-        return NULL;
+static _Bool str_copy(char *str, char *out, size_t size) {
+    size_t len = bstr_len(str);
+    if (len == 0 || out == NULL || size <= len)
+        return false;
+
+    memmove(out, str, (len + 1) * (sizeof *out));
+    return true;
+}
 
-    char *new = malloc((len + 1) * (sizeof *new));
-    if (new != NULL) {
-        new[len] = '\0';
-        memcpy(new, s, len * (sizeof *s));
+/**
+ * Reverses the first len characters of the specified string in place. 
+ *
+ * PARAMETERS: 
+ * str - the string to reverse
+ * len - the number of characters to reverse
+ */
+static void str_reverse(char *str, size_t len) {
+    for (size_t i = 0, j = len; i + 1 < j; i++, j--) {
+        char curr = str[i];
+        str[i] = str[j - 1];
+        str[j - 1] = curr;
     }
-    return new;
+}
+
+/**
+ * The default allocate function, calls malloc(). 
+ *
+ * PARAMETERS: 
+ * size - the number of bytes to allocate
+ * ctx  - unused
+ *
+ * RETURNS: 
+ * The allocated memory, or NULL if any error occurred. 
+ */
+static void *std_alloc(size_t size, void *ctx) {
+    (void)ctx;
+    return malloc(size);
+}
+
+/**
+ * The default free function, calls free(). 
+ *
+ * PARAMETERS: 
+ * ptr - the memory to free
+ * ctx - unused
+ */
+static void std_free(void *ptr, void *ctx) {
+    (void)ctx;
+    free(ptr);
 }
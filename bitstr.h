@@ -15,6 +15,53 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/**
+ * Allocate function of the allocator hook, returns size bytes or NULL. 
+ */
+typedef void *(*bstr_alloc_func)(size_t size, void *ctx);
+
+/**
+ * Free function of the allocator hook, frees memory from the allocate 
+ * function. 
+ */
+typedef void (*bstr_free_func)(void *ptr, void *ctx);
+
+/**
+ * Sets the allocator used by every function that returns dynamically 
+ * allocated memory, in both bitstr.c and des.c. The context is passed to 
+ * both functions, for example a per-thread arena. Passing NULL for either 
+ * function restores malloc() and free(). The allocator is shared by all 
+ * threads, so set it before any other thread uses the library. 
+ *
+ * PARAMETERS: 
+ * alloc   - the allocate function
+ * dealloc - the free function
+ * ctx     - the context passed to both functions
+ */
+void bstr_set_allocator(bstr_alloc_func alloc, bstr_free_func dealloc,
+        void *ctx);
+
+/**
+ * Allocates memory with the allocator set by bstr_set_allocator(), or 
+ * malloc() if none is set. 
+ *
+ * PARAMETERS: 
+ * size - the number of bytes to allocate
+ *
+ * RETURNS: 
+ * The allocated memory, or NULL if any error occurred. 
+ */
+void *bstr_alloc(size_t size);
+
+/**
+ * Frees memory returned by any allocating function of the library, with 
+ * the allocator set by bstr_set_allocator(). 
+ *
+ * PARAMETERS: 
+ * ptr - the memory to free
+ */
+void bstr_free(void *ptr);
+
 /**
  * Returns the length of the specified bit string. If the specified string 
  * is not a bit string, then 0 will be returned. Use this function instead 
@@ -42,6 +89,21 @@ size_t bstr_len(char *str);
  */
 char *bstr_new(char *str);
 
+/**
+ * Converts a whole string into a bit string, stored in the specified 
+ * buffer instead of allocating. The buffer must have room for 8x the size 
+ * of the input string, plus the terminator. 
+ *
+ * PARAMETERS: 
+ * str  - the string to convert
+ * out  - the buffer to store the bit string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_new_r(char *str, char *out, size_t size);
+
 /**
  * Constructs the original string from the specified bit string. The 
  * constructed string will be dynamically allocated. The input bit string 
@@ -56,6 +118,21 @@ char *bstr_new(char *str);
  */
 char *bstr_original(char *str);
 
+/**
+ * Constructs the original string from the specified bit string, stored in 
+ * the specified buffer instead of allocating. The buffer must have room 
+ * for 1/8 the length of the bit string, plus the terminator. 
+ *
+ * PARAMETERS: 
+ * str  - the bit string to reconstruct
+ * out  - the buffer to store the original string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_original_r(char *str, char *out, size_t size);
+
 /**
  * Pads the specified bit string until its length is the same as n. If the 
  * specified string is not a bit string or the n is 0, then this 
@@ -73,6 +150,23 @@ char *bstr_original(char *str);
  */
 char *bstr_pad(char *str, size_t n);
 
+/**
+ * Pads the specified bit string until its length is the same as n, stored 
+ * in the specified buffer instead of allocating. The buffer must have room 
+ * for n bits plus the terminator, and may be the same as the input. The 
+ * padding will always be 0. 
+ *
+ * PARAMETERS: 
+ * str  - the bit string to pad
+ * n    - the new length
+ * out  - the buffer to store the padded bit string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_pad_r(char *str, size_t n, char *out, size_t size);
+
 /**
  * Left rotates the specified bit string. The return type of this function 
  * indicates whether the operation is successful or not. If true is returned, 
@@ -88,6 +182,22 @@ char *bstr_pad(char *str, size_t n);
  */
 _Bool bstr_lrot(char *str, uint32_t n);
 
+/**
+ * Left rotates the specified bit string, stored in the specified buffer. 
+ * The buffer must have room for the bit string plus the terminator, and 
+ * may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * str  - the bit string to rotate
+ * n    - the number of shifts
+ * out  - the buffer to store the rotated bit string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_lrot_r(char *str, uint32_t n, char *out, size_t size);
+
 /**
  * Right rotates the specified bit string. The return type of this function 
  * indicates whether the operation is successful or not. If true is returned, 
@@ -103,6 +213,22 @@ _Bool bstr_lrot(char *str, uint32_t n);
  */
 _Bool bstr_rrot(char *str, uint32_t n);
 
+/**
+ * Right rotates the specified bit string, stored in the specified buffer. 
+ * The buffer must have room for the bit string plus the terminator, and 
+ * may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * str  - the bit string to rotate
+ * n    - the number of shifts
+ * out  - the buffer to store the rotated bit string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_rrot_r(char *str, uint32_t n, char *out, size_t size);
+
 /**
  * Performs XOR on the given bit strings and store the result on the left 
  * oprand. If this function is succssful, then true will be returned, 
@@ -117,6 +243,22 @@ _Bool bstr_rrot(char *str, uint32_t n);
  */
 _Bool bstr_xor(char *a, char *b);
 
+/**
+ * Performs XOR on the given bit strings, stored in the specified buffer 
+ * instead of the left oprand. The buffer must have room for the bit 
+ * strings plus the terminator, and may be the same as either oprand. 
+ *
+ * PARAMETERS: 
+ * a    - the left oprand
+ * b    - the right oprand
+ * out  - the buffer to store the result
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_xor_r(char *a, char *b, char *out, size_t size);
+
 /**
  * Flips the specified bit string, changing every 1 to 0 and 0 to 1. If any 
  * error occured with the input, then false will be returned. Otherwise 
@@ -138,10 +280,25 @@ _Bool bstr_flip(char *str);
  *
  * PARAMETERS: 
  * str - the string to swap
- * 
+ *
  * RETURNS: 
  * 1 (true) if this function is successful, 0 (false) otherwise. 
  */
 _Bool bstr_swap(char *str);
 
+/**
+ * Swaps the specified bit string like bstr_swap(), stored in the 
+ * specified buffer. The buffer must have room for the bit string plus the 
+ * terminator, and may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * str  - the string to swap
+ * out  - the buffer to store the swapped bit string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bstr_swap_r(char *str, char *out, size_t size);
+
 #endif
@@ -0,0 +1,405 @@
+/**
+ * FILE:   bitvec.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Packed bit vectors, storing 64 bits in every word instead of one bit in 
+ * every character like the bit strings of bitstr.h. 
+ *
+ * C99
+ */
+
+#include "bitvec.h"
+
+static void clear_tail(bitvec *v);
+static uint64_t get_bits(const uint64_t *w, size_t pos, size_t cnt);
+static void put_bits(uint64_t *w, size_t pos, size_t cnt, uint64_t bits);
+static uint64_t rev_bits(uint64_t x, size_t cnt);
+static void reverse(uint64_t *w, size_t a, size_t b);
+
+/**
+ * Creates a bit vector of the specified length, with every bit 0. The bit 
+ * vector is allocated with bstr_alloc(), free it with bvec_free(). 
+ *
+ * PARAMETERS: 
+ * len - the number of bits
+ *
+ * RETURNS: 
+ * The new bit vector, or NULL if any error occurred. 
+ */
+bitvec *bvec_new(size_t len) {
+    bitvec *v = bstr_alloc(sizeof *v + BVEC_WORDS(len) * sizeof *v->words);
+    if (v != NULL)
+        bvec_init(v, (uint64_t *)(v + 1), len);    //words follow the struct
+    return v;
+}
+
+/**
+ * Frees the specified bit vector created by bvec_new(). 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to free
+ */
+void bvec_free(bitvec *v) {
+    bstr_free(v);
+}
+
+/**
+ * Initialises a bit vector on words provided by the caller, with every bit 
+ * 0. The words must have room for BVEC_WORDS(len) words. 
+ *
+ * PARAMETERS: 
+ * v     - the bit vector to initialise
+ * words - the words to store the bits
+ * len   - the number of bits
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_init(bitvec *v, uint64_t *words, size_t len) {
+    if (v == NULL || (words == NULL && len > 0))
+        return false;
+
+    v->len = len;
+    v->words = words;
+    if (len > 0)
+        memset(words, 0, BVEC_WORDS(len) * sizeof *words);
+    return true;
+}
+
+/**
+ * Returns the specified bit of a bit vector. No bounds checking will be 
+ * performed. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector
+ * i - the index of the bit
+ *
+ * RETURNS: 
+ * The bit, 0 or 1. 
+ */
+int bvec_get(const bitvec *v, size_t i) {
+    return (int)(v->words[i / 64] >> (63 - i % 64)) & 1;
+}
+
+/**
+ * Sets the specified bit of a bit vector. No bounds checking will be 
+ * performed. 
+ *
+ * PARAMETERS: 
+ * v   - the bit vector
+ * i   - the index of the bit
+ * bit - the new bit, 0 or 1
+ */
+void bvec_set(bitvec *v, size_t i, int bit) {
+    uint64_t mask = (uint64_t)1 << (63 - i % 64);
+    if (bit)
+        v->words[i / 64] |= mask;
+    else
+        v->words[i / 64] &= ~mask;
+}
+
+/**
+ * Performs XOR on the given bit vectors and store the result on the left 
+ * oprand. Both bit vectors must have the same length. 
+ *
+ * PARAMETERS: 
+ * a - the left oprand
+ * b - the right oprand
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_xor(bitvec *a, const bitvec *b) {
+    if (a == NULL || b == NULL || a->len != b->len)
+        return false;        //a or b is invalid, or length differ
+
+    for (size_t i = 0; i < BVEC_WORDS(a->len); i++)
+        a->words[i] ^= b->words[i];
+    return true;
+}
+
+/**
+ * Flips the specified bit vector, changing every 1 to 0 and 0 to 1. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to flip
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_flip(bitvec *v) {
+    if (v == NULL)
+        return false;
+
+    for (size_t i = 0; i < BVEC_WORDS(v->len); i++)
+        v->words[i] = ~v->words[i];
+    clear_tail(v);
+    return true;
+}
+
+/**
+ * Swaps the halves of the specified bit vector. The length must be even. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to swap
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_swap(bitvec *v) {
+    if (v == NULL || v->len % 2 != 0)
+        return false;    //odd length
+    return bvec_lrot(v, v->len / 2);
+}
+
+/**
+ * Left rotates the specified bit vector in place, for any length. Vectors 
+ * of up to 64 bits, such as the 28-bit key halves, rotate within a single 
+ * word. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to rotate
+ * n - the number of shifts
+ *
+ * RETURNS: 
+ * 1 (true) if rotation is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_lrot(bitvec *v, size_t n) {
+    if (v == NULL)
+        return false;
+    if (v->len == 0 || n % v->len == 0)
+        return true;     //no rotates needed
+
+    n %= v->len;            //reduce to smallest n
+    if (v->len <= 64) {
+        uint64_t w = v->words[0];
+        v->words[0] = (w << n) | (w >> (v->len - n));
+        clear_tail(v);
+        return true;
+    }
+    reverse(v->words, 0, n);    //rotate by three reversals, no temp buffer
+    reverse(v->words, n, v->len);
+    reverse(v->words, 0, v->len);
+    return true;
+}
+
+/**
+ * Right rotates the specified bit vector in place, for any length. Vectors 
+ * of up to 64 bits, such as the 28-bit key halves, rotate within a single 
+ * word. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to rotate
+ * n - the number of shifts
+ *
+ * RETURNS: 
+ * 1 (true) if rotation is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_rrot(bitvec *v, size_t n) {
+    if (v == NULL)
+        return false;
+    if (v->len == 0)
+        return true;
+    return bvec_lrot(v, v->len - n % v->len);
+}
+
+/**
+ * Packs the specified bit string into a bit vector. The length of the bit 
+ * string must be the same as the bit vector. 
+ *
+ * PARAMETERS: 
+ * v   - the bit vector to store the bits
+ * str - the bit string to pack
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_from_bstr(bitvec *v, const char *str) {
+    if (v == NULL || str == NULL)
+        return false;
+
+    for (size_t i = 0; i < BVEC_WORDS(v->len); i++) {
+        size_t n = (v->len - 64 * i < 64 ? v->len - 64 * i : 64);
+        uint64_t w = 0;
+        for (size_t j = 0; j < n; j++) {
+            char c = str[64 * i + j];
+            if (c != '0' && c != '1')
+                return false;       //not a bit string, or too short
+            w = (w << 1) | (uint64_t)(c - '0');
+        }
+        v->words[i] = w << (64 - n);
+    }
+    return str[v->len] == '\0';     //must not be longer either
+}
+
+/**
+ * Unpacks the specified bit vector into a bit string, stored in the 
+ * specified buffer. The buffer must have room for the bits plus the 
+ * terminator. 
+ *
+ * PARAMETERS: 
+ * v    - the bit vector to unpack
+ * out  - the buffer to store the bit string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bvec_to_bstr(const bitvec *v, char *out, size_t size) {
+    if (v == NULL || out == NULL || size <= v->len)
+        return NULL;
+
+    for (size_t i = 0; i < v->len; i++)
+        out[i] = (char)('0' + ((v->words[i / 64] >> (63 - i % 64)) & 1));
+    out[v->len] = '\0';
+    return out;
+}
+
+/**
+ * Packs the specified bytes into a bit vector, the first byte holding bits 
+ * 0 to 7. Reads (len + 7) / 8 bytes, any bits past the length of the bit 
+ * vector are ignored. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to store the bits
+ * b - the bytes to pack
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_from_bytes(bitvec *v, const uint8_t *b) {
+    if (v == NULL || (b == NULL && v->len > 0))
+        return false;
+
+    size_t nbytes = (v->len + 7) / 8;
+    for (size_t i = 0; i < BVEC_WORDS(v->len); i++) {
+        uint64_t w = 0;
+        for (size_t j = 0; j < 8; j++) {
+            size_t k = 8 * i + j;
+            w = (w << 8) | (k < nbytes ? b[k] : 0);
+        }
+        v->words[i] = w;
+    }
+    clear_tail(v);
+    return true;
+}
+
+/**
+ * Unpacks the specified bit vector into bytes, the first byte holding bits 
+ * 0 to 7. Writes (len + 7) / 8 bytes, the bits past the length of the bit 
+ * vector are 0. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to unpack
+ * b - the bytes to store the bits
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_to_bytes(const bitvec *v, uint8_t *b) {
+    if (v == NULL || (b == NULL && v->len > 0))
+        return false;
+
+    for (size_t k = 0; k < (v->len + 7) / 8; k++)
+        b[k] = (uint8_t)(v->words[k / 8] >> (56 - 8 * (k % 8)));
+    return true;
+}
+
+/**
+ * Clears the unused bits of the last word of a bit vector. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector
+ */
+static void clear_tail(bitvec *v) {
+    if (v->len % 64 != 0)
+        v->words[v->len / 64] &= ~(uint64_t)0 << (64 - v->len % 64);
+}
+
+/**
+ * Reads cnt bits starting at the specified position, which may span two 
+ * words. 
+ *
+ * PARAMETERS: 
+ * w   - the words to read
+ * pos - the index of the first bit
+ * cnt - the number of bits, from 1 to 64
+ *
+ * RETURNS: 
+ * The bits, stored in the lowest cnt bits. 
+ */
+static uint64_t get_bits(const uint64_t *w, size_t pos, size_t cnt) {
+    size_t i = pos / 64, off = pos % 64;
+    uint64_t bits = w[i] << off;
+    if (off + cnt > 64)
+        bits |= w[i + 1] >> (64 - off);
+    return bits >> (64 - cnt);
+}
+
+/**
+ * Writes cnt bits starting at the specified position, which may span two 
+ * words. 
+ *
+ * PARAMETERS: 
+ * w    - the words to write
+ * pos  - the index of the first bit
+ * cnt  - the number of bits, from 1 to 64
+ * bits - the bits, stored in the lowest cnt bits
+ */
+static void put_bits(uint64_t *w, size_t pos, size_t cnt, uint64_t bits) {
+    size_t i = pos / 64, off = pos % 64;
+    uint64_t mask = ~(uint64_t)0 << (64 - cnt);
+    bits <<= 64 - cnt;
+    w[i] = (w[i] & ~(mask >> off)) | (bits >> off);
+    if (off + cnt > 64)
+        w[i + 1] = (w[i + 1] & ~(mask << (64 - off))) | (bits << (64 - off));
+}
+
+/**
+ * Reverses the order of the lowest cnt bits. 
+ *
+ * PARAMETERS: 
+ * x   - the bits to reverse
+ * cnt - the number of bits, from 1 to 64
+ *
+ * RETURNS: 
+ * The reversed bits, stored in the lowest cnt bits. 
+ */
+static uint64_t rev_bits(uint64_t x, size_t cnt) {
+    x = ((x >> 1) & 0x5555555555555555) | ((x & 0x5555555555555555) << 1);
+    x = ((x >> 2) & 0x3333333333333333) | ((x & 0x3333333333333333) << 2);
+    x = ((x >> 4) & 0x0f0f0f0f0f0f0f0f) | ((x & 0x0f0f0f0f0f0f0f0f) << 4);
+    x = ((x >> 8) & 0x00ff00ff00ff00ff) | ((x & 0x00ff00ff00ff00ff) << 8);
+    x = ((x >> 16) & 0x0000ffff0000ffff) | ((x & 0x0000ffff0000ffff) << 16);
+    x = (x >> 32) | (x << 32);
+    return x >> (64 - cnt);
+}
+
+/**
+ * Reverses the bits from a up to but not including b in place, swapping 
+ * 64 bits from each end at a time. 
+ *
+ * PARAMETERS: 
+ * w - the words holding the bits
+ * a - the index of the first bit
+ * b - the index after the last bit
+ */
+static void reverse(uint64_t *w, size_t a, size_t b) {
+    for (; b - a >= 128; a += 64, b -= 64) {
+        uint64_t lo = get_bits(w, a, 64);
+        uint64_t hi = get_bits(w, b - 64, 64);
+        put_bits(w, a, 64, rev_bits(hi, 64));
+        put_bits(w, b - 64, 64, rev_bits(lo, 64));
+    }
+
+    size_t m = b - a;           //less than 128 bits left in the middle
+    if (m > 64) {
+        uint64_t lo = get_bits(w, a, 64);
+        uint64_t hi = get_bits(w, a + 64, m - 64);
+        put_bits(w, a, m - 64, rev_bits(hi, m - 64));
+        put_bits(w, a + m - 64, 64, rev_bits(lo, 64));
+    } else if (m > 0) {
+        put_bits(w, a, m, rev_bits(get_bits(w, a, m), m));
+    }
+}
@@ -0,0 +1,211 @@
+/**
+ * FILE:   bitvec.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Packed bit vectors, storing 64 bits in every word instead of one bit in 
+ * every character like the bit strings of bitstr.h. 
+ *
+ * C99
+ */
+
+#ifndef __bitvec_h__
+#define __bitvec_h__
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "bitstr.h"
+
+/**
+ * The number of words needed to store the specified number of bits. 
+ */
+#define BVEC_WORDS(len) (((len) + 63) / 64)
+
+/**
+ * A packed bit vector. Bit 0 is the most significant bit of the first 
+ * word, matching the first character of a bit string. The unused bits of 
+ * the last word are always 0. 
+ */
+typedef struct bitvec {
+    size_t len;             //number of bits
+    uint64_t *words;        //BVEC_WORDS(len) words of bits
+} bitvec;
+
+/**
+ * Creates a bit vector of the specified length, with every bit 0. The bit 
+ * vector is allocated with bstr_alloc(), free it with bvec_free(). 
+ *
+ * PARAMETERS: 
+ * len - the number of bits
+ *
+ * RETURNS: 
+ * The new bit vector, or NULL if any error occurred. 
+ */
+bitvec *bvec_new(size_t len);
+
+/**
+ * Frees the specified bit vector created by bvec_new(). 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to free
+ */
+void bvec_free(bitvec *v);
+
+/**
+ * Initialises a bit vector on words provided by the caller, with every bit 
+ * 0. The words must have room for BVEC_WORDS(len) words. 
+ *
+ * PARAMETERS: 
+ * v     - the bit vector to initialise
+ * words - the words to store the bits
+ * len   - the number of bits
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_init(bitvec *v, uint64_t *words, size_t len);
+
+/**
+ * Returns the specified bit of a bit vector. No bounds checking will be 
+ * performed. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector
+ * i - the index of the bit
+ *
+ * RETURNS: 
+ * The bit, 0 or 1. 
+ */
+int bvec_get(const bitvec *v, size_t i);
+
+/**
+ * Sets the specified bit of a bit vector. No bounds checking will be 
+ * performed. 
+ *
+ * PARAMETERS: 
+ * v   - the bit vector
+ * i   - the index of the bit
+ * bit - the new bit, 0 or 1
+ */
+void bvec_set(bitvec *v, size_t i, int bit);
+
+/**
+ * Performs XOR on the given bit vectors and store the result on the left 
+ * oprand. Both bit vectors must have the same length. 
+ *
+ * PARAMETERS: 
+ * a - the left oprand
+ * b - the right oprand
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_xor(bitvec *a, const bitvec *b);
+
+/**
+ * Flips the specified bit vector, changing every 1 to 0 and 0 to 1. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to flip
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_flip(bitvec *v);
+
+/**
+ * Swaps the halves of the specified bit vector. The length must be even. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to swap
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_swap(bitvec *v);
+
+/**
+ * Left rotates the specified bit vector in place, for any length. Vectors 
+ * of up to 64 bits, such as the 28-bit key halves, rotate within a single 
+ * word. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to rotate
+ * n - the number of shifts
+ *
+ * RETURNS: 
+ * 1 (true) if rotation is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_lrot(bitvec *v, size_t n);
+
+/**
+ * Right rotates the specified bit vector in place, for any length. Vectors 
+ * of up to 64 bits, such as the 28-bit key halves, rotate within a single 
+ * word. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to rotate
+ * n - the number of shifts
+ *
+ * RETURNS: 
+ * 1 (true) if rotation is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_rrot(bitvec *v, size_t n);
+
+/**
+ * Packs the specified bit string into a bit vector. The length of the bit 
+ * string must be the same as the bit vector. 
+ *
+ * PARAMETERS: 
+ * v   - the bit vector to store the bits
+ * str - the bit string to pack
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_from_bstr(bitvec *v, const char *str);
+
+/**
+ * Unpacks the specified bit vector into a bit string, stored in the 
+ * specified buffer. The buffer must have room for the bits plus the 
+ * terminator. 
+ *
+ * PARAMETERS: 
+ * v    - the bit vector to unpack
+ * out  - the buffer to store the bit string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *bvec_to_bstr(const bitvec *v, char *out, size_t size);
+
+/**
+ * Packs the specified bytes into a bit vector, the first byte holding bits 
+ * 0 to 7. Reads (len + 7) / 8 bytes, any bits past the length of the bit 
+ * vector are ignored. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to store the bits
+ * b - the bytes to pack
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_from_bytes(bitvec *v, const uint8_t *b);
+
+/**
+ * Unpacks the specified bit vector into bytes, the first byte holding bits 
+ * 0 to 7. Writes (len + 7) / 8 bytes, the bits past the length of the bit 
+ * vector are 0. 
+ *
+ * PARAMETERS: 
+ * v - the bit vector to unpack
+ * b - the bytes to store the bits
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool bvec_to_bytes(const bitvec *v, uint8_t *b);
+
+#endif
@@ -12,8 +12,26 @@
 #define __des_h__
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include "bitstr.h"
 
+/**
+ * The expanded key schedule of a DES key, holding the 48-bit subkey of 
+ * each round. Set up once with des_key_setup(), then reuse for any number 
+ * of blocks. 
+ */
+typedef struct des_key_schedule {
+    uint64_t k48[16];       //subkeys of round 1 to 16
+} des_key_schedule;
+
+/**
+ * The expanded key schedules of a triple DES key. Set up once with 
+ * tdes_key_setup(), then reuse for any number of blocks. 
+ */
+typedef struct tdes_key_schedule {
+    des_key_schedule ks[3];     //schedules of key 1, 2 and 3
+} tdes_key_schedule;
+
 /**
  * Encrypts the specified message with the specified key. The key must be 
  * 64 bits, if it is not then it will be padded or truncated. The result 
@@ -29,6 +47,22 @@
  */
 char *des_enc(char *msg, char *k64);
 
+/**
+ * Encrypts the specified message with the specified key, like des_enc(). 
+ * The cipher text is stored in the specified buffer instead of allocating, 
+ * the buffer must have room for 65 characters. 
+ *
+ * PARAMETERS: 
+ * msg  - the message to encrypt
+ * k64  - the 64-bit key
+ * out  - the buffer to store the cipher text
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *des_enc_r(char *msg, char *k64, char *out, size_t size);
+
 /**
  * Decrypts the specified message with the given key. The key must be 
  * 64 bits, if it is not then it will be padded or truncated. The result 
@@ -44,6 +78,140 @@ char *des_enc(char *msg, char *k64);
  */
 char *des_dec(char *msg, char *k64);
 
+/**
+ * Decrypts the specified message with the given key, like des_dec(). The 
+ * plain text is stored in the specified buffer instead of allocating, the 
+ * buffer must have room for 65 characters. 
+ *
+ * PARAMETERS: 
+ * msg  - the message to decrypt
+ * k64  - the 64-bit key
+ * out  - the buffer to store the plain text
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *des_dec_r(char *msg, char *k64, char *out, size_t size);
+
+/**
+ * Expands the specified 64-bit key into the 16 round subkeys. The key 
+ * schedule can then be reused for any number of blocks, for both 
+ * encryption and decryption. The parity bits of the key are ignored. 
+ *
+ * PARAMETERS: 
+ * ks  - the key schedule to store the subkeys
+ * k64 - the 64-bit key
+ */
+void des_key_setup(des_key_schedule *ks, uint64_t k64);
+
+/**
+ * Encrypts the specified 64-bit block with the specified key schedule. 
+ * The most significant bit of the block is bit 1 in the DES tables. This 
+ * function does not allocate any memory. 
+ *
+ * PARAMETERS: 
+ * block - the 64-bit block to encrypt
+ * ks    - the key schedule
+ *
+ * RETURNS: 
+ * The 64-bit cipher text block. 
+ */
+uint64_t des_enc_block(uint64_t block, const des_key_schedule *ks);
+
+/**
+ * Decrypts the specified 64-bit block with the specified key schedule. 
+ * The most significant bit of the block is bit 1 in the DES tables. This 
+ * function does not allocate any memory. 
+ *
+ * PARAMETERS: 
+ * block - the 64-bit block to decrypt
+ * ks    - the key schedule
+ *
+ * RETURNS: 
+ * The 64-bit plain text block. 
+ */
+uint64_t des_dec_block(uint64_t block, const des_key_schedule *ks);
+
+/**
+ * Runs the f-function of DES on the specified right half and subkey, for 
+ * tests and benchmarks. The rounds call the same function. 
+ *
+ * PARAMETERS: 
+ * r   - the 32-bit right half
+ * k48 - the 48-bit subkey
+ *
+ * RETURNS: 
+ * The 32-bit result, XORed into the left half by a round. 
+ */
+uint32_t des_f_func(uint32_t r, uint64_t k48);
+
+/**
+ * Loads 8 bytes as a big endian 64-bit block, the first byte holding bits 
+ * 1 to 8 of the block. 
+ *
+ * PARAMETERS: 
+ * b - the bytes to load
+ *
+ * RETURNS: 
+ * The 64-bit block. 
+ */
+uint64_t des_load64(const uint8_t *b);
+
+/**
+ * Stores a 64-bit block as 8 big endian bytes, the first byte holding bits 
+ * 1 to 8 of the block. 
+ *
+ * PARAMETERS: 
+ * b - the bytes to store
+ * v - the 64-bit block
+ */
+void des_store64(uint8_t *b, uint64_t v);
+
+/**
+ * Expands the specified keys into a triple DES key schedule. For 3-key 
+ * triple DES (EDE3) all keys are different, for 2-key triple DES (EDE2) 
+ * k3 is the same as k1. 
+ *
+ * PARAMETERS: 
+ * ks - the key schedule to store the subkeys
+ * k1 - the 64-bit key of the first stage
+ * k2 - the 64-bit key of the second stage
+ * k3 - the 64-bit key of the third stage
+ */
+void tdes_key_setup(tdes_key_schedule *ks, uint64_t k1, uint64_t k2,
+        uint64_t k3);
+
+/**
+ * Encrypts the specified 64-bit block with triple DES, encrypting with 
+ * key 1, decrypting with key 2 and encrypting with key 3. The inner 
+ * IP_INV and IP cancel out, so all 48 rounds run between one IP and one 
+ * IP_INV. 
+ *
+ * PARAMETERS: 
+ * block - the 64-bit block to encrypt
+ * ks    - the triple DES key schedule
+ *
+ * RETURNS: 
+ * The 64-bit cipher text block. 
+ */
+uint64_t tdes_enc_block(uint64_t block, const tdes_key_schedule *ks);
+
+/**
+ * Decrypts the specified 64-bit block with triple DES, decrypting with 
+ * key 3, encrypting with key 2 and decrypting with key 1. The inner 
+ * IP_INV and IP cancel out, so all 48 rounds run between one IP and one 
+ * IP_INV. 
+ *
+ * PARAMETERS: 
+ * block - the 64-bit block to decrypt
+ * ks    - the triple DES key schedule
+ *
+ * RETURNS: 
+ * The 64-bit plain text block. 
+ */
+uint64_t tdes_dec_block(uint64_t block, const tdes_key_schedule *ks);
+
 /**
  * Permutes the specified bit string using the given permutation and length. 
  * Returns the result bit string after the permutation (dynamically 
@@ -60,4 +228,23 @@ char *des_dec(char *msg, char *k64);
  */
 char *des_permute(char *str, const int p[], size_t s);
 
+/**
+ * Permutes the specified bit string using the given permutation and length, 
+ * like des_permute(). The result is stored in the specified buffer instead 
+ * of allocating, the buffer must have room for len + 1 characters and must 
+ * not overlap the input. 
+ *
+ * PARAMETERS: 
+ * str  - the bit string to permute
+ * p    - the permutation mapping
+ * len  - the length of the permutation mapping
+ * out  - the buffer to store the permutated bit string
+ * size - the size of the buffer
+ *
+ * RETURNS: 
+ * The buffer, or NULL if any error occurred. 
+ */
+char *des_permute_r(char *str, const int p[], size_t len, char *out,
+        size_t size);
+
 #endif
@@ -0,0 +1,900 @@
+/**
+ * FILE:   desbench.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Benchmarks of every layer of the library, from the bit string helpers 
+ * to bulk encryption on a pool of threads. 
+ *
+ *     desbench [-c] [-b backend] [-f text|json|csv] [-s sizes]
+ *              [-t threads] [-m ms] [name]
+ *
+ * The micro benchmarks time the bit string helpers, des_permute(), the 
+ * f-function, the key schedule and single blocks. The bulk benchmarks time 
+ * the modes for every input size in bytes and every thread count, both 
+ * comma separated lists, by default on one thread and on every CPU. With 
+ * -c every backend encrypts the same blocks, compared to the bit string 
+ * path. Each benchmark runs for at least the given milliseconds, 200 by 
+ * default. Only benchmarks whose name contains the given name are run. 
+ * -b runs on the given CPU backend instead of the one des_backend_get() 
+ * picks. Results are printed as text, JSON or CSV, each tagged with the 
+ * backend. 
+ *
+ * C99, POSIX
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "des.h"
+#include "descpu.h"
+#include "desstd.h"
+#include "deskcache.h"
+#include "desbs.h"
+#include "desmode.h"
+#include "desinline.h"
+#include "despar.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BENCH_TSC
+#endif
+
+#define MAX_LIST 16             //the most sizes or thread counts
+
+static const uint64_t KEYS[3] = {   //keys of every benchmark
+    0x133457799bbcdff1ULL, 0x0123456789abcdefULL, 0xfedcba9876543210ULL
+};
+
+/**
+ * The output formats. 
+ */
+typedef enum Format { FMT_TEXT, FMT_JSON, FMT_CSV } Format;
+
+/**
+ * The state shared by every benchmark function. 
+ */
+typedef struct Bench {
+    char a[65], b[65];          //64-bit bit strings
+    char key[65];               //64-bit bit string key
+    char out[65];               //bit string result
+    des_key_schedule ks;        //schedule of the key
+    tdes_key_schedule tks;      //triple DES schedule
+    uint64_t block;             //a packed block
+    uint8_t *in, *buf;          //bulk input and output
+    size_t size;                //bytes per bulk operation
+    des_mode mode;              //mode of the bulk operation
+    _Bool dec;                  //whether the bulk operation decrypts
+    _Bool triple;               //whether the bulk operation is triple DES
+    des_pool *pool;             //pool of the bulk operation, may be NULL
+} Bench;
+
+/**
+ * A benchmark function, running the operation the specified times. 
+ */
+typedef void (*BenchFunc)(Bench *b, size_t iters);
+
+/**
+ * A named benchmark, with the bytes handled by every operation. 
+ */
+typedef struct BenchDef {
+    const char *name;           //name of the benchmark
+    BenchFunc func;             //the benchmark function
+    size_t bytes;               //bytes per operation, 0 if not meaningful
+} BenchDef;
+
+/**
+ * The result of a benchmark. 
+ */
+typedef struct Result {
+    const char *group;          //micro, bulk or compare
+    const char *name;           //name of the benchmark
+    size_t size;                //bytes per operation
+    size_t threads;             //number of threads
+    double ns;                  //nanoseconds per operation
+    double mbps;                //megabytes per second, 0 if no bytes
+    double cpb;                 //TSC cycles per byte, negative if unknown
+    double speedup;             //over the baseline, 0 if none
+} Result;
+
+static Format format = FMT_TEXT;    //output format
+static double min_ns = 200e6;       //minimum time of a benchmark
+static int nresults = 0;            //results printed so far
+static volatile uint64_t sink;      //keeps results alive
+
+static void bench_len(Bench *b, size_t iters);
+static void bench_xor(Bench *b, size_t iters);
+static void bench_lrot(Bench *b, size_t iters);
+static void bench_swap(Bench *b, size_t iters);
+static void bench_permute(Bench *b, size_t iters);
+static void bench_f(Bench *b, size_t iters);
+static void bench_key(Bench *b, size_t iters);
+static void bench_kcache(Bench *b, size_t iters);
+static void bench_enc(Bench *b, size_t iters);
+static void bench_dec(Bench *b, size_t iters);
+static void bench_enc_r(Bench *b, size_t iters);
+static void bench_enc_block(Bench *b, size_t iters);
+static void bench_dec_block(Bench *b, size_t iters);
+static void bench_enc_inline(Bench *b, size_t iters);
+static void bench_tdes_block(Bench *b, size_t iters);
+static void bench_mode(Bench *b, size_t iters);
+static void cmp_string(Bench *b, size_t iters);
+static void cmp_string_r(Bench *b, size_t iters);
+static void cmp_block(Bench *b, size_t iters);
+static void cmp_batch(Bench *b, size_t iters);
+static void cmp_block_keys(Bench *b, size_t iters);
+static void cmp_batch_keys(Bench *b, size_t iters);
+static void cmp_bytes(Bench *b, size_t iters);
+static void cmp_parallel(Bench *b, size_t iters);
+static Result measure(Bench *b, BenchFunc func, size_t bytes);
+static double now_ns(void);
+static uint64_t cycles(void);
+static void report(const Result *r);
+static size_t parse_list(const char *str, size_t *list);
+static int usage(const char *prog);
+
+static const BenchDef MICRO[] = {
+    { "bstr_len", &bench_len, 0 },
+    { "bstr_xor", &bench_xor, 0 },
+    { "bstr_lrot", &bench_lrot, 0 },
+    { "bstr_swap", &bench_swap, 0 },
+    { "des_permute", &bench_permute, 0 },
+    { "f_func", &bench_f, 0 },
+    { "des_key_setup", &bench_key, 0 },
+    { "des_kcache_setup", &bench_kcache, 0 },
+    { "des_enc", &bench_enc, 8 },
+    { "des_dec", &bench_dec, 8 },
+    { "des_enc_r", &bench_enc_r, 8 },
+    { "des_enc_block", &bench_enc_block, 8 },
+    { "des_dec_block", &bench_dec_block, 8 },
+    { "des_enc_inline", &bench_enc_inline, 8 },
+    { "tdes_enc_block", &bench_tdes_block, 8 }
+};
+
+/**
+ * A bulk benchmark, a mode of operation in one direction. 
+ */
+typedef struct BulkDef {
+    const char *name;           //name of the benchmark
+    des_mode mode;              //mode of operation
+    _Bool dec;                  //whether to decrypt
+    _Bool triple;               //whether to use triple DES
+    _Bool parallel;             //whether the mode runs on a pool
+} BulkDef;
+
+static const BulkDef BULK[] = {
+    { "ecb_enc", DES_ECB, false, false, true },
+    { "cbc_enc", DES_CBC, false, false, false },
+    { "cbc_dec", DES_CBC, true, false, true },
+    { "ctr", DES_CTR, false, false, true },
+    { "tdes_cbc_enc", DES_CBC, false, true, false },
+    { "tdes_ctr", DES_CTR, false, true, true }
+};
+
+static const BenchDef COMPARE[] = {
+    { "string", &cmp_string, 0 },
+    { "string_r", &cmp_string_r, 0 },
+    { "block", &cmp_block, 0 },
+    { "batch", &cmp_batch, 0 },
+    { "block_keys", &cmp_block_keys, 0 },
+    { "batch_keys", &cmp_batch_keys, 0 },
+    { "bytes", &cmp_bytes, 0 },
+    { "parallel", &cmp_parallel, 0 }
+};
+
+/**
+ * Parses the arguments, then runs and reports the benchmarks. 
+ *
+ * PARAMETERS: 
+ * argc - the number of arguments
+ * argv - the arguments
+ *
+ * RETURNS: 
+ * 0 if successful, 1 otherwise. 
+ */
+int main(int argc, char **argv) {
+    size_t sizes[MAX_LIST] = { 4096, 65536, 1 << 20, 16 << 20 };
+    size_t threads[MAX_LIST] = { 1 };
+    size_t nsizes = 4, nthreads = 0;
+    _Bool compare = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "cb:f:s:t:m:")) != -1) {
+        switch (opt) {
+        case 'c':
+            compare = true;
+            break;
+        case 'b': {
+            des_backend be;
+            if (!des_backend_find(optarg, &be))
+                return usage(argv[0]);
+            if (!des_backend_set(be)) {
+                fprintf(stderr, "%s: backend %s not supported by this CPU\n",
+                        argv[0], optarg);
+                return 1;
+            }
+            break;
+        }
+        case 'f':
+            if (strcmp(optarg, "text") == 0)
+                format = FMT_TEXT;
+            else if (strcmp(optarg, "json") == 0)
+                format = FMT_JSON;
+            else if (strcmp(optarg, "csv") == 0)
+                format = FMT_CSV;
+            else
+                return usage(argv[0]);
+            break;
+        case 's':
+            if ((nsizes = parse_list(optarg, sizes)) == 0)
+                return usage(argv[0]);
+            break;
+        case 't':
+            if ((nthreads = parse_list(optarg, threads)) == 0)
+                return usage(argv[0]);
+            break;
+        case 'm':
+            min_ns = strtod(optarg, NULL) * 1e6;
+            if (min_ns <= 0)
+                return usage(argv[0]);
+            break;
+        default:
+            return usage(argv[0]);
+        }
+    }
+    if (argc - optind > 1)
+        return usage(argv[0]);
+    const char *filter = (optind < argc ? argv[optind] : "");
+
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nthreads == 0)          //one thread, then every CPU
+        nthreads = (cpus > 1 ? (threads[1] = (size_t)cpus, 2) : 1);
+    size_t maxsize = 4096;      //the compare benchmarks use 4096 bytes
+    for (size_t i = 0; i < nsizes; i++) {
+        if (sizes[i] % 8 != 0)
+            return usage(argv[0]);  //whole blocks for ECB and CBC
+        if (sizes[i] > maxsize)
+            maxsize = sizes[i];
+    }
+
+    Bench b;
+    memset(&b, 0, sizeof b);
+    for (int i = 0; i < 64; i++) {
+        b.a[i] = "0110"[i % 4];
+        b.b[i] = "0011101"[i % 7];
+        b.key[i] = "0001001100110100"[i % 16];
+    }
+    des_key_setup(&b.ks, KEYS[0]);
+    tdes_key_setup(&b.tks, KEYS[0], KEYS[1], KEYS[2]);
+    b.block = 0x0123456789abcdefULL;
+    b.in = malloc(maxsize);
+    b.buf = malloc(maxsize + 8);
+    if (b.in == NULL || b.buf == NULL) {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return 1;
+    }
+    for (size_t i = 0; i < maxsize; i++)
+        b.in[i] = (uint8_t)(i * 131 + 7);
+
+    if (format == FMT_JSON)
+        printf("[\n");
+    else if (format == FMT_CSV)
+        printf("backend,group,name,size,threads,ns_per_op,mb_per_s,"
+                "cycles_per_byte,speedup\n");
+    else
+        printf("backend %s\n", des_backend_name(des_backend_get()));
+
+    if (compare) {
+        b.size = 4096;
+        b.pool = des_pool_new(0);
+        double base = 0;
+        for (size_t i = 0; i < sizeof COMPARE / sizeof *COMPARE; i++) {
+            if (strstr(COMPARE[i].name, filter) == NULL)
+                continue;
+            Result r = measure(&b, COMPARE[i].func, b.size);
+            r.group = "compare";
+            r.name = COMPARE[i].name;
+            r.threads = (COMPARE[i].func == &cmp_parallel && b.pool != NULL ?
+                    (size_t)(cpus > 0 ? cpus : 1) : 1);
+            if (i == 0)
+                base = r.ns;        //the bit string path is the baseline
+            r.speedup = (base > 0 ? base / r.ns : 0);
+            report(&r);
+        }
+        des_pool_free(b.pool);
+    } else {
+        for (size_t i = 0; i < sizeof MICRO / sizeof *MICRO; i++) {
+            if (strstr(MICRO[i].name, filter) == NULL)
+                continue;
+            Result r = measure(&b, MICRO[i].func, MICRO[i].bytes);
+            r.group = "micro";
+            r.name = MICRO[i].name;
+            report(&r);
+        }
+
+        for (size_t i = 0; i < sizeof BULK / sizeof *BULK; i++) {
+            if (strstr(BULK[i].name, filter) == NULL)
+                continue;
+            b.mode = BULK[i].mode;
+            b.dec = BULK[i].dec;
+            b.triple = BULK[i].triple;
+            for (size_t t = 0; t < nthreads; t++) {
+                if (threads[t] > 1 && !BULK[i].parallel)
+                    continue;       //runs on one thread anyway
+                b.pool = NULL;
+                if (threads[t] > 1 && (b.pool = des_pool_new(threads[t])) ==
+                        NULL) {
+                    fprintf(stderr, "%s: cannot start threads\n", argv[0]);
+                    return 1;
+                }
+                for (size_t s = 0; s < nsizes; s++) {
+                    b.size = sizes[s];
+                    Result r = measure(&b, &bench_mode, b.size);
+                    r.group = "bulk";
+                    r.name = BULK[i].name;
+                    r.threads = threads[t];
+                    report(&r);
+                }
+                des_pool_free(b.pool);
+            }
+        }
+    }
+
+    if (format == FMT_JSON)
+        printf("\n]\n");
+    free(b.in);
+    free(b.buf);
+    return 0;
+}
+
+/**
+ * Benchmarks bstr_len() on a 64-bit string. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_len(Bench *b, size_t iters) {
+    char *volatile str = b->a;      //read again by every call
+    size_t sum = 0;
+    for (size_t i = 0; i < iters; i++)
+        sum += bstr_len(str);
+    sink = sum;
+}
+
+/**
+ * Benchmarks bstr_xor() on two 64-bit strings, in place. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_xor(Bench *b, size_t iters) {
+    for (size_t i = 0; i < iters; i++)
+        bstr_xor(b->a, b->b);
+    sink = b->a[0];
+}
+
+/**
+ * Benchmarks bstr_lrot() by one bit on a 64-bit string, in place. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_lrot(Bench *b, size_t iters) {
+    for (size_t i = 0; i < iters; i++)
+        bstr_lrot(b->a, 1);
+    sink = b->a[0];
+}
+
+/**
+ * Benchmarks bstr_swap() on a 64-bit string, in place. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_swap(Bench *b, size_t iters) {
+    for (size_t i = 0; i < iters; i++)
+        bstr_swap(b->a);
+    sink = b->a[0];
+}
+
+/**
+ * Benchmarks des_permute_r() with the initial permutation. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_permute(Bench *b, size_t iters) {
+    for (size_t i = 0; i < iters; i++)
+        des_permute_r(b->a, IP, 64, b->out, sizeof b->out);
+    sink = b->out[0];
+}
+
+/**
+ * Benchmarks the f-function, feeding every result into the next call. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_f(Bench *b, size_t iters) {
+    uint32_t r = 0x12345678;
+    for (size_t i = 0; i < iters; i++)
+        r ^= des_f_func(r, b->ks.k48[i & 15]);
+    sink = r;
+}
+
+/**
+ * Benchmarks des_key_setup(). 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_key(Bench *b, size_t iters) {
+    des_key_schedule ks;
+    for (size_t i = 0; i < iters; i++)
+        des_key_setup(&ks, b->block + (i & 255));
+    sink = ks.k48[15];
+}
+
+/**
+ * Benchmarks des_kcache_setup() on 256 keys, all hits after the first 
+ * call. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_kcache(Bench *b, size_t iters) {
+    des_key_schedule ks;
+    for (size_t i = 0; i < iters; i++)
+        des_kcache_setup(&ks, b->block + 2 * (i & 255));
+    sink = ks.k48[15];
+}
+
+/**
+ * Benchmarks des_enc(), including the allocation of the result. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_enc(Bench *b, size_t iters) {
+    for (size_t i = 0; i < iters; i++) {
+        char *ct = des_enc(b->a, b->key);
+        sink = ct[0];
+        bstr_free(ct);
+    }
+}
+
+/**
+ * Benchmarks des_dec(), including the allocation of the result. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_dec(Bench *b, size_t iters) {
+    for (size_t i = 0; i < iters; i++) {
+        char *pt = des_dec(b->a, b->key);
+        sink = pt[0];
+        bstr_free(pt);
+    }
+}
+
+/**
+ * Benchmarks des_enc_r(), encrypting into a buffer. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_enc_r(Bench *b, size_t iters) {
+    for (size_t i = 0; i < iters; i++)
+        des_enc_r(b->a, b->key, b->out, sizeof b->out);
+    sink = b->out[0];
+}
+
+/**
+ * Benchmarks des_enc_block(), feeding every result into the next call. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_enc_block(Bench *b, size_t iters) {
+    uint64_t v = b->block;
+    for (size_t i = 0; i < iters; i++)
+        v = des_enc_block(v, &b->ks);
+    sink = v;
+}
+
+/**
+ * Benchmarks the header-only des_enc_block_inline(), feeding every result 
+ * into the next block. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_enc_inline(Bench *b, size_t iters) {
+    uint64_t v = b->block;
+    for (size_t i = 0; i < iters; i++)
+        v = des_enc_block_inline(v, &b->ks);
+    sink = v;
+}
+
+/**
+ * Benchmarks des_dec_block(), feeding every result into the next call. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_dec_block(Bench *b, size_t iters) {
+    uint64_t v = b->block;
+    for (size_t i = 0; i < iters; i++)
+        v = des_dec_block(v, &b->ks);
+    sink = v;
+}
+
+/**
+ * Benchmarks tdes_enc_block(), feeding every result into the next call. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_tdes_block(Bench *b, size_t iters) {
+    uint64_t v = b->block;
+    for (size_t i = 0; i < iters; i++)
+        v = tdes_enc_block(v, &b->tks);
+    sink = v;
+}
+
+/**
+ * Benchmarks a mode of operation over the input, on the pool if there is 
+ * one. Every operation is a whole message with a fresh context. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void bench_mode(Bench *b, size_t iters) {
+    des_mode_ctx ctx;
+    size_t len = 0;
+    for (size_t i = 0; i < iters; i++) {
+        if (b->triple)
+            tdes_mode_init(&ctx, b->mode, b->dec, KEYS[0], KEYS[1], KEYS[2],
+                    b->block, false);
+        else
+            des_mode_init(&ctx, b->mode, b->dec, KEYS[0], b->block, false);
+        if (b->pool != NULL)
+            des_mode_parallel(b->pool, &ctx, b->buf, &len, b->in, b->size);
+        else
+            des_mode_update(&ctx, b->buf, &len, b->in, b->size);
+    }
+    sink = len;
+}
+
+/**
+ * Encrypts the input a block at a time through des_enc(), converting every 
+ * block to and from a bit string. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void cmp_string(Bench *b, size_t iters) {
+    char msg[65];
+    for (size_t i = 0; i < iters; i++) {
+        for (size_t j = 0; j < b->size; j += 8) {
+            uint64_t v = des_load64(b->in + j);
+            for (int k = 63; k >= 0; k--, v >>= 1)
+                msg[k] = (char)('0' + (v & 1));
+            msg[64] = '\0';
+            char *ct = des_enc(msg, b->key);
+            for (int k = 0; k < 64; k++)
+                v = (v << 1) | (uint64_t)(ct[k] == '1');
+            bstr_free(ct);
+            des_store64(b->buf + j, v);
+        }
+    }
+    sink = b->buf[0];
+}
+
+/**
+ * Encrypts the input a block at a time through des_enc_r(), without any 
+ * allocation. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void cmp_string_r(Bench *b, size_t iters) {
+    char msg[65], ct[65];
+    for (size_t i = 0; i < iters; i++) {
+        for (size_t j = 0; j < b->size; j += 8) {
+            uint64_t v = des_load64(b->in + j);
+            for (int k = 63; k >= 0; k--, v >>= 1)
+                msg[k] = (char)('0' + (v & 1));
+            msg[64] = '\0';
+            des_enc_r(msg, b->key, ct, sizeof ct);
+            for (int k = 0; k < 64; k++)
+                v = (v << 1) | (uint64_t)(ct[k] == '1');
+            des_store64(b->buf + j, v);
+        }
+    }
+    sink = b->buf[0];
+}
+
+/**
+ * Encrypts the input a block at a time through des_enc_block(). 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void cmp_block(Bench *b, size_t iters) {
+    for (size_t i = 0; i < iters; i++)
+        for (size_t j = 0; j < b->size; j += 8)
+            des_store64(b->buf + j, des_enc_block(des_load64(b->in + j),
+                    &b->ks));
+    sink = b->buf[0];
+}
+
+/**
+ * Encrypts the input through the bitsliced des_enc_batch(). 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void cmp_batch(Bench *b, size_t iters) {
+    uint64_t blocks[512];
+    for (size_t i = 0; i < iters; i++) {
+        size_t n = b->size / 8;
+        for (size_t j = 0; j < n; j++)
+            blocks[j] = des_load64(b->in + 8 * j);
+        des_enc_batch(blocks, blocks, n, &b->ks);
+        for (size_t j = 0; j < n; j++)
+            des_store64(b->buf + 8 * j, blocks[j]);
+    }
+    sink = b->buf[0];
+}
+
+/**
+ * Encrypts the input a block at a time, each under its own key, setting up 
+ * the key schedule of every block. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void cmp_block_keys(Bench *b, size_t iters) {
+    for (size_t i = 0; i < iters; i++) {
+        for (size_t j = 0; j < b->size; j += 8) {
+            des_key_schedule ks;
+            des_key_setup(&ks, KEYS[0] ^ j);
+            des_store64(b->buf + j, des_enc_block(des_load64(b->in + j),
+                    &ks));
+        }
+    }
+    sink = b->buf[0];
+}
+
+/**
+ * Encrypts the input through the key-agile des_enc_batch_keys(), each 
+ * block under its own key. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void cmp_batch_keys(Bench *b, size_t iters) {
+    uint64_t blocks[512], keys[512];
+    for (size_t i = 0; i < iters; i++) {
+        size_t n = b->size / 8;
+        for (size_t j = 0; j < n; j++) {
+            blocks[j] = des_load64(b->in + 8 * j);
+            keys[j] = KEYS[0] ^ (8 * j);
+        }
+        des_enc_batch_keys(blocks, blocks, keys, n);
+        for (size_t j = 0; j < n; j++)
+            des_store64(b->buf + 8 * j, blocks[j]);
+    }
+    sink = b->buf[0];
+}
+
+/**
+ * Encrypts the input through des_encrypt_bytes(). 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void cmp_bytes(Bench *b, size_t iters) {
+    for (size_t i = 0; i < iters; i++)
+        des_encrypt_bytes(b->buf, b->in, b->size, &b->ks);
+    sink = b->buf[0];
+}
+
+/**
+ * Encrypts the input in ECB mode on the pool, or on this thread if the 
+ * pool could not be started. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * iters - the number of operations
+ */
+static void cmp_parallel(Bench *b, size_t iters) {
+    des_mode_ctx ctx;
+    size_t len = 0;
+    des_mode_init(&ctx, DES_ECB, false, KEYS[0], 0, false);
+    for (size_t i = 0; i < iters; i++) {
+        if (b->pool != NULL)
+            des_mode_parallel(b->pool, &ctx, b->buf, &len, b->in, b->size);
+        else
+            des_mode_update(&ctx, b->buf, &len, b->in, b->size);
+    }
+    sink = len;
+}
+
+/**
+ * Runs the specified benchmark function with a growing number of 
+ * operations, until it runs for at least the minimum time. 
+ *
+ * PARAMETERS: 
+ * b     - the benchmark state
+ * func  - the benchmark function
+ * bytes - the bytes handled by every operation, 0 if not meaningful
+ *
+ * RETURNS: 
+ * The result of the benchmark, without the group and name. 
+ */
+static Result measure(Bench *b, BenchFunc func, size_t bytes) {
+    func(b, 1);                 //warm up caches and lazy tables
+    size_t iters = 1;
+    double ns;
+    uint64_t cyc;
+    for (;;) {
+        uint64_t c0 = cycles();
+        double t0 = now_ns();
+        func(b, iters);
+        ns = now_ns() - t0;
+        cyc = cycles() - c0;
+        if (ns >= min_ns || iters >= ((size_t)1 << 40))
+            break;
+        double grow = (ns > 0 ? min_ns * 1.2 / ns : 100);
+        iters = (size_t)((double)iters * (grow > 100 ? 100 : grow < 2 ? 2 :
+                grow));
+    }
+
+    Result r = { NULL, NULL, bytes, 1, ns / (double)iters, 0, -1, 0 };
+    if (bytes > 0) {
+        r.mbps = (double)bytes * (double)iters / ns * 1e3;
+#ifdef BENCH_TSC
+        r.cpb = (double)cyc / ((double)bytes * (double)iters);
+#endif
+    }
+    return r;
+}
+
+/**
+ * Returns the monotonic time in nanoseconds. 
+ *
+ * RETURNS: 
+ * The time in nanoseconds. 
+ */
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * Returns the time stamp counter of the CPU, or 0 where it is not known. 
+ *
+ * RETURNS: 
+ * The time stamp counter. 
+ */
+static uint64_t cycles(void) {
+#ifdef BENCH_TSC
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * Prints the specified result in the output format. 
+ *
+ * PARAMETERS: 
+ * r - the result to print
+ */
+static void report(const Result *r) {
+    const char *backend = des_backend_name(des_backend_get());
+    switch (format) {
+    case FMT_JSON:
+        printf("%s  {\"backend\": \"%s\", \"group\": \"%s\", \"name\": \"%s\", "
+                "\"size\": %zu, \"threads\": %zu, \"ns_per_op\": %.3f, "
+                "\"mb_per_s\": %.3f, ", (nresults > 0 ? ",\n" : ""), backend,
+                r->group, r->name, r->size, r->threads, r->ns, r->mbps);
+        if (r->cpb >= 0)
+            printf("\"cycles_per_byte\": %.3f, ", r->cpb);
+        else
+            printf("\"cycles_per_byte\": null, ");
+        if (r->speedup > 0)
+            printf("\"speedup\": %.3f}", r->speedup);
+        else
+            printf("\"speedup\": null}");
+        break;
+    case FMT_CSV:
+        printf("%s,%s,%s,%zu,%zu,%.3f,%.3f,", backend, r->group, r->name,
+                r->size, r->threads, r->ns, r->mbps);
+        if (r->cpb >= 0)
+            printf("%.3f", r->cpb);
+        printf(",");
+        if (r->speedup > 0)
+            printf("%.3f", r->speedup);
+        printf("\n");
+        break;
+    default:
+        printf("%-8s %-18s %9zu %3zu %14.1f ns", r->group, r->name, r->size,
+                r->threads, r->ns);
+        if (r->mbps > 0)
+            printf(" %10.2f MB/s", r->mbps);
+        if (r->cpb >= 0)
+            printf(" %8.2f c/B", r->cpb);
+        if (r->speedup > 0)
+            printf(" %8.2fx", r->speedup);
+        printf("\n");
+        break;
+    }
+    nresults++;
+    fflush(stdout);
+}
+
+/**
+ * Parses a comma separated list of positive numbers. 
+ *
+ * PARAMETERS: 
+ * str  - the list to parse
+ * list - the array to store up to MAX_LIST numbers
+ *
+ * RETURNS: 
+ * The number of numbers, or 0 if the list is invalid. 
+ */
+static size_t parse_list(const char *str, size_t *list) {
+    size_t n = 0;
+    while (*str != '\0' && n < MAX_LIST) {
+        char *end;
+        unsigned long long v = strtoull(str, &end, 10);
+        if (end == str || v == 0 || (*end != ',' && *end != '\0'))
+            return 0;
+        list[n++] = (size_t)v;
+        str = (*end == ',' ? end + 1 : end);
+    }
+    return (*str == '\0' ? n : 0);
+}
+
+/**
+ * Prints the usage of the program. 
+ *
+ * PARAMETERS: 
+ * prog - the name of the program
+ *
+ * RETURNS: 
+ * 1, the exit status for bad arguments. 
+ */
+static int usage(const char *prog) {
+    fprintf(stderr, "usage: %s [-c] [-b backend] [-f text|json|csv] "
+            "[-s sizes] [-t threads] [-m ms] [name]\n", prog);
+    return 1;
+}
@@ -0,0 +1,517 @@
+/**
+ * FILE:   desbs.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Bitsliced DES, encrypting many blocks under the same key in parallel, 
+ * many blocks each under its own key, or one block under many keys to 
+ * search for a key. The 64-bit version is portable, the SSE2, AVX2 and 
+ * AVX-512 versions are built with GCC vector extensions and picked by the 
+ * active backend. 
+ *
+ * C99
+ */
+
+#include "desbs.h"
+#include "desstd.h"
+#include "descpu.h"
+#include "desstats.h"
+#include "desprobe.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DES_BS_X86
+#endif
+
+/**
+ * The smallest number of left over blocks worth bitslicing, fewer blocks 
+ * are encrypted one by one. 
+ */
+#define BS_MIN_TAIL 16
+
+/**
+ * The number of key indexes, one for every 56-bit key. 
+ */
+#define BS_KEY_INDEXES ((uint64_t)1 << 56)
+
+/**
+ * Batch function pointer, encrypts or decrypts a multiple of the slice 
+ * width blocks. 
+ */
+typedef void (*BatchFunc)(uint64_t *out, const uint64_t *in, size_t n,
+        const uint64_t *kp, int stages);
+
+/**
+ * The key of a batch, a DES or a triple DES key schedule. 
+ */
+typedef struct BatchKey {
+    const des_key_schedule *ks;     //DES key, NULL for triple DES
+    const tdes_key_schedule *tks;   //triple DES key, NULL for DES
+    _Bool dec;                      //whether to decrypt
+} BatchKey;
+
+/**
+ * A key search, with the tables to run DES where every lane has its own 
+ * key. Key plane j holds bit j + 1 of the key of every lane. 
+ */
+typedef struct SearchKey {
+    uint8_t kbit[16][48];   //key plane of every subkey bit of every round
+    int qbit[64];           //key index bit of every key bit, -1 for parity
+    uint8_t pinv[32];       //output bit of P of every s-box output bit
+    uint64_t pt[64];        //masks of IP of the plain text
+    uint64_t ct[2][64];     //masks of IP of every target, 0 if unused
+    size_t nct;             //number of targets
+} SearchKey;
+
+/**
+ * Bit t of LANE_BITS[q] is bit q of t, the low 6 bits of the key index in 
+ * every bit of a 64-bit lane. 
+ */
+static const uint64_t LANE_BITS[6] = {
+    0xaaaaaaaaaaaaaaaaULL, 0xccccccccccccccccULL, 0xf0f0f0f0f0f0f0f0ULL,
+    0xff00ff00ff00ff00ULL, 0xffff0000ffff0000ULL, 0xffffffff00000000ULL
+};
+
+static void des_batch(uint64_t *out, const uint64_t *in, size_t n,
+        const BatchKey *key);
+static void key_masks(uint64_t *kp, const des_key_schedule *ks, _Bool dec);
+static void keyed_batch(uint64_t *out, const uint64_t *in,
+        const uint64_t *keys, size_t n, _Bool dec);
+static void key_bits(uint8_t kbit[16][48]);
+static void search_setup(SearchKey *key, uint64_t pt, const uint64_t *ct,
+        size_t nct);
+static void ip_masks(uint64_t m[64], uint64_t block);
+static uint64_t range_mask(uint64_t lo, uint64_t first, uint64_t end);
+
+#define BS_T uint64_t
+#define BS_LANES 1
+#define BS_NAME(x) bs64_##x
+#include "desbsimpl.h"
+#undef BS_T
+#undef BS_LANES
+#undef BS_NAME
+
+#ifdef DES_BS_X86
+typedef uint64_t bs128_t __attribute__((vector_size(16)));
+typedef uint64_t bs256_t __attribute__((vector_size(32)));
+typedef uint64_t bs512_t __attribute__((vector_size(64)));
+
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#define BS_T bs128_t
+#define BS_LANES 2
+#define BS_NAME(x) bs128_##x
+#include "desbsimpl.h"
+#undef BS_T
+#undef BS_LANES
+#undef BS_NAME
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define BS_T bs256_t
+#define BS_LANES 4
+#define BS_NAME(x) bs256_##x
+#include "desbsimpl.h"
+#undef BS_T
+#undef BS_LANES
+#undef BS_NAME
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#define BS_T bs512_t
+#define BS_LANES 8
+#define BS_NAME(x) bs512_##x
+#include "desbsimpl.h"
+#undef BS_T
+#undef BS_LANES
+#undef BS_NAME
+#pragma GCC pop_options
+#endif
+
+/**
+ * Encrypts the specified 64-bit blocks with the specified key schedule. 
+ * The blocks are bitsliced 64, 128, 256 or 512 at a time, depending on 
+ * the active backend. The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out - the cipher text blocks
+ * in  - the blocks to encrypt
+ * n   - the number of blocks
+ * ks  - the key schedule
+ */
+void des_enc_batch(uint64_t *out, const uint64_t *in, size_t n,
+        const des_key_schedule *ks) {
+    BatchKey key = { ks, NULL, false };
+    des_batch(out, in, n, &key);
+}
+
+/**
+ * Decrypts the specified 64-bit blocks with the specified key schedule. 
+ * The blocks are bitsliced 64, 128, 256 or 512 at a time, depending on 
+ * the active backend. The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out - the plain text blocks
+ * in  - the blocks to decrypt
+ * n   - the number of blocks
+ * ks  - the key schedule
+ */
+void des_dec_batch(uint64_t *out, const uint64_t *in, size_t n,
+        const des_key_schedule *ks) {
+    BatchKey key = { ks, NULL, true };
+    des_batch(out, in, n, &key);
+}
+
+/**
+ * Encrypts the specified 64-bit blocks with triple DES. The blocks are 
+ * bitsliced like des_enc_batch(), running all 48 rounds on the planes. 
+ * The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out - the cipher text blocks
+ * in  - the blocks to encrypt
+ * n   - the number of blocks
+ * ks  - the triple DES key schedule
+ */
+void tdes_enc_batch(uint64_t *out, const uint64_t *in, size_t n,
+        const tdes_key_schedule *ks) {
+    BatchKey key = { NULL, ks, false };
+    des_batch(out, in, n, &key);
+}
+
+/**
+ * Decrypts the specified 64-bit blocks with triple DES. The blocks are 
+ * bitsliced like des_dec_batch(), running all 48 rounds on the planes. 
+ * The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out - the plain text blocks
+ * in  - the blocks to decrypt
+ * n   - the number of blocks
+ * ks  - the triple DES key schedule
+ */
+void tdes_dec_batch(uint64_t *out, const uint64_t *in, size_t n,
+        const tdes_key_schedule *ks) {
+    BatchKey key = { NULL, ks, true };
+    des_batch(out, in, n, &key);
+}
+
+/**
+ * Encrypts the specified 64-bit blocks, each under its own key. The keys 
+ * are bitsliced with the blocks, 64, 128, 256 or 512 at a time depending 
+ * on the active backend, so every lane runs its own key schedule with no 
+ * setup cost. The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out  - the cipher text blocks
+ * in   - the blocks to encrypt
+ * keys - the 64-bit key of every block
+ * n    - the number of blocks
+ */
+void des_enc_batch_keys(uint64_t *out, const uint64_t *in,
+        const uint64_t *keys, size_t n) {
+    keyed_batch(out, in, keys, n, false);
+}
+
+/**
+ * Decrypts the specified 64-bit blocks, each under its own key, like 
+ * des_enc_batch_keys(). The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out  - the plain text blocks
+ * in   - the blocks to decrypt
+ * keys - the 64-bit key of every block
+ * n    - the number of blocks
+ */
+void des_dec_batch_keys(uint64_t *out, const uint64_t *in,
+        const uint64_t *keys, size_t n) {
+    keyed_batch(out, in, keys, n, true);
+}
+
+/**
+ * Returns the DES key of the specified key index. The 56 bits of the 
+ * index fill the 7 key bits of every byte, the most significant bits 
+ * first, and every parity bit is set for odd parity. 
+ *
+ * PARAMETERS: 
+ * index - the key index, below 2 ^ 56
+ *
+ * RETURNS: 
+ * The 64-bit key. 
+ */
+uint64_t des_index_key(uint64_t index) {
+    uint64_t key = 0;
+    for (int i = 0; i < 8; i++) {
+        uint64_t b = (index >> (49 - 7 * i)) & 0x7f;
+        b = (b << 1) | !(__builtin_popcountll(b) & 1);  //odd parity
+        key = (key << 8) | b;
+    }
+    return key;
+}
+
+/**
+ * Searches the specified range of key indexes for the keys that encrypt 
+ * the plain text to any of the cipher texts. Every lane of the slices 
+ * holds a different key, so 64, 128, 256 or 512 keys are tried at a time 
+ * depending on the active backend. The last two rounds stop as soon as no 
+ * key can match. 
+ *
+ * PARAMETERS: 
+ * found - the matching keys
+ * max   - the most matching keys to store
+ * first - the first key index to try
+ * n     - the number of key indexes to try
+ * pt    - the plain text
+ * ct    - the cipher texts to look for
+ * nct   - the number of cipher texts, 1 or 2
+ *
+ * RETURNS: 
+ * The number of matching keys stored, 0 if the range goes past 2 ^ 56. 
+ */
+size_t des_search_batch(des_key_match *found, size_t max, uint64_t first,
+        uint64_t n, uint64_t pt, const uint64_t *ct, size_t nct) {
+    if (found == NULL || ct == NULL || nct == 0 || nct > 2 || n == 0)
+        return 0;
+    if (first >= BS_KEY_INDEXES || n > BS_KEY_INDEXES - first)
+        return 0;       //no such key index
+    SearchKey key;
+    search_setup(&key, pt, ct, nct);
+
+#ifdef DES_BS_X86
+    unsigned cpu = des_cpu_enabled();
+    if (cpu & DES_CPU_AVX512F)
+        return bs512_search(found, max, first, n, &key);
+    if (cpu & DES_CPU_AVX2)
+        return bs256_search(found, max, first, n, &key);
+    if (cpu & DES_CPU_SSE2)
+        return bs128_search(found, max, first, n, &key);
+#endif
+    return bs64_search(found, max, first, n, &key);
+}
+
+/**
+ * Encrypts or decrypts the specified blocks. Most blocks go through the 
+ * widest slices of the backend, the rest through 64-bit slices, and a 
+ * short tail is encrypted one block at a time. 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the blocks to encrypt/decrypt
+ * n   - the number of blocks
+ * key - the key of the batch
+ */
+static void des_batch(uint64_t *out, const uint64_t *in, size_t n,
+        const BatchKey *key) {
+    DES_STAT_START(t0);
+    DES_STAT_BLOCKS(n);
+    DES_PROBE3(batch_start, n, (int)des_backend_get(), key->tks != NULL);
+    BatchFunc func = &bs64_crypt;
+    size_t width = 64;
+#ifdef DES_BS_X86
+    unsigned cpu = des_cpu_enabled();
+    if (cpu & DES_CPU_AVX512F) {
+        func = &bs512_crypt;
+        width = 512;
+    } else if (cpu & DES_CPU_AVX2) {
+        func = &bs256_crypt;
+        width = 256;
+    } else if (cpu & DES_CPU_SSE2) {
+        func = &bs128_crypt;
+        width = 128;
+    }
+#endif
+
+    uint64_t kp[3 * 16 * 48];
+    int stages = 1;
+    if (key->tks == NULL) {
+        key_masks(kp, key->ks, key->dec);
+    } else {                //EDE, or DED when decrypting
+        stages = 3;
+        for (int i = 0; i < 3; i++) {
+            int k = (key->dec ? 2 - i : i);
+            key_masks(kp + i * 16 * 48, &key->tks->ks[k], key->dec == (i != 1));
+        }
+    }
+
+    size_t done = n - n % width;
+    if (done > 0)
+        func(out, in, done, kp, stages);
+    size_t rest = (n - done) - (n - done) % 64;
+    if (rest > 0)
+        bs64_crypt(out + done, in + done, rest, kp, stages);
+    done += rest;
+
+    size_t tail = n - done;
+    if (tail >= BS_MIN_TAIL) {
+        uint64_t buf[64] = {0};     //pad the tail to 64 blocks
+        memcpy(buf, in + done, tail * (sizeof *buf));
+        bs64_crypt(buf, buf, 64, kp, stages);
+        memcpy(out + done, buf, tail * (sizeof *buf));
+    } else if (key->tks == NULL) {
+        for (size_t i = done; i < n; i++)
+            out[i] = (key->dec ? des_dec_block(in[i], key->ks) :
+                    des_enc_block(in[i], key->ks));
+    } else {
+        for (size_t i = done; i < n; i++)
+            out[i] = (key->dec ? tdes_dec_block(in[i], key->tks) :
+                    tdes_enc_block(in[i], key->tks));
+    }
+    DES_PROBE2(batch_done, n, (int)des_backend_get());
+    DES_STAT_STOP(DES_STAT_BATCH, t0);
+}
+
+/**
+ * Encrypts or decrypts the specified blocks, each under its own key. Most 
+ * blocks go through the widest slices of the backend, the rest through 
+ * 64-bit slices, and a short tail is encrypted one block at a time. 
+ *
+ * PARAMETERS: 
+ * out  - the result blocks
+ * in   - the blocks to encrypt/decrypt
+ * keys - the 64-bit key of every block
+ * n    - the number of blocks
+ * dec  - whether to decrypt
+ */
+static void keyed_batch(uint64_t *out, const uint64_t *in,
+        const uint64_t *keys, size_t n, _Bool dec) {
+    DES_STAT_START(t0);
+    DES_STAT_BLOCKS(n);
+    DES_PROBE2(batch_keys_start, n, (int)des_backend_get());
+    uint8_t kbit[16][48];
+    key_bits(kbit);
+    size_t done = 0;
+#ifdef DES_BS_X86
+    unsigned cpu = des_cpu_enabled();
+    if (cpu & DES_CPU_AVX512F) {
+        done = n - n % 512;
+        bs512_kcrypt(out, in, keys, done, kbit, dec);
+    } else if (cpu & DES_CPU_AVX2) {
+        done = n - n % 256;
+        bs256_kcrypt(out, in, keys, done, kbit, dec);
+    } else if (cpu & DES_CPU_SSE2) {
+        done = n - n % 128;
+        bs128_kcrypt(out, in, keys, done, kbit, dec);
+    }
+#endif
+    size_t rest = (n - done) - (n - done) % 64;
+    if (rest > 0)
+        bs64_kcrypt(out + done, in + done, keys + done, rest, kbit, dec);
+    done += rest;
+
+    size_t tail = n - done;
+    if (tail >= BS_MIN_TAIL) {
+        uint64_t buf[64] = {0}, kbuf[64] = {0};     //pad the tail to 64
+        memcpy(buf, in + done, tail * (sizeof *buf));
+        memcpy(kbuf, keys + done, tail * (sizeof *kbuf));
+        bs64_kcrypt(buf, buf, kbuf, 64, kbit, dec);
+        memcpy(out + done, buf, tail * (sizeof *buf));
+    } else {
+        for (size_t i = done; i < n; i++) {
+            des_key_schedule ks;
+            des_key_setup(&ks, keys[i]);
+            out[i] = (dec ? des_dec_block(in[i], &ks) :
+                    des_enc_block(in[i], &ks));
+        }
+    }
+    DES_PROBE2(batch_keys_done, n, (int)des_backend_get());
+    DES_STAT_STOP(DES_STAT_BATCH, t0);
+}
+
+/**
+ * Builds the key masks of the specified key schedule. Every subkey bit 
+ * becomes a mask of all 0 or all 1, as all blocks share the same key. 
+ *
+ * PARAMETERS: 
+ * kp  - the 16 * 48 key masks to fill
+ * ks  - the key schedule
+ * dec - whether the masks are used for decryption
+ */
+static void key_masks(uint64_t *kp, const des_key_schedule *ks, _Bool dec) {
+    for (int i = 0; i < 16; i++) {
+        uint64_t k48 = ks->k48[dec ? 15 - i : i];
+        for (int j = 0; j < 48; j++)
+            *kp++ = 0 - ((k48 >> (47 - j)) & 1);
+    }
+}
+
+/**
+ * Finds the key bit of every subkey bit of every round. The subkey bits 
+ * are traced back through PC2, the rotations and PC1 to the key bits, so 
+ * the key schedule of a bitsliced lane is a renaming of the key planes. 
+ *
+ * PARAMETERS: 
+ * kbit - the key bit of every subkey bit, from 0
+ */
+static void key_bits(uint8_t kbit[16][48]) {
+    int shift = 0;
+    for (int i = 0; i < 16; i++) {
+        shift += SHIFTS[i];
+        for (int j = 0; j < 48; j++) {
+            int cd = PC2[j] - 1;            //bit of C then D, from 0
+            int half = cd / 28 * 28;        //rotated within C or D
+            int bit = half + (cd - half + shift) % 28;
+            kbit[i][j] = (uint8_t)(PC1[bit] - 1);
+        }
+    }
+}
+
+/**
+ * Builds the tables of the specified key search. 
+ *
+ * PARAMETERS: 
+ * key - the key search to fill
+ * pt  - the plain text
+ * ct  - the cipher texts to look for
+ * nct - the number of cipher texts, 1 or 2
+ */
+static void search_setup(SearchKey *key, uint64_t pt, const uint64_t *ct,
+        size_t nct) {
+    key_bits(key->kbit);
+    for (int j = 0; j < 64; j++)
+        key->qbit[j] = (j % 8 == 7 ? -1 : 55 - (j / 8 * 7 + j % 8));
+    for (int j = 0; j < 32; j++)
+        key->pinv[P[j] - 1] = (uint8_t)j;
+
+    ip_masks(key->pt, pt);
+    memset(key->ct, 0, sizeof key->ct);
+    for (size_t t = 0; t < nct; t++)
+        ip_masks(key->ct[t], ct[t]);
+    key->nct = nct;
+}
+
+/**
+ * Builds the masks of the specified block after the initial permutation, 
+ * every bit becomes a mask of all 0 or all 1. 
+ *
+ * PARAMETERS: 
+ * m     - the 64 masks to fill
+ * block - the block
+ */
+static void ip_masks(uint64_t m[64], uint64_t block) {
+    for (int i = 0; i < 64; i++)
+        m[i] = 0 - ((block >> (64 - IP[i])) & 1);
+}
+
+/**
+ * Returns the bits t of a 64-bit lane whose key index lo + t is in the 
+ * specified range. 
+ *
+ * PARAMETERS: 
+ * lo    - the key index of bit 0 of the lane
+ * first - the first key index of the range
+ * end   - the key index after the range
+ *
+ * RETURNS: 
+ * The mask of the lane bits in the range. 
+ */
+static uint64_t range_mask(uint64_t lo, uint64_t first, uint64_t end) {
+    if (lo >= end || lo + 64 <= first)
+        return 0;
+    uint64_t m = ~(uint64_t)0;
+    if (first > lo)
+        m &= m << (first - lo);
+    if (end - lo < 64)
+        m &= ((uint64_t)1 << (end - lo)) - 1;
+    return m;
+}
@@ -0,0 +1,146 @@
+/**
+ * FILE:   desbs.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Bitsliced DES, encrypting many blocks under the same key in parallel, 
+ * many blocks each under its own key, or one block under many keys to 
+ * search for a key. 
+ *
+ * C99
+ */
+
+#ifndef __desbs_h__
+#define __desbs_h__
+#include <stdlib.h>
+#include <stdint.h>
+#include "des.h"
+
+/**
+ * Encrypts the specified 64-bit blocks with the specified key schedule. 
+ * The blocks are bitsliced 64, 128, 256 or 512 at a time, depending on 
+ * the active backend. The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out - the cipher text blocks
+ * in  - the blocks to encrypt
+ * n   - the number of blocks
+ * ks  - the key schedule
+ */
+void des_enc_batch(uint64_t *out, const uint64_t *in, size_t n,
+        const des_key_schedule *ks);
+
+/**
+ * Decrypts the specified 64-bit blocks with the specified key schedule. 
+ * The blocks are bitsliced 64, 128, 256 or 512 at a time, depending on 
+ * the active backend. The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out - the plain text blocks
+ * in  - the blocks to decrypt
+ * n   - the number of blocks
+ * ks  - the key schedule
+ */
+void des_dec_batch(uint64_t *out, const uint64_t *in, size_t n,
+        const des_key_schedule *ks);
+
+/**
+ * Encrypts the specified 64-bit blocks with triple DES. The blocks are 
+ * bitsliced like des_enc_batch(), running all 48 rounds on the planes. 
+ * The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out - the cipher text blocks
+ * in  - the blocks to encrypt
+ * n   - the number of blocks
+ * ks  - the triple DES key schedule
+ */
+void tdes_enc_batch(uint64_t *out, const uint64_t *in, size_t n,
+        const tdes_key_schedule *ks);
+
+/**
+ * Decrypts the specified 64-bit blocks with triple DES. The blocks are 
+ * bitsliced like des_dec_batch(), running all 48 rounds on the planes. 
+ * The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out - the plain text blocks
+ * in  - the blocks to decrypt
+ * n   - the number of blocks
+ * ks  - the triple DES key schedule
+ */
+void tdes_dec_batch(uint64_t *out, const uint64_t *in, size_t n,
+        const tdes_key_schedule *ks);
+
+/**
+ * Encrypts the specified 64-bit blocks, each under its own key. The keys 
+ * are bitsliced with the blocks, 64, 128, 256 or 512 at a time depending 
+ * on the active backend, so every lane runs its own key schedule with no 
+ * setup cost. The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out  - the cipher text blocks
+ * in   - the blocks to encrypt
+ * keys - the 64-bit key of every block
+ * n    - the number of blocks
+ */
+void des_enc_batch_keys(uint64_t *out, const uint64_t *in,
+        const uint64_t *keys, size_t n);
+
+/**
+ * Decrypts the specified 64-bit blocks, each under its own key, like 
+ * des_enc_batch_keys(). The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out  - the plain text blocks
+ * in   - the blocks to decrypt
+ * keys - the 64-bit key of every block
+ * n    - the number of blocks
+ */
+void des_dec_batch_keys(uint64_t *out, const uint64_t *in,
+        const uint64_t *keys, size_t n);
+
+/**
+ * A key found by des_search_batch(). 
+ */
+typedef struct des_key_match {
+    uint64_t index;         //key index, see des_index_key()
+    int target;             //the cipher text the key produced
+} des_key_match;
+
+/**
+ * Returns the DES key of the specified key index. The 56 bits of the 
+ * index fill the 7 key bits of every byte, the most significant bits 
+ * first, and every parity bit is set for odd parity. 
+ *
+ * PARAMETERS: 
+ * index - the key index, below 2 ^ 56
+ *
+ * RETURNS: 
+ * The 64-bit key. 
+ */
+uint64_t des_index_key(uint64_t index);
+
+/**
+ * Searches the specified range of key indexes for the keys that encrypt 
+ * the plain text to any of the cipher texts. Every lane of the slices 
+ * holds a different key, so 64, 128, 256 or 512 keys are tried at a time 
+ * depending on the active backend. The last two rounds stop as soon as no 
+ * key can match. 
+ *
+ * PARAMETERS: 
+ * found - the matching keys
+ * max   - the most matching keys to store
+ * first - the first key index to try
+ * n     - the number of key indexes to try
+ * pt    - the plain text
+ * ct    - the cipher texts to look for
+ * nct   - the number of cipher texts, 1 or 2
+ *
+ * RETURNS: 
+ * The number of matching keys stored, 0 if the range goes past 2 ^ 56. 
+ */
+size_t des_search_batch(des_key_match *found, size_t max, uint64_t first,
+        uint64_t n, uint64_t pt, const uint64_t *ct, size_t nct);
+
+#endif
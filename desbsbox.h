@@ -0,0 +1,568 @@
+/**
+ * FILE:   desbsbox.h
+ * AUTHOR: PotatoMaster101
+ * 
+ * Bitsliced s-box circuits for the DES cipher. Generated by tabgen.c, do 
+ * not edit. Included by desbsimpl.h with BS_T and BS_NAME() defined. 
+ *
+ * C99
+ */
+
+/**
+ * Bitsliced s-box 1, 64 gates. Input a[0] is the first bit of the 
+ * 6-bit chunk, output o[0] is the first bit of the 4-bit result. 
+ */
+static inline void BS_NAME(sbox1)(const BS_T a[6], BS_T o[4]) {
+    BS_T t0 = ~a[1];
+    BS_T t1 = a[5] ^ a[4];
+    BS_T t2 = a[1] | t1;
+    BS_T t3 = t2 & ~a[2];
+    BS_T t4 = t0 ^ t3;
+    BS_T t5 = t0 & ~a[2];
+    BS_T t6 = a[5] | t5;
+    BS_T t7 = a[4] & t2;
+    BS_T t8 = t6 ^ t7;
+    BS_T t9 = a[3] & t8;
+    BS_T t10 = t4 ^ t9;
+    BS_T t11 = t10 & ~a[5];
+    BS_T t12 = a[3] & t11;
+    BS_T t13 = t8 ^ t12;
+    BS_T t14 = t2 & ~a[3];
+    BS_T t15 = a[5] ^ t14;
+    BS_T t16 = t15 & ~a[4];
+    BS_T t17 = t11 ^ t16;
+    BS_T t18 = a[2] & t17;
+    BS_T t19 = t13 ^ t18;
+    BS_T t20 = a[0] & t19;
+    BS_T t21 = t10 ^ t20;
+    BS_T t22 = t17 | t9;
+    BS_T t23 = a[1] & t22;
+    BS_T t24 = t14 ^ t23;
+    BS_T t25 = t19 | t2;
+    BS_T t26 = a[2] & t25;
+    BS_T t27 = t24 ^ t26;
+    BS_T t28 = t24 & ~t11;
+    BS_T t29 = a[3] | t28;
+    BS_T t30 = a[5] & ~t3;
+    BS_T t31 = t18 & ~a[3];
+    BS_T t32 = t30 ^ t31;
+    BS_T t33 = t32 & ~a[1];
+    BS_T t34 = t29 ^ t33;
+    BS_T t35 = t34 & ~a[0];
+    BS_T t36 = t27 ^ t35;
+    BS_T t37 = t5 ^ t1;
+    BS_T t38 = t37 ^ a[1];
+    BS_T t39 = a[5] & t38;
+    BS_T t40 = t18 ^ t39;
+    BS_T t41 = a[3] & t40;
+    BS_T t42 = t37 ^ t41;
+    BS_T t43 = t24 & ~a[2];
+    BS_T t44 = t17 | t7;
+    BS_T t45 = t9 ^ a[5];
+    BS_T t46 = a[2] & t45;
+    BS_T t47 = t44 ^ t46;
+    BS_T t48 = t47 & ~a[1];
+    BS_T t49 = t43 ^ t48;
+    BS_T t50 = a[0] & t49;
+    BS_T t51 = t42 ^ t50;
+    BS_T t52 = t49 ^ a[3];
+    BS_T t53 = t27 | t15;
+    BS_T t54 = t53 & ~a[0];
+    BS_T t55 = t52 ^ t54;
+    BS_T t56 = t37 & ~t35;
+    BS_T t57 = t11 ^ a[1];
+    BS_T t58 = a[0] & t46;
+    BS_T t59 = t57 ^ t58;
+    BS_T t60 = t59 & ~a[3];
+    BS_T t61 = t56 ^ t60;
+    BS_T t62 = a[4] & t61;
+    BS_T t63 = t55 ^ t62;
+    o[0] = t51;
+    o[1] = t63;
+    o[2] = t21;
+    o[3] = t36;
+}
+
+/**
+ * Bitsliced s-box 2, 58 gates. Input a[0] is the first bit of the 
+ * 6-bit chunk, output o[0] is the first bit of the 4-bit result. 
+ */
+static inline void BS_NAME(sbox2)(const BS_T a[6], BS_T o[4]) {
+    BS_T t0 = a[5] | a[1];
+    BS_T t1 = t0 & ~a[4];
+    BS_T t2 = ~t1;
+    BS_T t3 = a[1] & a[5];
+    BS_T t4 = t2 ^ t3;
+    BS_T t5 = t4 & ~a[0];
+    BS_T t6 = t1 ^ t5;
+    BS_T t7 = t2 ^ a[1];
+    BS_T t8 = a[5] & t6;
+    BS_T t9 = t7 ^ t8;
+    BS_T t10 = a[3] & t9;
+    BS_T t11 = t6 ^ t10;
+    BS_T t12 = t7 & ~a[5];
+    BS_T t13 = a[4] ^ t12;
+    BS_T t14 = t7 & ~a[4];
+    BS_T t15 = a[0] & t14;
+    BS_T t16 = t13 ^ t15;
+    BS_T t17 = a[2] & t16;
+    BS_T t18 = t11 ^ t17;
+    BS_T t19 = t4 ^ a[0];
+    BS_T t20 = a[4] & t12;
+    BS_T t21 = t19 ^ t20;
+    BS_T t22 = t6 | a[5];
+    BS_T t23 = a[1] & t22;
+    BS_T t24 = a[5] ^ t23;
+    BS_T t25 = a[2] & t24;
+    BS_T t26 = t21 ^ t25;
+    BS_T t27 = a[3] & ~t23;
+    BS_T t28 = t18 | t14;
+    BS_T t29 = a[5] & t28;
+    BS_T t30 = t27 ^ t29;
+    BS_T t31 = a[3] & t30;
+    BS_T t32 = t26 ^ t31;
+    BS_T t33 = t19 ^ a[2];
+    BS_T t34 = t9 ^ a[3];
+    BS_T t35 = a[0] & t30;
+    BS_T t36 = t34 ^ t35;
+    BS_T t37 = a[4] & t36;
+    BS_T t38 = t33 ^ t37;
+    BS_T t39 = t26 & ~t15;
+    BS_T t40 = t22 ^ a[4];
+    BS_T t41 = t40 & ~a[3];
+    BS_T t42 = t39 ^ t41;
+    BS_T t43 = a[1] & t42;
+    BS_T t44 = t38 ^ t43;
+    BS_T t45 = t38 | t8;
+    BS_T t46 = t29 & ~a[3];
+    BS_T t47 = t45 ^ t46;
+    BS_T t48 = t17 | t8;
+    BS_T t49 = a[3] | t48;
+    BS_T t50 = t49 & ~a[4];
+    BS_T t51 = t47 ^ t50;
+    BS_T t52 = a[5] & ~t19;
+    BS_T t53 = t31 ^ t11;
+    BS_T t54 = t53 & ~a[2];
+    BS_T t55 = t52 ^ t54;
+    BS_T t56 = a[0] & t55;
+    BS_T t57 = t51 ^ t56;
+    o[0] = t44;
+    o[1] = t32;
+    o[2] = t57;
+    o[3] = t18;
+}
+
+/**
+ * Bitsliced s-box 3, 58 gates. Input a[0] is the first bit of the 
+ * 6-bit chunk, output o[0] is the first bit of the 4-bit result. 
+ */
+static inline void BS_NAME(sbox3)(const BS_T a[6], BS_T o[4]) {
+    BS_T t0 = a[5] ^ a[2];
+    BS_T t1 = a[5] | a[3];
+    BS_T t2 = a[0] & t1;
+    BS_T t3 = t0 ^ t2;
+    BS_T t4 = a[3] ^ a[2];
+    BS_T t5 = a[0] | t4;
+    BS_T t6 = t5 & ~a[4];
+    BS_T t7 = t3 ^ t6;
+    BS_T t8 = t7 & ~t0;
+    BS_T t9 = a[3] & t3;
+    BS_T t10 = t8 ^ t9;
+    BS_T t11 = a[0] & t10;
+    BS_T t12 = a[1] ^ t11;
+    BS_T t13 = a[1] & t12;
+    BS_T t14 = t7 ^ t13;
+    BS_T t15 = ~t7;
+    BS_T t16 = t15 & ~a[0];
+    BS_T t17 = a[4] ^ t16;
+    BS_T t18 = a[4] | a[2];
+    BS_T t19 = a[3] & t18;
+    BS_T t20 = t17 ^ t19;
+    BS_T t21 = t15 & ~a[4];
+    BS_T t22 = t8 ^ t21;
+    BS_T t23 = a[5] & t22;
+    BS_T t24 = t20 ^ t23;
+    BS_T t25 = t21 ^ a[5];
+    BS_T t26 = a[0] & ~a[3];
+    BS_T t27 = t25 ^ t26;
+    BS_T t28 = a[1] & ~t1;
+    BS_T t29 = a[0] & t15;
+    BS_T t30 = t28 ^ t29;
+    BS_T t31 = a[2] & t30;
+    BS_T t32 = t27 ^ t31;
+    BS_T t33 = a[1] & t32;
+    BS_T t34 = t24 ^ t33;
+    BS_T t35 = t27 ^ a[1];
+    BS_T t36 = t15 ^ t12;
+    BS_T t37 = a[5] & t36;
+    BS_T t38 = a[3] & t37;
+    BS_T t39 = t35 ^ t38;
+    BS_T t40 = t10 & a[2];
+    BS_T t41 = t21 | t19;
+    BS_T t42 = t41 & ~a[2];
+    BS_T t43 = t42 & ~a[1];
+    BS_T t44 = t40 ^ t43;
+    BS_T t45 = t44 & ~a[0];
+    BS_T t46 = t39 ^ t45;
+    BS_T t47 = t30 ^ a[3];
+    BS_T t48 = t36 & ~a[5];
+    BS_T t49 = a[2] ^ t48;
+    BS_T t50 = t49 & ~a[1];
+    BS_T t51 = t47 ^ t50;
+    BS_T t52 = t0 & ~a[1];
+    BS_T t53 = t49 ^ t52;
+    BS_T t54 = t53 & ~a[3];
+    BS_T t55 = t20 ^ t54;
+    BS_T t56 = t55 & ~a[0];
+    BS_T t57 = t51 ^ t56;
+    o[0] = t57;
+    o[1] = t46;
+    o[2] = t34;
+    o[3] = t14;
+}
+
+/**
+ * Bitsliced s-box 4, 50 gates. Input a[0] is the first bit of the 
+ * 6-bit chunk, output o[0] is the first bit of the 4-bit result. 
+ */
+static inline void BS_NAME(sbox4)(const BS_T a[6], BS_T o[4]) {
+    BS_T t0 = a[4] ^ a[3];
+    BS_T t1 = a[4] & ~a[3];
+    BS_T t2 = a[2] ^ t1;
+    BS_T t3 = t2 & ~a[1];
+    BS_T t4 = t0 ^ t3;
+    BS_T t5 = a[2] & ~a[4];
+    BS_T t6 = ~t5;
+    BS_T t7 = a[1] & ~t2;
+    BS_T t8 = t7 & ~a[3];
+    BS_T t9 = t6 ^ t8;
+    BS_T t10 = a[0] & t9;
+    BS_T t11 = t4 ^ t10;
+    BS_T t12 = t0 | a[2];
+    BS_T t13 = t9 | a[0];
+    BS_T t14 = t13 & ~a[3];
+    BS_T t15 = t12 ^ t14;
+    BS_T t16 = t15 ^ t4;
+    BS_T t17 = a[0] & t16;
+    BS_T t18 = a[3] ^ t17;
+    BS_T t19 = t18 & ~a[1];
+    BS_T t20 = t15 ^ t19;
+    BS_T t21 = t20 & ~a[5];
+    BS_T t22 = t11 ^ t21;
+    BS_T t23 = t13 ^ t0;
+    BS_T t24 = t6 & ~t22;
+    BS_T t25 = a[3] & t24;
+    BS_T t26 = t5 ^ t25;
+    BS_T t27 = t26 & ~a[5];
+    BS_T t28 = t23 ^ t27;
+    BS_T t29 = t6 & ~a[0];
+    BS_T t30 = a[2] ^ t29;
+    BS_T t31 = t15 | a[0];
+    BS_T t32 = t31 & ~a[2];
+    BS_T t33 = t4 ^ t32;
+    BS_T t34 = a[5] & t33;
+    BS_T t35 = t30 ^ t34;
+    BS_T t36 = t35 & ~a[1];
+    BS_T t37 = t28 ^ t36;
+    BS_T t38 = ~t11;
+    BS_T t39 = a[5] & ~t20;
+    BS_T t40 = a[5] & t39;
+    BS_T t41 = t38 ^ t40;
+    BS_T t42 = a[5] & t6;
+    BS_T t43 = t23 ^ t42;
+    BS_T t44 = t35 ^ t33;
+    BS_T t45 = t44 & ~a[1];
+    BS_T t46 = t43 ^ t45;
+    BS_T t47 = t42 & ~t41;
+    BS_T t48 = a[3] & t47;
+    BS_T t49 = t46 ^ t48;
+    o[0] = t37;
+    o[1] = t49;
+    o[2] = t22;
+    o[3] = t41;
+}
+
+/**
+ * Bitsliced s-box 5, 63 gates. Input a[0] is the first bit of the 
+ * 6-bit chunk, output o[0] is the first bit of the 4-bit result. 
+ */
+static inline void BS_NAME(sbox5)(const BS_T a[6], BS_T o[4]) {
+    BS_T t0 = a[4] ^ a[0];
+    BS_T t1 = t0 | a[2];
+    BS_T t2 = t1 & ~a[5];
+    BS_T t3 = t0 ^ t2;
+    BS_T t4 = a[5] | a[4];
+    BS_T t5 = a[2] & t4;
+    BS_T t6 = a[4] ^ t5;
+    BS_T t7 = a[0] | t6;
+    BS_T t8 = a[3] & t7;
+    BS_T t9 = t3 ^ t8;
+    BS_T t10 = a[5] | a[3];
+    BS_T t11 = t10 & ~a[4];
+    BS_T t12 = a[0] & ~t9;
+    BS_T t13 = t12 & ~a[2];
+    BS_T t14 = t11 ^ t13;
+    BS_T t15 = t6 ^ a[3];
+    BS_T t16 = a[4] & t15;
+    BS_T t17 = t16 & ~a[0];
+    BS_T t18 = t14 ^ t17;
+    BS_T t19 = a[1] & t18;
+    BS_T t20 = t9 ^ t19;
+    BS_T t21 = t18 ^ t12;
+    BS_T t22 = a[2] & t21;
+    BS_T t23 = t14 ^ t22;
+    BS_T t24 = t23 | t3;
+    BS_T t25 = t24 & ~a[0];
+    BS_T t26 = t6 ^ t25;
+    BS_T t27 = t26 & ~a[5];
+    BS_T t28 = t23 ^ t27;
+    BS_T t29 = a[5] ^ a[0];
+    BS_T t30 = t24 & ~a[2];
+    BS_T t31 = t29 ^ t30;
+    BS_T t32 = a[3] | t31;
+    BS_T t33 = t32 & ~a[1];
+    BS_T t34 = t28 ^ t33;
+    BS_T t35 = t31 ^ a[1];
+    BS_T t36 = t20 & a[2];
+    BS_T t37 = a[3] & t36;
+    BS_T t38 = t35 ^ t37;
+    BS_T t39 = t34 & ~t9;
+    BS_T t40 = a[4] & t39;
+    BS_T t41 = t38 ^ t40;
+    BS_T t42 = a[5] & t15;
+    BS_T t43 = a[2] ^ t42;
+    BS_T t44 = t39 | t28;
+    BS_T t45 = t44 & ~a[4];
+    BS_T t46 = t43 ^ t45;
+    BS_T t47 = t46 & ~a[0];
+    BS_T t48 = t41 ^ t47;
+    BS_T t49 = t43 ^ t1;
+    BS_T t50 = t48 ^ t1;
+    BS_T t51 = a[4] | t50;
+    BS_T t52 = t51 & ~a[1];
+    BS_T t53 = t49 ^ t52;
+    BS_T t54 = ~t14;
+    BS_T t55 = t54 & ~a[4];
+    BS_T t56 = t3 ^ t55;
+    BS_T t57 = t54 ^ a[3];
+    BS_T t58 = t57 & ~a[2];
+    BS_T t59 = a[1] & t58;
+    BS_T t60 = t56 ^ t59;
+    BS_T t61 = t60 & ~a[5];
+    BS_T t62 = t53 ^ t61;
+    o[0] = t48;
+    o[1] = t34;
+    o[2] = t62;
+    o[3] = t20;
+}
+
+/**
+ * Bitsliced s-box 6, 61 gates. Input a[0] is the first bit of the 
+ * 6-bit chunk, output o[0] is the first bit of the 4-bit result. 
+ */
+static inline void BS_NAME(sbox6)(const BS_T a[6], BS_T o[4]) {
+    BS_T t0 = a[3] ^ a[0];
+    BS_T t1 = a[1] & ~a[2];
+    BS_T t2 = t0 ^ t1;
+    BS_T t3 = ~t0;
+    BS_T t4 = a[2] | t3;
+    BS_T t5 = t4 & ~a[4];
+    BS_T t6 = t2 ^ t5;
+    BS_T t7 = t6 ^ a[2];
+    BS_T t8 = a[1] & t0;
+    BS_T t9 = t7 ^ t8;
+    BS_T t10 = a[4] | t9;
+    BS_T t11 = t3 & ~a[4];
+    BS_T t12 = t2 & ~t7;
+    BS_T t13 = a[1] & t12;
+    BS_T t14 = t11 ^ t13;
+    BS_T t15 = t14 & ~a[0];
+    BS_T t16 = t10 ^ t15;
+    BS_T t17 = a[5] & t16;
+    BS_T t18 = t6 ^ t17;
+    BS_T t19 = a[2] | a[0];
+    BS_T t20 = a[1] & t19;
+    BS_T t21 = t3 ^ t20;
+    BS_T t22 = a[0] & t18;
+    BS_T t23 = t9 ^ t22;
+    BS_T t24 = a[4] & t23;
+    BS_T t25 = t21 ^ t24;
+    BS_T t26 = t23 ^ a[4];
+    BS_T t27 = a[1] & t25;
+    BS_T t28 = t26 ^ t27;
+    BS_T t29 = t15 | a[4];
+    BS_T t30 = a[2] & t29;
+    BS_T t31 = t28 ^ t30;
+    BS_T t32 = t31 & ~a[5];
+    BS_T t33 = t25 ^ t32;
+    BS_T t34 = t21 ^ t19;
+    BS_T t35 = t4 ^ a[0];
+    BS_T t36 = a[3] & t18;
+    BS_T t37 = t35 ^ t36;
+    BS_T t38 = t37 & ~a[4];
+    BS_T t39 = t34 ^ t38;
+    BS_T t40 = t34 | t31;
+    BS_T t41 = a[4] & a[3];
+    BS_T t42 = t4 ^ t41;
+    BS_T t43 = t42 & ~a[0];
+    BS_T t44 = t40 ^ t43;
+    BS_T t45 = t44 & ~a[5];
+    BS_T t46 = t39 ^ t45;
+    BS_T t47 = t2 ^ a[4];
+    BS_T t48 = a[2] & t39;
+    BS_T t49 = t47 ^ t48;
+    BS_T t50 = t35 | t25;
+    BS_T t51 = t50 & ~a[5];
+    BS_T t52 = t49 ^ t51;
+    BS_T t53 = t49 ^ t12;
+    BS_T t54 = t49 | t1;
+    BS_T t55 = a[4] & a[2];
+    BS_T t56 = t54 ^ t55;
+    BS_T t57 = a[5] & t56;
+    BS_T t58 = t53 ^ t57;
+    BS_T t59 = a[3] & t58;
+    BS_T t60 = t52 ^ t59;
+    o[0] = t18;
+    o[1] = t60;
+    o[2] = t33;
+    o[3] = t46;
+}
+
+/**
+ * Bitsliced s-box 7, 57 gates. Input a[0] is the first bit of the 
+ * 6-bit chunk, output o[0] is the first bit of the 4-bit result. 
+ */
+static inline void BS_NAME(sbox7)(const BS_T a[6], BS_T o[4]) {
+    BS_T t0 = a[3] ^ a[1];
+    BS_T t1 = a[2] & ~a[5];
+    BS_T t2 = t0 ^ t1;
+    BS_T t3 = a[5] | a[3];
+    BS_T t4 = a[3] ^ a[2];
+    BS_T t5 = t4 & ~a[1];
+    BS_T t6 = t3 ^ t5;
+    BS_T t7 = a[4] & t6;
+    BS_T t8 = t2 ^ t7;
+    BS_T t9 = t6 | a[4];
+    BS_T t10 = a[1] & ~a[2];
+    BS_T t11 = t9 ^ t10;
+    BS_T t12 = t10 | t7;
+    BS_T t13 = a[3] & t12;
+    BS_T t14 = t5 ^ t13;
+    BS_T t15 = t14 & ~a[5];
+    BS_T t16 = t11 ^ t15;
+    BS_T t17 = t16 & ~a[0];
+    BS_T t18 = t8 ^ t17;
+    BS_T t19 = t12 ^ a[0];
+    BS_T t20 = t11 ^ a[1];
+    BS_T t21 = t20 & ~a[3];
+    BS_T t22 = t19 ^ t21;
+    BS_T t23 = t18 & ~a[0];
+    BS_T t24 = t19 ^ t23;
+    BS_T t25 = a[1] & t24;
+    BS_T t26 = t18 ^ a[0];
+    BS_T t27 = t26 & ~a[4];
+    BS_T t28 = t20 ^ t27;
+    BS_T t29 = a[3] & t28;
+    BS_T t30 = t25 ^ t29;
+    BS_T t31 = a[5] & t30;
+    BS_T t32 = t22 ^ t31;
+    BS_T t33 = t16 ^ t8;
+    BS_T t34 = t0 | a[2];
+    BS_T t35 = a[5] & t34;
+    BS_T t36 = a[1] & t35;
+    BS_T t37 = t33 ^ t36;
+    BS_T t38 = ~t6;
+    BS_T t39 = a[1] & t2;
+    BS_T t40 = t38 ^ t39;
+    BS_T t41 = t32 ^ t0;
+    BS_T t42 = a[3] & t41;
+    BS_T t43 = t40 ^ t42;
+    BS_T t44 = t43 & ~a[0];
+    BS_T t45 = t37 ^ t44;
+    BS_T t46 = t23 ^ t16;
+    BS_T t47 = t30 & ~t43;
+    BS_T t48 = a[2] & t47;
+    BS_T t49 = t46 ^ t48;
+    BS_T t50 = t19 | t13;
+    BS_T t51 = a[2] & t24;
+    BS_T t52 = t22 ^ t51;
+    BS_T t53 = t52 & ~a[5];
+    BS_T t54 = t50 ^ t53;
+    BS_T t55 = a[4] & t54;
+    BS_T t56 = t49 ^ t55;
+    o[0] = t18;
+    o[1] = t45;
+    o[2] = t56;
+    o[3] = t32;
+}
+
+/**
+ * Bitsliced s-box 8, 60 gates. Input a[0] is the first bit of the 
+ * 6-bit chunk, output o[0] is the first bit of the 4-bit result. 
+ */
+static inline void BS_NAME(sbox8)(const BS_T a[6], BS_T o[4]) {
+    BS_T t0 = ~a[3];
+    BS_T t1 = a[0] | t0;
+    BS_T t2 = t1 & ~a[1];
+    BS_T t3 = t1 ^ a[3];
+    BS_T t4 = a[5] & t3;
+    BS_T t5 = t2 ^ t4;
+    BS_T t6 = t0 | a[5];
+    BS_T t7 = a[0] & t6;
+    BS_T t8 = a[1] | t7;
+    BS_T t9 = a[2] & t8;
+    BS_T t10 = t5 ^ t9;
+    BS_T t11 = a[0] & ~a[5];
+    BS_T t12 = a[2] | t11;
+    BS_T t13 = t2 | a[3];
+    BS_T t14 = t13 & ~a[0];
+    BS_T t15 = t12 ^ t14;
+    BS_T t16 = a[4] & t15;
+    BS_T t17 = t10 ^ t16;
+    BS_T t18 = t7 ^ a[2];
+    BS_T t19 = a[1] & ~a[5];
+    BS_T t20 = a[3] | t19;
+    BS_T t21 = a[2] | t20;
+    BS_T t22 = a[1] & t21;
+    BS_T t23 = t18 ^ t22;
+    BS_T t24 = t20 ^ t15;
+    BS_T t25 = a[5] | a[1];
+    BS_T t26 = a[2] & t25;
+    BS_T t27 = t8 ^ t26;
+    BS_T t28 = a[0] & t27;
+    BS_T t29 = t24 ^ t28;
+    BS_T t30 = a[4] & t29;
+    BS_T t31 = t23 ^ t30;
+    BS_T t32 = t19 ^ t3;
+    BS_T t33 = a[4] & t25;
+    BS_T t34 = t32 ^ t33;
+    BS_T t35 = a[5] | a[4];
+    BS_T t36 = t35 & ~a[0];
+    BS_T t37 = t17 ^ t36;
+    BS_T t38 = t37 & ~a[3];
+    BS_T t39 = t34 ^ t38;
+    BS_T t40 = t35 & ~t11;
+    BS_T t41 = a[3] | t40;
+    BS_T t42 = a[0] & t16;
+    BS_T t43 = t5 ^ t42;
+    BS_T t44 = t43 & ~a[1];
+    BS_T t45 = t41 ^ t44;
+    BS_T t46 = t45 & ~a[2];
+    BS_T t47 = t39 ^ t46;
+    BS_T t48 = t25 & t15;
+    BS_T t49 = t23 & ~t9;
+    BS_T t50 = a[0] & t49;
+    BS_T t51 = t45 ^ t50;
+    BS_T t52 = t51 & ~a[4];
+    BS_T t53 = t48 ^ t52;
+    BS_T t54 = t23 & t17;
+    BS_T t55 = t8 & ~t52;
+    BS_T t56 = t55 & ~a[5];
+    BS_T t57 = t54 ^ t56;
+    BS_T t58 = t57 & ~a[3];
+    BS_T t59 = t53 ^ t58;
+    o[0] = t59;
+    o[1] = t17;
+    o[2] = t31;
+    o[3] = t47;
+}
@@ -0,0 +1,429 @@
+/**
+ * FILE:   desbsimpl.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * The bitsliced DES core. This header has no include guard, desbs.c 
+ * includes it once for every slice width with the following defined: 
+ * BS_T      - the slice type, made of BS_LANES 64-bit lanes 
+ * BS_LANES  - the number of 64-bit lanes in BS_T 
+ * BS_NAME() - adds the slice width to a function name 
+ *
+ * C99
+ */
+
+#include "desbsbox.h"
+
+/**
+ * Reads the 6 s-box inputs of the specified s-box, the expansion of the 
+ * right half XORed with the subkey. 
+ *
+ * PARAMETERS: 
+ * a    - the 6 s-box inputs to fill
+ * r    - the 32 planes of the right half
+ * kp   - the 48 subkey masks of the round
+ * sbox - the s-box, from 0 to 7
+ */
+static inline void BS_NAME(expand)(BS_T a[6], const BS_T *r,
+        const uint64_t *kp, int sbox) {
+    for (int i = 0; i < 6; i++)
+        a[i] = r[EXP[6 * sbox + i] - 1] ^ kp[6 * sbox + i];
+}
+
+/**
+ * Encrypts or decrypts 64 * BS_LANES blocks in bitsliced form. Plane j of 
+ * x holds bit j + 1 of every block. The key masks hold the 48 subkey bits 
+ * of every round as all 0 or all 1, in the order the rounds are run, so 
+ * decryption only needs the masks in reverse round order. Triple DES runs 
+ * 3 stages, the IP_INV and IP between the stages cancel out. The 
+ * permutations are plain renaming of the planes. 
+ *
+ * PARAMETERS: 
+ * x      - the 64 block planes, replaced by the result
+ * kp     - the 16 * 48 key masks of every stage
+ * stages - the number of DES stages, 1 or 3
+ */
+static void BS_NAME(des)(BS_T x[64], const uint64_t *kp, int stages) {
+    BS_T lr[2][32];
+    BS_T *l = lr[0], *r = lr[1];
+    for (int i = 0; i < 32; i++) {      //initial permutation
+        l[i] = x[IP[i] - 1];
+        r[i] = x[IP[i + 32] - 1];
+    }
+
+    for (int i = 0; i < 16 * stages; i++, kp += 48) {
+        BS_T a[6], pre[32];
+        if (i > 0 && i % 16 == 0) {
+            BS_T *temp = l;     //no swap after the last round of a stage
+            l = r;
+            r = temp;
+        }
+
+        BS_NAME(expand)(a, r, kp, 0);
+        BS_NAME(sbox1)(a, pre);
+        BS_NAME(expand)(a, r, kp, 1);
+        BS_NAME(sbox2)(a, pre + 4);
+        BS_NAME(expand)(a, r, kp, 2);
+        BS_NAME(sbox3)(a, pre + 8);
+        BS_NAME(expand)(a, r, kp, 3);
+        BS_NAME(sbox4)(a, pre + 12);
+        BS_NAME(expand)(a, r, kp, 4);
+        BS_NAME(sbox5)(a, pre + 16);
+        BS_NAME(expand)(a, r, kp, 5);
+        BS_NAME(sbox6)(a, pre + 20);
+        BS_NAME(expand)(a, r, kp, 6);
+        BS_NAME(sbox7)(a, pre + 24);
+        BS_NAME(expand)(a, r, kp, 7);
+        BS_NAME(sbox8)(a, pre + 28);
+        for (int j = 0; j < 32; j++)
+            l[j] ^= pre[P[j] - 1];
+
+        BS_T *temp = l;     //swap left and right
+        l = r;
+        r = temp;
+    }
+
+    for (int i = 0; i < 64; i++) {      //inverse of initial permutation
+        int j = IP_INV[i] - 1;          //pre-output is right then left
+        x[i] = (j < 32 ? r[j] : l[j - 32]);
+    }
+}
+
+/**
+ * Transposes the 64 * 64 bit matrix in every lane of the specified slices 
+ * in place, all lanes at once. Row i of a lane is the lane of a[i], column 
+ * j is bit 63 - j, so bit j + 1 of every block ends up in a[j]. 
+ *
+ * PARAMETERS: 
+ * a - the matrices to transpose
+ */
+static inline void BS_NAME(transpose)(BS_T a[64]) {
+    uint64_t m = 0x00000000ffffffffULL;
+    for (int j = 32; j != 0; j >>= 1, m ^= m << j) {
+        for (int k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+            BS_T t = (a[k] ^ (a[k | j] >> j)) & m;
+            a[k] ^= t;
+            a[k | j] ^= t << j;
+        }
+    }
+}
+
+/**
+ * Loads 64 * BS_LANES blocks into bitsliced planes. Lane l of the planes 
+ * holds the blocks from 64 * l to 64 * l + 63. 
+ *
+ * PARAMETERS: 
+ * x  - the 64 planes to fill
+ * in - the blocks to load
+ */
+static void BS_NAME(load)(BS_T x[64], const uint64_t *in) {
+    uint64_t planes[64][BS_LANES];
+    for (int l = 0; l < BS_LANES; l++)
+        for (int j = 0; j < 64; j++)
+            planes[j][l] = in[64 * l + j];
+    memcpy(x, planes, sizeof planes);
+    BS_NAME(transpose)(x);
+}
+
+/**
+ * Stores bitsliced planes back into 64 * BS_LANES blocks. 
+ *
+ * PARAMETERS: 
+ * out - the blocks to store
+ * x   - the 64 planes to store
+ */
+static void BS_NAME(store)(uint64_t *out, const BS_T x[64]) {
+    uint64_t planes[64][BS_LANES];
+    BS_T t[64];
+    memcpy(t, x, sizeof t);
+    BS_NAME(transpose)(t);
+    memcpy(planes, t, sizeof planes);
+    for (int l = 0; l < BS_LANES; l++)
+        for (int j = 0; j < 64; j++)
+            out[64 * l + j] = planes[j][l];
+}
+
+/**
+ * Encrypts or decrypts the specified blocks. The number of blocks must be 
+ * a multiple of 64 * BS_LANES. The output may be the same as the input. 
+ *
+ * PARAMETERS: 
+ * out    - the result blocks
+ * in     - the blocks to encrypt/decrypt
+ * n      - the number of blocks
+ * kp     - the 16 * 48 key masks of every stage
+ * stages - the number of DES stages, 1 or 3
+ */
+static void BS_NAME(crypt)(uint64_t *out, const uint64_t *in, size_t n,
+        const uint64_t *kp, int stages) {
+    for (size_t i = 0; i < n; i += 64 * BS_LANES) {
+        BS_T x[64];
+        BS_NAME(load)(x, in + i);
+        BS_NAME(des)(x, kp, stages);
+        BS_NAME(store)(out + i, x);
+    }
+}
+
+/**
+ * Returns whether any bit of the specified slice is set. 
+ *
+ * PARAMETERS: 
+ * v - the slice
+ *
+ * RETURNS: 
+ * 1 (true) if any bit is set, 0 (false) otherwise. 
+ */
+static inline _Bool BS_NAME(any)(BS_T v) {
+    uint64_t t[BS_LANES];
+    memcpy(t, &v, sizeof t);
+    uint64_t any = 0;
+    for (int l = 0; l < BS_LANES; l++)
+        any |= t[l];
+    return any != 0;
+}
+
+/**
+ * Runs the specified s-box of a round where every lane has its own key. 
+ * Key plane j holds bit j + 1 of the key of every lane. 
+ *
+ * PARAMETERS: 
+ * o    - the 4 s-box outputs
+ * r    - the 32 planes of the right half
+ * k    - the 64 key planes
+ * kbit - the key plane of every subkey bit of the round
+ * sbox - the s-box, from 0 to 7
+ */
+static inline void BS_NAME(ksbox)(BS_T o[4], const BS_T *r, const BS_T *k,
+        const uint8_t *kbit, int sbox) {
+    BS_T a[6];
+    for (int i = 0; i < 6; i++)
+        a[i] = r[EXP[6 * sbox + i] - 1] ^ k[kbit[6 * sbox + i]];
+    switch (sbox) {
+    case 0:
+        BS_NAME(sbox1)(a, o);
+        break;
+    case 1:
+        BS_NAME(sbox2)(a, o);
+        break;
+    case 2:
+        BS_NAME(sbox3)(a, o);
+        break;
+    case 3:
+        BS_NAME(sbox4)(a, o);
+        break;
+    case 4:
+        BS_NAME(sbox5)(a, o);
+        break;
+    case 5:
+        BS_NAME(sbox6)(a, o);
+        break;
+    case 6:
+        BS_NAME(sbox7)(a, o);
+        break;
+    default:
+        BS_NAME(sbox8)(a, o);
+        break;
+    }
+}
+
+/**
+ * Runs a round where every lane has its own key. 
+ *
+ * PARAMETERS: 
+ * l    - the 32 planes of the left half, XORed with the f-function
+ * r    - the 32 planes of the right half
+ * k    - the 64 key planes
+ * kbit - the key plane of every subkey bit of the round
+ */
+static inline void BS_NAME(kround)(BS_T *l, const BS_T *r, const BS_T *k,
+        const uint8_t *kbit) {
+    BS_T pre[32];
+    for (int s = 0; s < 8; s++)
+        BS_NAME(ksbox)(pre + 4 * s, r, k, kbit, s);
+    for (int j = 0; j < 32; j++)
+        l[j] ^= pre[P[j] - 1];
+}
+
+/**
+ * Encrypts or decrypts 64 * BS_LANES blocks in bitsliced form, every lane 
+ * under its own key. The key schedule of every lane is a renaming of the 
+ * key planes, so it costs nothing. 
+ *
+ * PARAMETERS: 
+ * x    - the 64 block planes, replaced by the result
+ * k    - the 64 key planes
+ * kbit - the key plane of every subkey bit of every round
+ * dec  - whether to decrypt, running the rounds in reverse
+ */
+static void BS_NAME(kdes)(BS_T x[64], const BS_T k[64],
+        uint8_t kbit[16][48], _Bool dec) {
+    BS_T lr[2][32];
+    BS_T *l = lr[0], *r = lr[1];
+    for (int i = 0; i < 32; i++) {      //initial permutation
+        l[i] = x[IP[i] - 1];
+        r[i] = x[IP[i + 32] - 1];
+    }
+    for (int i = 0; i < 16; i++) {
+        BS_NAME(kround)(l, r, k, kbit[dec ? 15 - i : i]);
+        BS_T *temp = l;     //swap left and right
+        l = r;
+        r = temp;
+    }
+    for (int i = 0; i < 64; i++) {      //inverse of initial permutation
+        int j = IP_INV[i] - 1;          //pre-output is right then left
+        x[i] = (j < 32 ? r[j] : l[j - 32]);
+    }
+}
+
+/**
+ * Encrypts or decrypts the specified blocks, each under its own key. The 
+ * number of blocks must be a multiple of 64 * BS_LANES. The output may be 
+ * the same as the input. 
+ *
+ * PARAMETERS: 
+ * out  - the result blocks
+ * in   - the blocks to encrypt/decrypt
+ * keys - the 64-bit key of every block
+ * n    - the number of blocks
+ * kbit - the key plane of every subkey bit of every round
+ * dec  - whether to decrypt
+ */
+static void BS_NAME(kcrypt)(uint64_t *out, const uint64_t *in,
+        const uint64_t *keys, size_t n, uint8_t kbit[16][48],
+        _Bool dec) {
+    for (size_t i = 0; i < n; i += 64 * BS_LANES) {
+        BS_T x[64], k[64];
+        BS_NAME(load)(x, in + i);
+        BS_NAME(load)(k, keys + i);     //plane j is bit j + 1 of every key
+        BS_NAME(kdes)(x, k, kbit, dec);
+        BS_NAME(store)(out + i, x);
+    }
+}
+
+/**
+ * Runs a round where every lane has its own key, one s-box at a time, and 
+ * compares every new bit of the left half with the same bit of each 
+ * target. Lanes that differ are cleared, and the round stops early once 
+ * no lane is left. 
+ *
+ * PARAMETERS: 
+ * l     - the 32 planes of the left half, replaced by the new right half
+ * r     - the 32 planes of the right half
+ * k     - the 64 key planes
+ * key   - the search
+ * round - the round, from 0 to 15
+ * half  - the half of the targets to compare with, 0 for R16, 1 for L16
+ * alive - the lanes still matching each target
+ *
+ * RETURNS: 
+ * 1 (true) if any lane still matches, 0 (false) otherwise. 
+ */
+static _Bool BS_NAME(kcheck)(BS_T *l, const BS_T *r, const BS_T *k,
+        const SearchKey *key, int round, int half, BS_T alive[2]) {
+    for (int s = 0; s < 8; s++) {
+        BS_T o[4];
+        BS_NAME(ksbox)(o, r, k, key->kbit[round], s);
+        for (int i = 0; i < 4; i++) {
+            int j = key->pinv[4 * s + i];
+            l[j] ^= o[i];
+            alive[0] &= ~(l[j] ^ key->ct[0][32 * half + j]);
+            alive[1] &= ~(l[j] ^ key->ct[1][32 * half + j]);
+        }
+        if (!BS_NAME(any)(alive[0] | alive[1]))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Encrypts the plain text of the search under the 64 * BS_LANES keys of 
+ * the key planes and finds the lanes whose cipher text is a target. The 
+ * pre-output of a target is IP of the cipher text, so no IP_INV is run. 
+ * Round 15 gives L16 and round 16 gives R16, both are compared while they 
+ * are computed, so most keys are ruled out after a few s-boxes of round 
+ * 15. 
+ *
+ * PARAMETERS: 
+ * alive - the lanes to try, replaced by the lanes matching each target
+ * k     - the 64 key planes
+ * key   - the search
+ */
+static void BS_NAME(keys)(BS_T alive[2], const BS_T k[64],
+        const SearchKey *key) {
+    BS_T lr[2][32], zero;
+    memset(&zero, 0, sizeof zero);
+    BS_T *l = lr[0], *r = lr[1];
+    for (int i = 0; i < 32; i++) {      //the same block in every lane
+        l[i] = zero ^ key->pt[i];
+        r[i] = zero ^ key->pt[i + 32];
+    }
+
+    for (int i = 0; i < 14; i++) {
+        BS_NAME(kround)(l, r, k, key->kbit[i]);
+        BS_T *temp = l;     //swap left and right
+        l = r;
+        r = temp;
+    }
+    if (BS_NAME(kcheck)(l, r, k, key, 14, 1, alive))
+        BS_NAME(kcheck)(r, l, k, key, 15, 0, alive);
+}
+
+/**
+ * Searches the specified range of key indexes, 64 * BS_LANES keys at a 
+ * time. Bit t of lane l of a slice holds the key index 64 * l + t above 
+ * the start of the slice. 
+ *
+ * PARAMETERS: 
+ * found - the matching keys
+ * max   - the most matching keys to store
+ * first - the first key index to try
+ * n     - the number of key indexes to try
+ * key   - the search
+ *
+ * RETURNS: 
+ * The number of matching keys stored. 
+ */
+static size_t BS_NAME(search)(des_key_match *found, size_t max,
+        uint64_t first, uint64_t n, const SearchKey *key) {
+    const uint64_t width = 64 * BS_LANES;
+    uint64_t end = first + n;
+    size_t nfound = 0;
+    for (uint64_t base = first - first % width; base < end; base += width) {
+        uint64_t planes[64][BS_LANES];
+        uint64_t mask[BS_LANES];
+        for (int l = 0; l < BS_LANES; l++) {
+            uint64_t index = base + 64 * (uint64_t)l;
+            for (int j = 0; j < 64; j++) {
+                int q = key->qbit[j];
+                if (q < 0)
+                    planes[j][l] = 0;               //parity bit
+                else if (q < 6)
+                    planes[j][l] = LANE_BITS[q];    //bit of the lane bit
+                else
+                    planes[j][l] = 0 - ((index >> q) & 1);
+            }
+            mask[l] = range_mask(index, first, end);
+        }
+
+        BS_T k[64], alive[2];
+        memcpy(k, planes, sizeof k);
+        memcpy(&alive[0], mask, sizeof mask);
+        alive[1] = (key->nct > 1 ? alive[0] : alive[0] & 0);
+        BS_NAME(keys)(alive, k, key);
+
+        for (int t = 0; t < 2; t++) {
+            if (!BS_NAME(any)(alive[t]))
+                continue;
+            memcpy(mask, &alive[t], sizeof mask);
+            for (int l = 0; l < BS_LANES; l++) {
+                for (int b = 0; b < 64; b++) {
+                    if (((mask[l] >> b) & 1) && nfound < max) {
+                        found[nfound].index = base + 64 * (uint64_t)l + b;
+                        found[nfound++].target = t;
+                    }
+                }
+            }
+        }
+    }
+    return nfound;
+}
@@ -0,0 +1,261 @@
+/**
+ * FILE:   descpu.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Runtime selection of the fastest DES backend for the CPU. The features 
+ * are read with cpuid once, then the bitsliced batches and the compiled 
+ * permutations pick their code from the active backend on every call. 
+ * The backend can be forced with the DES_BACKEND environment variable, 
+ * read on first use, or with des_backend_set(), so one binary runs well 
+ * on every CPU and every path can be tested on one machine. 
+ *
+ * C99
+ */
+
+#include <string.h>
+#include "descpu.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DES_CPU_X86
+#include <cpuid.h>
+#endif
+
+#define KNOWN 0x80000000u       //set once the value is initialised
+#define SLOW_PEXT 0x40000000u   //PEXT/PDEP run in microcode
+
+static const char *NAMES[DES_BACKEND_COUNT] = {
+    "auto", "scalar", "sse2", "avx2", "avx512"
+};
+
+static unsigned features = 0;   //KNOWN | DES_CPU_* flags of the CPU
+static unsigned active = 0;     //KNOWN | enabled flags << 8 | backend
+
+static unsigned detect(void);
+static unsigned backend_flags(des_backend b);
+static des_backend best(void);
+static unsigned backend_state(des_backend b);
+
+/**
+ * Returns the features of the CPU, detected on first call. The vector 
+ * features are only reported if the operating system saves their 
+ * registers. 
+ *
+ * RETURNS: 
+ * The DES_CPU_* flags of the CPU. 
+ */
+unsigned des_cpu_features(void) {
+    unsigned f = __atomic_load_n(&features, __ATOMIC_RELAXED);
+    if (!(f & KNOWN)) {         //racing threads detect the same flags
+        f = KNOWN | detect();
+        __atomic_store_n(&features, f, __ATOMIC_RELAXED);
+    }
+    return f & ~(KNOWN | SLOW_PEXT);
+}
+
+/**
+ * Returns the features the active backend may use, a subset of 
+ * des_cpu_features(). 
+ *
+ * RETURNS: 
+ * The DES_CPU_* flags enabled by the active backend. 
+ */
+unsigned des_cpu_enabled(void) {
+    unsigned a = __atomic_load_n(&active, __ATOMIC_RELAXED);
+    if (!(a & KNOWN)) {
+        des_backend b = DES_BACKEND_AUTO;
+        const char *env = getenv("DES_BACKEND");
+        if (env == NULL || !des_backend_find(env, &b) ||
+                !des_backend_supported(b))
+            b = DES_BACKEND_AUTO;   //unknown or unsupported, ignored
+        unsigned expected = 0;
+        a = backend_state(b);
+        if (!__atomic_compare_exchange_n(&active, &expected, a, false,
+                __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            a = expected;       //des_backend_set() came first
+    }
+    return (a >> 8) & 0xff;
+}
+
+/**
+ * Returns the active backend. On first use this is the backend named by 
+ * the DES_BACKEND environment variable if the CPU supports it, otherwise 
+ * the fastest the CPU supports. 
+ *
+ * RETURNS: 
+ * The active backend, never DES_BACKEND_AUTO. 
+ */
+des_backend des_backend_get(void) {
+    des_cpu_enabled();          //read DES_BACKEND on first use
+    return (des_backend)(__atomic_load_n(&active, __ATOMIC_RELAXED) & 0xff);
+}
+
+/**
+ * Activates the specified backend for every thread. Calls already running 
+ * finish with the backend they started with. 
+ *
+ * PARAMETERS: 
+ * b - the backend, or DES_BACKEND_AUTO for the fastest
+ *
+ * RETURNS: 
+ * 1 (true) if the backend is active, 0 (false) if the CPU does not 
+ * support it. 
+ */
+_Bool des_backend_set(des_backend b) {
+    if (!des_backend_supported(b))
+        return false;
+    __atomic_store_n(&active, backend_state(b), __ATOMIC_RELAXED);
+    return true;
+}
+
+/**
+ * Returns whether the CPU supports the specified backend. 
+ *
+ * PARAMETERS: 
+ * b - the backend
+ *
+ * RETURNS: 
+ * 1 (true) if the backend can be activated, 0 (false) otherwise. 
+ */
+_Bool des_backend_supported(des_backend b) {
+    static const unsigned NEEDS[DES_BACKEND_COUNT] = {
+        0, 0, DES_CPU_SSE2, DES_CPU_AVX2, DES_CPU_AVX512F
+    };
+    if ((unsigned)b >= DES_BACKEND_COUNT)
+        return false;
+    return (des_cpu_features() & NEEDS[b]) == NEEDS[b];
+}
+
+/**
+ * Returns the name of the specified backend, as used by DES_BACKEND: 
+ * auto, scalar, sse2, avx2 or avx512. 
+ *
+ * PARAMETERS: 
+ * b - the backend
+ *
+ * RETURNS: 
+ * The name, or NULL if the backend is invalid. 
+ */
+const char *des_backend_name(des_backend b) {
+    return ((unsigned)b < DES_BACKEND_COUNT ? NAMES[b] : NULL);
+}
+
+/**
+ * Finds the backend with the specified name. 
+ *
+ * PARAMETERS: 
+ * name - the name of the backend
+ * b    - the backend to store the result
+ *
+ * RETURNS: 
+ * 1 (true) if the name is valid, 0 (false) otherwise. 
+ */
+_Bool des_backend_find(const char *name, des_backend *b) {
+    if (name == NULL || b == NULL)
+        return false;
+    for (int i = 0; i < DES_BACKEND_COUNT; i++) {
+        if (strcmp(name, NAMES[i]) == 0) {
+            *b = (des_backend)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Reads the features of the CPU with cpuid. AVX2 and AVX-512 also need 
+ * the operating system to save the wider registers, checked with xgetbv. 
+ * Zen 1 and Zen 2 (family 0x17, and the Hygon family 0x18 built on Zen 1) 
+ * report BMI2 but run PEXT and PDEP in microcode, many times slower than 
+ * the lookup tables, which SLOW_PEXT records. 
+ *
+ * RETURNS: 
+ * The DES_CPU_* flags of the CPU, and SLOW_PEXT. 
+ */
+static unsigned detect(void) {
+    unsigned f = 0;
+#ifdef DES_CPU_X86
+    unsigned a, b, c, d;
+    unsigned vendor[3];
+    if (!__get_cpuid(0, &a, &vendor[0], &vendor[2], &vendor[1]))
+        return 0;
+    if (!__get_cpuid(1, &a, &b, &c, &d))
+        return 0;
+    if (d & bit_SSE2)
+        f |= DES_CPU_SSE2;
+    unsigned family = (a >> 8) & 0xf;
+    if (family == 0xf)
+        family += (a >> 20) & 0xff;
+    if ((memcmp(vendor, "AuthenticAMD", 12) == 0 && family == 0x17) ||
+            (memcmp(vendor, "HygonGenuine", 12) == 0 && family == 0x18))
+        f |= SLOW_PEXT;
+
+    unsigned xcr0 = 0;
+    if (c & bit_OSXSAVE) {
+        unsigned hi;
+        __asm__ volatile("xgetbv" : "=a"(xcr0), "=d"(hi) : "c"(0));
+    }
+    _Bool ymm = (xcr0 & 0x06) == 0x06;      //SSE and AVX state
+    _Bool zmm = (xcr0 & 0xe6) == 0xe6;      //and opmask, ZMM state
+    if (__get_cpuid_max(0, NULL) >= 7) {
+        __cpuid_count(7, 0, a, b, c, d);
+        if (ymm && (b & bit_AVX2))
+            f |= DES_CPU_AVX2;
+        if (zmm && (b & bit_AVX512F))
+            f |= DES_CPU_AVX512F;
+        if (b & bit_BMI2)
+            f |= DES_CPU_BMI2;
+    }
+#endif
+    return f;
+}
+
+/**
+ * Returns the features the specified backend may use on this CPU. BMI2 is 
+ * left off where PEXT and PDEP are slow. 
+ *
+ * PARAMETERS: 
+ * b - the backend, not DES_BACKEND_AUTO
+ *
+ * RETURNS: 
+ * The enabled DES_CPU_* flags. 
+ */
+static unsigned backend_flags(des_backend b) {
+    static const unsigned USES[DES_BACKEND_COUNT] = {
+        0, 0, DES_CPU_SSE2,
+        DES_CPU_SSE2 | DES_CPU_AVX2 | DES_CPU_BMI2,
+        DES_CPU_SSE2 | DES_CPU_AVX2 | DES_CPU_AVX512F | DES_CPU_BMI2
+    };
+    unsigned f = des_cpu_features();
+    if (__atomic_load_n(&features, __ATOMIC_RELAXED) & SLOW_PEXT)
+        f &= ~DES_CPU_BMI2;     //the lookup tables are faster
+    return USES[b] & f;
+}
+
+/**
+ * Returns the fastest backend the CPU supports. 
+ *
+ * RETURNS: 
+ * The fastest backend. 
+ */
+static des_backend best(void) {
+    des_backend b = DES_BACKEND_AVX512;
+    while (b > DES_BACKEND_SCALAR && !des_backend_supported(b))
+        b = (des_backend)(b - 1);
+    return b;
+}
+
+/**
+ * Returns the state of the active backend for the specified backend. 
+ *
+ * PARAMETERS: 
+ * b - the supported backend, or DES_BACKEND_AUTO for the fastest
+ *
+ * RETURNS: 
+ * The state, the backend with its enabled features. 
+ */
+static unsigned backend_state(des_backend b) {
+    if (b == DES_BACKEND_AUTO)
+        b = best();
+    return KNOWN | (backend_flags(b) << 8) | (unsigned)b;
+}
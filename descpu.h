@@ -0,0 +1,119 @@
+/**
+ * FILE:   descpu.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Runtime selection of the fastest DES backend for the CPU. The features 
+ * are read with cpuid once, then the bitsliced batches and the compiled 
+ * permutations pick their code from the active backend on every call. 
+ * The backend can be forced with the DES_BACKEND environment variable, 
+ * read on first use, or with des_backend_set(), so one binary runs well 
+ * on every CPU and every path can be tested on one machine. 
+ *
+ * C99
+ */
+
+#ifndef __descpu_h__
+#define __descpu_h__
+#include <stdlib.h>
+#include <stdbool.h>
+
+/**
+ * The CPU features used by the backends. 
+ */
+#define DES_CPU_SSE2    0x1     //128-bit bitslicing
+#define DES_CPU_AVX2    0x2     //256-bit bitslicing
+#define DES_CPU_AVX512F 0x4     //512-bit bitslicing
+#define DES_CPU_BMI2    0x8     //PEXT/PDEP permutations
+
+/**
+ * The backends, from the slowest to the fastest. Each backend also uses 
+ * the features of the backends below it. 
+ */
+typedef enum des_backend {
+    DES_BACKEND_AUTO,       //the fastest the CPU supports
+    DES_BACKEND_SCALAR,     //portable code, 64-bit slices, table lookups
+    DES_BACKEND_SSE2,       //128-bit slices
+    DES_BACKEND_AVX2,       //256-bit slices, PEXT/PDEP with fast BMI2
+    DES_BACKEND_AVX512,     //512-bit slices, PEXT/PDEP with fast BMI2
+    DES_BACKEND_COUNT
+} des_backend;
+
+/**
+ * Returns the features of the CPU, detected on first call. The vector 
+ * features are only reported if the operating system saves their 
+ * registers. 
+ *
+ * RETURNS: 
+ * The DES_CPU_* flags of the CPU. 
+ */
+unsigned des_cpu_features(void);
+
+/**
+ * Returns the features the active backend may use, a subset of 
+ * des_cpu_features(). 
+ *
+ * RETURNS: 
+ * The DES_CPU_* flags enabled by the active backend. 
+ */
+unsigned des_cpu_enabled(void);
+
+/**
+ * Returns the active backend. On first use this is the backend named by 
+ * the DES_BACKEND environment variable if the CPU supports it, otherwise 
+ * the fastest the CPU supports. 
+ *
+ * RETURNS: 
+ * The active backend, never DES_BACKEND_AUTO. 
+ */
+des_backend des_backend_get(void);
+
+/**
+ * Activates the specified backend for every thread. Calls already running 
+ * finish with the backend they started with. 
+ *
+ * PARAMETERS: 
+ * b - the backend, or DES_BACKEND_AUTO for the fastest
+ *
+ * RETURNS: 
+ * 1 (true) if the backend is active, 0 (false) if the CPU does not 
+ * support it. 
+ */
+_Bool des_backend_set(des_backend b);
+
+/**
+ * Returns whether the CPU supports the specified backend. 
+ *
+ * PARAMETERS: 
+ * b - the backend
+ *
+ * RETURNS: 
+ * 1 (true) if the backend can be activated, 0 (false) otherwise. 
+ */
+_Bool des_backend_supported(des_backend b);
+
+/**
+ * Returns the name of the specified backend, as used by DES_BACKEND: 
+ * auto, scalar, sse2, avx2 or avx512. 
+ *
+ * PARAMETERS: 
+ * b - the backend
+ *
+ * RETURNS: 
+ * The name, or NULL if the backend is invalid. 
+ */
+const char *des_backend_name(des_backend b);
+
+/**
+ * Finds the backend with the specified name. 
+ *
+ * PARAMETERS: 
+ * name - the name of the backend
+ * b    - the backend to store the result
+ *
+ * RETURNS: 
+ * 1 (true) if the name is valid, 0 (false) otherwise. 
+ */
+_Bool des_backend_find(const char *name, des_backend *b);
+
+#endif
@@ -0,0 +1,274 @@
+/**
+ * FILE:   desfile.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Command line front end for des_stream(), encrypting or decrypting a 
+ * file or stdin to a file or stdout. 
+ *
+ *     desfile [-d] [-m mode] [-n] [-t threads] -k key [-i iv] [in [out]]
+ *
+ * The key is 16 hex digits for DES, 32 for 2-key or 48 for 3-key triple 
+ * DES. The IV is 16 hex digits, 0 by default. The mode is one of ecb, 
+ * cbc, cfb, ofb or ctr, cbc by default. ECB and CBC use PKCS#5 padding 
+ * unless -n is given. With -t the parallel modes run on a pool of threads, 
+ * 0 for every CPU. A missing or "-" file means stdin or stdout. An output 
+ * file is written to a temporary file next to it, renamed over the output 
+ * only if the whole input went through, so a failed run leaves any old 
+ * output as it was. The input and output must not be the same file. 
+ *
+ * C99, POSIX
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "desstream.h"
+
+static int open_output(const char *path, char **tmp);
+static _Bool same_file(int infd, int outfd, const char *outpath);
+static _Bool parse_hex(const char *str, size_t ndigits, uint64_t *v);
+static _Bool parse_mode(const char *str, des_mode *mode);
+static int usage(const char *prog);
+
+/**
+ * Parses the arguments, then streams the input to the output. 
+ *
+ * PARAMETERS: 
+ * argc - the number of arguments
+ * argv - the arguments
+ *
+ * RETURNS: 
+ * 0 if successful, 1 otherwise. 
+ */
+int main(int argc, char **argv) {
+    _Bool dec = false, pad = true;
+    des_mode mode = DES_CBC;
+    const char *key = NULL, *iv = NULL;
+    long threads = -1;          //no pool
+
+    int opt;
+    char *end;
+    while ((opt = getopt(argc, argv, "dm:nt:k:i:")) != -1) {
+        switch (opt) {
+        case 'd':
+            dec = true;
+            break;
+        case 'm':
+            if (!parse_mode(optarg, &mode))
+                return usage(argv[0]);
+            break;
+        case 'n':
+            pad = false;
+            break;
+        case 't':
+            threads = strtol(optarg, &end, 10);
+            if (end == optarg || *end != '\0')
+                return usage(argv[0]);
+            break;
+        case 'k':
+            key = optarg;
+            break;
+        case 'i':
+            iv = optarg;
+            break;
+        default:
+            return usage(argv[0]);
+        }
+    }
+    if (key == NULL || argc - optind > 2 || threads < -1)
+        return usage(argv[0]);
+
+    uint64_t k[3] = {0}, v = 0;
+    size_t keylen = strlen(key);
+    if ((keylen != 16 && keylen != 32 && keylen != 48) ||
+            (iv != NULL && (strlen(iv) != 16 || !parse_hex(iv, 16, &v))))
+        return usage(argv[0]);
+    for (size_t i = 0; i < keylen / 16; i++)
+        if (!parse_hex(key + 16 * i, 16, &k[i]))
+            return usage(argv[0]);
+
+    des_mode_ctx ctx;
+    if (keylen == 16)
+        des_mode_init(&ctx, mode, dec, k[0], v, pad);
+    else        //2-key triple DES reuses the first key
+        tdes_mode_init(&ctx, mode, dec, k[0], k[1],
+                (keylen == 48 ? k[2] : k[0]), v, pad);
+
+    const char *inpath = (optind < argc ? argv[optind] : "-");
+    const char *outpath = (optind + 1 < argc ? argv[optind + 1] : "-");
+    int infd = (strcmp(inpath, "-") == 0 ? STDIN_FILENO :
+            open(inpath, O_RDONLY));
+    if (infd < 0) {
+        perror(inpath);
+        return 1;
+    }
+    if (same_file(infd, STDOUT_FILENO, outpath)) {
+        fprintf(stderr, "%s: %s is both input and output\n", argv[0],
+                outpath);
+        return 1;
+    }
+    char *tmp = NULL;           //temporary file renamed to the output
+    int outfd = (strcmp(outpath, "-") == 0 ? STDOUT_FILENO :
+            open_output(outpath, &tmp));
+    if (outfd < 0) {
+        perror(outpath);
+        return 1;
+    }
+
+    des_pool *pool = NULL;
+    _Bool ok = true;
+    if (threads >= 0 && (pool = des_pool_new((size_t)threads)) == NULL) {
+        fprintf(stderr, "%s: cannot start threads\n", argv[0]);
+        ok = false;
+    } else if (!des_stream(&ctx, pool, infd, outfd)) {
+        fprintf(stderr, "%s: %s failed\n", argv[0], dec ? "decryption" :
+                "encryption");
+        ok = false;
+    }
+    des_pool_free(pool);
+    if (outfd != STDOUT_FILENO && close(outfd) != 0 && ok) {
+        perror(outpath);
+        ok = false;
+    }
+    if (tmp != NULL) {          //replace the output only on success
+        if (ok && rename(tmp, outpath) != 0) {
+            perror(outpath);
+            ok = false;
+        }
+        if (!ok)
+            unlink(tmp);
+        free(tmp);
+    }
+    return ok ? 0 : 1;
+}
+
+/**
+ * Opens the specified output file. A regular file, or a path that does not 
+ * exist yet, is written to a new temporary file in the same directory, 
+ * with the permissions of the old output or those a new output would get. 
+ * Anything else, like a device or a pipe, is opened for writing directly. 
+ *
+ * PARAMETERS: 
+ * path - the path of the output
+ * tmp  - stores the temporary file to rename to the output, or NULL
+ *
+ * RETURNS: 
+ * The file descriptor, or -1 if any error occurred. 
+ */
+static int open_output(const char *path, char **tmp) {
+    struct stat st;
+    *tmp = NULL;
+    _Bool exists = lstat(path, &st) == 0;
+    if (exists ? !S_ISREG(st.st_mode) : errno != ENOENT)
+        return open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    const char *base = strrchr(path, '/');
+    int dirlen = (base == NULL ? 0 : (int)(base - path) + 1);
+    base = (base == NULL ? path : base + 1);
+    size_t size = strlen(path) + 16;
+    if ((*tmp = malloc(size)) == NULL)
+        return -1;
+    snprintf(*tmp, size, "%.*s.%s.XXXXXX", dirlen, path, base);
+    int fd = mkstemp(*tmp);
+    mode_t mask = umask(0);
+    umask(mask);
+    mode_t mode = (exists ? st.st_mode & 07777 : 0644 & ~mask);
+    if (fd >= 0 && fchmod(fd, mode) != 0) {
+        close(fd);
+        unlink(*tmp);
+        fd = -1;
+    }
+    if (fd < 0) {
+        free(*tmp);
+        *tmp = NULL;
+    }
+    return fd;
+}
+
+/**
+ * Returns whether the output would overwrite the input, a regular file. 
+ *
+ * PARAMETERS: 
+ * infd    - the input file descriptor
+ * outfd   - the file descriptor of the output if its path is "-"
+ * outpath - the path of the output
+ *
+ * RETURNS: 
+ * 1 (true) if both are the same file, 0 (false) otherwise. 
+ */
+static _Bool same_file(int infd, int outfd, const char *outpath) {
+    struct stat in, out;
+    if (fstat(infd, &in) != 0)
+        return false;
+    int r = (strcmp(outpath, "-") == 0 ? fstat(outfd, &out) :
+            stat(outpath, &out));
+    return r == 0 && S_ISREG(in.st_mode) && in.st_dev == out.st_dev &&
+            in.st_ino == out.st_ino;
+}
+
+/**
+ * Parses the specified number of hex digits into a 64-bit value. 
+ *
+ * PARAMETERS: 
+ * str     - the hex digits
+ * ndigits - the number of digits to parse, up to 16
+ * v       - the value to store the result
+ *
+ * RETURNS: 
+ * 1 (true) if every digit is valid, 0 (false) otherwise. 
+ */
+static _Bool parse_hex(const char *str, size_t ndigits, uint64_t *v) {
+    uint64_t r = 0;
+    for (size_t i = 0; i < ndigits; i++) {
+        char c = str[i];
+        int d = (c >= '0' && c <= '9' ? c - '0' :
+                c >= 'a' && c <= 'f' ? c - 'a' + 10 :
+                c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1);
+        if (d < 0)
+            return false;   //not a hex digit, or too short
+        r = (r << 4) | (uint64_t)d;
+    }
+    *v = r;
+    return true;
+}
+
+/**
+ * Parses the name of a mode of operation. 
+ *
+ * PARAMETERS: 
+ * str  - the name of the mode
+ * mode - the mode to store the result
+ *
+ * RETURNS: 
+ * 1 (true) if the name is valid, 0 (false) otherwise. 
+ */
+static _Bool parse_mode(const char *str, des_mode *mode) {
+    static const char *names[] = { "ecb", "cbc", "cfb", "ofb", "ctr" };
+    for (int i = 0; i < 5; i++) {
+        if (strcmp(str, names[i]) == 0) {
+            *mode = (des_mode)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Prints the usage of the program. 
+ *
+ * PARAMETERS: 
+ * prog - the name of the program
+ *
+ * RETURNS: 
+ * 1, the exit status for bad arguments. 
+ */
+static int usage(const char *prog) {
+    fprintf(stderr, "usage: %s [-d] [-m ecb|cbc|cfb|ofb|ctr] [-n] "
+            "[-t threads] -k key [-i iv] [in [out]]\n", prog);
+    return 1;
+}
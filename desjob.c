@@ -0,0 +1,785 @@
+/**
+ * FILE:   desjob.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Asynchronous encryption jobs. Buffers and files are submitted to a queue 
+ * served by a fixed set of worker threads, and collected once complete. 
+ * On Linux every worker keeps up to DES_JOB_DEPTH file jobs in flight on 
+ * its own io_uring, handling whichever read or write completes first, so 
+ * the I/O of some jobs overlaps with the encryption of others. Other 
+ * systems, or kernels without io_uring, run one job at a time per worker 
+ * through des_stream(). Building with DES_NO_URING always uses the 
+ * fallback. 
+ *
+ * C99, POSIX threads
+ */
+
+#define _GNU_SOURCE             //syscall() for io_uring
+#include <errno.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "desjob.h"
+#include "desstream.h"
+#include "desprobe.h"
+
+#if defined(__linux__) && !defined(DES_NO_URING) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define DES_JOB_URING
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+#endif
+
+#ifdef DES_JOB_URING
+/**
+ * The number of entries of the ring of every worker: a read, a write and 
+ * two cancels for every job in flight, and the read of the wake event. 
+ */
+#define RING_DEPTH (4 * DES_JOB_DEPTH + 1)
+
+/**
+ * The kinds of request, in the low bits of the user data of a request. 
+ * The rest of the user data is the index of the slot. 
+ */
+enum { TAG_READ, TAG_WRITE, TAG_CANCEL, TAG_WAKE, TAG_BITS = 2 };
+
+/**
+ * An io_uring instance, set up with raw system calls. 
+ */
+typedef struct Ring {
+    int fd;                     //the ring file descriptor
+    void *sq_map;               //the mapped submission ring
+    void *cq_map;               //the mapped completion ring
+    size_t sq_size;             //bytes mapped for the submission ring
+    size_t cq_size;             //bytes mapped for the completion ring
+    size_t sqes_size;           //bytes mapped for the submission entries
+    unsigned *sq_tail;          //submission ring tail, written by us
+    unsigned *sq_mask;          //submission ring mask
+    unsigned *sq_array;         //submission ring array of entry indices
+    unsigned *cq_head;          //completion ring head, written by us
+    unsigned *cq_tail;          //completion ring tail, written by the kernel
+    unsigned *cq_mask;          //completion ring mask
+    struct io_uring_sqe *sqes;  //the submission entries
+    struct io_uring_cqe *cqes;  //the completion entries
+    unsigned queued;            //requests queued and not submitted yet
+} Ring;
+
+/**
+ * A file job in flight on a worker. The next read fills in[cur] while 
+ * in[cur ^ 1] is encrypted, and at most one output buffer is written 
+ * while the other waits its turn. 
+ */
+typedef struct Slot {
+    des_job *job;               //the job, NULL if the slot is free
+    uint8_t *in[2];             //the two read buffers
+    uint8_t *out[2];            //the two write buffers, 8 bytes larger
+    int cur;                    //the buffer of the read in flight or done
+    size_t inlen;               //bytes read into in[cur], 0 if none
+    int queued;                 //output buffer waiting to be written, or -1
+    size_t qlen;                //bytes of the waiting output buffer
+    int wout;                   //output buffer being written, or -1
+    const uint8_t *wbuf;        //the bytes of the write in flight
+    size_t wlen;                //bytes left of the write in flight
+    _Bool reading;              //whether a read is in flight
+    _Bool eof;                  //whether the input has ended
+    _Bool final;                //whether the last block is written out
+    _Bool failed;               //whether reading, writing or the mode failed
+    _Bool cancelled;            //whether the requests in flight are cancelled
+    int cancels;                //cancel requests in flight
+} Slot;
+#endif
+
+/**
+ * A worker thread and its I/O state. 
+ */
+typedef struct Worker {
+    pthread_t thread;           //the thread
+    des_jobq *q;                //the queue served
+    size_t active;              //jobs running on the worker, guarded by q
+#ifdef DES_JOB_URING
+    Ring ring;                  //the ring for file jobs
+    _Bool uring;                //whether the ring is set up, guarded by q
+    _Bool kicked;               //whether the wake event is set, guarded by q
+    int efd;                    //the wake event, written on submit
+    uint64_t ebuf;              //the value read from the wake event
+    Slot slots[DES_JOB_DEPTH];  //the file jobs in flight
+#endif
+} Worker;
+
+struct des_jobq {
+    Worker *workers;            //the worker threads
+    size_t nthreads;            //number of worker threads
+    des_job *pending;           //jobs waiting for a worker
+    des_job *pending_tail;      //the last pending job
+    des_job *done;              //jobs complete and not collected
+    des_job *done_tail;         //the last complete job
+    size_t running;             //jobs submitted and not complete
+    size_t idle;                //workers waiting for a job
+    _Bool stop;                 //whether the workers should exit
+    pthread_mutex_t lock;       //guards the fields above
+    pthread_cond_t work;        //signalled when a job is submitted
+    pthread_cond_t finish;      //signalled when a job completes
+};
+
+static void *worker(void *arg);
+static des_job *take_job(Worker *w, _Bool files);
+static void finish_job(Worker *w, des_job *job);
+static _Bool run_job(des_job *job);
+static des_job *take_done(des_jobq *q);
+#ifdef DES_JOB_URING
+static void kick(des_jobq *q);
+static _Bool uring_setup(Worker *w);
+static void uring_free(Worker *w);
+static void uring_loop(Worker *w);
+static _Bool slot_start(Worker *w, des_job *job);
+static void slot_advance(Worker *w, Slot *s);
+static void slot_complete(Worker *w, Slot *s, int tag, int res);
+static void ring_queue(Ring *r, int op, int fd, const void *buf, size_t len,
+        uint64_t data);
+static void ring_enter(Worker *w, _Bool wait);
+#endif
+
+/**
+ * Creates a queue with the specified number of worker threads. If the 
+ * number is 0, one worker is started for every online CPU. The queue must 
+ * be freed with des_jobq_free(). 
+ *
+ * PARAMETERS: 
+ * nthreads - the number of worker threads, or 0 for every CPU
+ *
+ * RETURNS: 
+ * The new queue, or NULL if any error occurred. 
+ */
+des_jobq *des_jobq_new(size_t nthreads) {
+    if (nthreads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = (cpus > 0 ? (size_t)cpus : 1);
+    }
+
+    des_jobq *q = calloc(1, sizeof *q);
+    if (q == NULL)
+        return NULL;
+    q->workers = calloc(nthreads, sizeof *q->workers);
+    if (q->workers == NULL) {
+        free(q);
+        return NULL;
+    }
+
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->work, NULL);
+    pthread_cond_init(&q->finish, NULL);
+    for (q->nthreads = 0; q->nthreads < nthreads; q->nthreads++) {
+        Worker *w = &q->workers[q->nthreads];
+        w->q = q;
+        if (pthread_create(&w->thread, NULL, &worker, w) != 0)
+            break;
+    }
+
+    if (q->nthreads == 0) {
+        des_jobq_free(q);       //no thread could be started
+        return NULL;
+    }
+    return q;
+}
+
+/**
+ * Waits for every submitted job to finish, stops the worker threads and 
+ * frees the specified queue. Jobs not collected yet are left as they are. 
+ *
+ * PARAMETERS: 
+ * q - the queue to free
+ */
+void des_jobq_free(des_jobq *q) {
+    if (q == NULL)
+        return;
+
+    pthread_mutex_lock(&q->lock);
+    while (q->running > 0)
+        pthread_cond_wait(&q->finish, &q->lock);
+    q->stop = true;
+    pthread_cond_broadcast(&q->work);
+    pthread_mutex_unlock(&q->lock);
+    for (size_t i = 0; i < q->nthreads; i++)
+        pthread_join(q->workers[i].thread, NULL);
+
+    pthread_mutex_destroy(&q->lock);
+    pthread_cond_destroy(&q->work);
+    pthread_cond_destroy(&q->finish);
+    free(q->workers);
+    free(q);
+}
+
+/**
+ * Submits the specified job to the queue, returning straight away. 
+ *
+ * PARAMETERS: 
+ * q   - the queue
+ * job - the job to run
+ *
+ * RETURNS: 
+ * 1 (true) if the job is queued, 0 (false) if the job is invalid. 
+ */
+_Bool des_jobq_submit(des_jobq *q, des_job *job) {
+    if (q == NULL || job == NULL)
+        return false;
+    if ((job->infd < 0) != (job->outfd < 0))
+        return false;           //both files, or both buffers
+    if (job->infd < 0 && (job->out == NULL ||
+            (job->in == NULL && job->inlen > 0)))
+        return false;
+
+    job->outlen = 0;
+    job->ok = false;
+    job->next = NULL;
+    pthread_mutex_lock(&q->lock);
+    if (q->pending_tail != NULL)
+        q->pending_tail->next = job;
+    else
+        q->pending = job;
+    q->pending_tail = job;
+    q->running++;
+    DES_PROBE2(job_submit, job, job->inlen);
+    pthread_cond_signal(&q->work);
+#ifdef DES_JOB_URING
+    if (q->idle == 0)
+        kick(q);                //every worker is busy, wake one from its ring
+#endif
+    pthread_mutex_unlock(&q->lock);
+    return true;
+}
+
+/**
+ * Waits for the next job to complete. Jobs complete in any order. 
+ *
+ * PARAMETERS: 
+ * q - the queue
+ *
+ * RETURNS: 
+ * The completed job, or NULL if no job is submitted or running. 
+ */
+des_job *des_jobq_wait(des_jobq *q) {
+    if (q == NULL)
+        return NULL;
+
+    pthread_mutex_lock(&q->lock);
+    while (q->done == NULL && q->running > 0)
+        pthread_cond_wait(&q->finish, &q->lock);
+    des_job *job = take_done(q);
+    pthread_mutex_unlock(&q->lock);
+    return job;
+}
+
+/**
+ * Returns the next completed job without waiting. 
+ *
+ * PARAMETERS: 
+ * q - the queue
+ *
+ * RETURNS: 
+ * The completed job, or NULL if no job has completed yet. 
+ */
+des_job *des_jobq_poll(des_jobq *q) {
+    if (q == NULL)
+        return NULL;
+
+    pthread_mutex_lock(&q->lock);
+    des_job *job = take_done(q);
+    pthread_mutex_unlock(&q->lock);
+    return job;
+}
+
+/**
+ * The worker thread function. Runs pending jobs until the queue stops, 
+ * many file jobs at once through the ring if it can be set up, otherwise 
+ * one job at a time. 
+ *
+ * PARAMETERS: 
+ * arg - the worker
+ *
+ * RETURNS: 
+ * NULL. 
+ */
+static void *worker(void *arg) {
+    Worker *w = arg;
+#ifdef DES_JOB_URING
+    _Bool uring = uring_setup(w);
+    pthread_mutex_lock(&w->q->lock);
+    w->uring = uring;
+    pthread_mutex_unlock(&w->q->lock);
+    if (uring) {
+        uring_loop(w);
+        uring_free(w);
+        return NULL;
+    }
+#endif
+
+    des_job *job;
+    while ((job = take_job(w, true)) != NULL) {
+        job->ok = run_job(job);
+        finish_job(w, job);
+    }
+    return NULL;
+}
+
+/**
+ * Takes the next pending job for the specified worker, waiting for one if 
+ * the worker has no job running. 
+ *
+ * PARAMETERS: 
+ * w     - the worker
+ * files - whether the worker can take a file job
+ *
+ * RETURNS: 
+ * The job, or NULL if there is none it can take, or if the queue stopped. 
+ */
+static des_job *take_job(Worker *w, _Bool files) {
+    des_jobq *q = w->q;
+    pthread_mutex_lock(&q->lock);
+    while (w->active == 0 && q->pending == NULL && !q->stop) {
+        q->idle++;
+        pthread_cond_wait(&q->work, &q->lock);
+        q->idle--;
+    }
+    des_job *job = q->pending;
+    if (job != NULL && !files && job->infd >= 0)
+        job = NULL;             //no room for another file job
+    if (job != NULL) {
+        q->pending = job->next;
+        if (q->pending == NULL)
+            q->pending_tail = NULL;
+        w->active++;
+    }
+    pthread_mutex_unlock(&q->lock);
+
+    if (job != NULL) {
+        job->next = NULL;
+        DES_PROBE1(job_start, job);
+    }
+    return job;
+}
+
+/**
+ * Moves the specified job of the worker to the complete jobs. 
+ *
+ * PARAMETERS: 
+ * w   - the worker
+ * job - the complete job
+ */
+static void finish_job(Worker *w, des_job *job) {
+    des_jobq *q = w->q;
+    DES_PROBE2(job_done, job, job->ok);
+    pthread_mutex_lock(&q->lock);
+    if (q->done_tail != NULL)
+        q->done_tail->next = job;
+    else
+        q->done = job;
+    q->done_tail = job;
+    q->running--;
+    w->active--;
+    pthread_cond_broadcast(&q->finish);
+    pthread_mutex_unlock(&q->lock);
+}
+
+/**
+ * Runs the specified job to completion on the calling thread, a buffer 
+ * job, or a file job through des_stream() without the ring. 
+ *
+ * PARAMETERS: 
+ * job - the job to run
+ *
+ * RETURNS: 
+ * 1 (true) if the job is successful, 0 (false) otherwise. 
+ */
+static _Bool run_job(des_job *job) {
+    if (job->infd < 0) {
+        size_t len = 0, fin = 0;
+        _Bool ok = des_mode_update(&job->ctx, job->out, &len, job->in,
+                job->inlen) && des_mode_final(&job->ctx, job->out + len, &fin);
+        job->outlen = len + fin;
+        return ok;
+    }
+
+    return des_stream(&job->ctx, NULL, job->infd, job->outfd);
+}
+
+/**
+ * Removes the first complete job of the queue. The lock must be held. 
+ *
+ * PARAMETERS: 
+ * q - the queue
+ *
+ * RETURNS: 
+ * The complete job, or NULL if there is none. 
+ */
+static des_job *take_done(des_jobq *q) {
+    des_job *job = q->done;
+    if (job != NULL) {
+        q->done = job->next;
+        if (q->done == NULL)
+            q->done_tail = NULL;
+        job->next = NULL;
+    }
+    return job;
+}
+
+
+#ifdef DES_JOB_URING
+/**
+ * Wakes the worker with the fewest jobs running that can take another, 
+ * through its wake event, as it may be blocked waiting for its ring. The 
+ * lock must be held. 
+ *
+ * PARAMETERS: 
+ * q - the queue
+ */
+static void kick(des_jobq *q) {
+    Worker *best = NULL;
+    for (size_t i = 0; i < q->nthreads; i++) {
+        Worker *w = &q->workers[i];
+        if (w->uring && !w->kicked && w->active < DES_JOB_DEPTH &&
+                (best == NULL || w->active < best->active))
+            best = w;
+    }
+    if (best != NULL) {
+        uint64_t one = 1;
+        best->kicked = true;
+        if (write(best->efd, &one, sizeof one) < 0)
+            best->kicked = false;
+    }
+}
+
+/**
+ * Sets up the ring and the wake event of the specified worker. Fails if 
+ * the kernel has no io_uring, or cannot read and write at the current file 
+ * position. 
+ *
+ * PARAMETERS: 
+ * w - the worker
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+static _Bool uring_setup(Worker *w) {
+    Ring *r = &w->ring;
+    struct io_uring_params p;
+    memset(&p, 0, sizeof p);
+    w->efd = -1;
+    r->fd = (int)syscall(__NR_io_uring_setup, RING_DEPTH, &p);
+    if (r->fd < 0)
+        return false;
+    if (!(p.features & IORING_FEAT_RW_CUR_POS)) {
+        close(r->fd);
+        return false;
+    }
+
+    r->sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    r->cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    r->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    r->sq_map = mmap(NULL, r->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+            r->fd, IORING_OFF_SQ_RING);
+    r->cq_map = mmap(NULL, r->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+            r->fd, IORING_OFF_CQ_RING);
+    r->sqes = mmap(NULL, r->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+            r->fd, IORING_OFF_SQES);
+    w->efd = eventfd(0, EFD_CLOEXEC);
+    if (r->sq_map == MAP_FAILED || r->cq_map == MAP_FAILED ||
+            r->sqes == MAP_FAILED || w->efd < 0) {
+        uring_free(w);
+        return false;
+    }
+
+    uint8_t *sq = r->sq_map, *cq = r->cq_map;
+    r->sq_tail = (unsigned *)(sq + p.sq_off.tail);
+    r->sq_mask = (unsigned *)(sq + p.sq_off.ring_mask);
+    r->sq_array = (unsigned *)(sq + p.sq_off.array);
+    r->cq_head = (unsigned *)(cq + p.cq_off.head);
+    r->cq_tail = (unsigned *)(cq + p.cq_off.tail);
+    r->cq_mask = (unsigned *)(cq + p.cq_off.ring_mask);
+    r->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+    r->queued = 0;
+    return true;
+}
+
+/**
+ * Frees the ring, the wake event and the buffers of the specified worker. 
+ *
+ * PARAMETERS: 
+ * w - the worker
+ */
+static void uring_free(Worker *w) {
+    Ring *r = &w->ring;
+    if (r->sq_map != NULL && r->sq_map != MAP_FAILED)
+        munmap(r->sq_map, r->sq_size);
+    if (r->cq_map != NULL && r->cq_map != MAP_FAILED)
+        munmap(r->cq_map, r->cq_size);
+    if (r->sqes != NULL && r->sqes != MAP_FAILED)
+        munmap(r->sqes, r->sqes_size);
+    close(r->fd);
+    if (w->efd >= 0)
+        close(w->efd);
+    for (int i = 0; i < DES_JOB_DEPTH; i++) {
+        for (int j = 0; j < 2; j++) {
+            free(w->slots[i].in[j]);
+            free(w->slots[i].out[j]);
+        }
+    }
+}
+
+/**
+ * Runs jobs on the ring until the queue stops. Up to DES_JOB_DEPTH file 
+ * jobs are in flight at once, and whichever request completes first is 
+ * handled first, so the reads and writes of some jobs overlap with the 
+ * encryption of others. Buffer jobs run straight away. The read of the 
+ * wake event completes when a job is submitted while the worker waits for 
+ * its ring. 
+ *
+ * PARAMETERS: 
+ * w - the worker
+ */
+static void uring_loop(Worker *w) {
+    Ring *r = &w->ring;
+    ring_queue(r, IORING_OP_READ, w->efd, &w->ebuf, sizeof w->ebuf,
+            TAG_WAKE);
+    for (;;) {
+        des_job *job = take_job(w, w->active < DES_JOB_DEPTH);
+        if (job == NULL && w->active == 0)
+            break;              //stopped with nothing left to do
+
+        if (job != NULL && (job->infd < 0 || !slot_start(w, job))) {
+            if (job->infd < 0)
+                job->ok = run_job(job);
+            finish_job(w, job);
+        }
+        if (w->active > 0)      //look for more jobs before blocking
+            ring_enter(w, job == NULL);
+    }
+}
+
+/**
+ * Starts the specified file job in a free slot of the worker, reading the 
+ * first buffer. The buffers of a slot are allocated on its first job and 
+ * kept for the next ones. 
+ *
+ * PARAMETERS: 
+ * w   - the worker
+ * job - the file job
+ *
+ * RETURNS: 
+ * 1 (true) if the job is started, 0 (false) if the buffers cannot be 
+ * allocated. 
+ */
+static _Bool slot_start(Worker *w, des_job *job) {
+    int i = 0;
+    while (w->slots[i].job != NULL)
+        i++;                    //a slot is free, the worker has room
+    Slot *s = &w->slots[i];
+    for (int j = 0; j < 2; j++) {
+        if (s->in[j] == NULL)
+            s->in[j] = malloc(DES_JOB_BUF);
+        if (s->out[j] == NULL)
+            s->out[j] = malloc(DES_JOB_BUF + 8);
+        if (s->in[j] == NULL || s->out[j] == NULL)
+            return false;
+    }
+
+    s->job = job;
+    s->cur = 0;
+    s->inlen = s->qlen = s->wlen = 0;
+    s->queued = s->wout = -1;
+    s->wbuf = NULL;
+    s->eof = s->final = s->failed = s->cancelled = false;
+    s->cancels = 0;
+    s->reading = true;
+    ring_queue(&w->ring, IORING_OP_READ, job->infd, s->in[0], DES_JOB_BUF,
+            ((uint64_t)i << TAG_BITS) | TAG_READ);
+    return true;
+}
+
+/**
+ * Moves the specified job on as far as it can go without waiting: 
+ * encrypts the buffer read while an output buffer is free, starting the 
+ * next read first, writes the output buffer waiting its turn, and 
+ * finishes the message once the input has ended. Completes the job once 
+ * nothing is left in flight, cancelling what is in flight if it failed, 
+ * so that the slot is reused only after its last request. 
+ *
+ * PARAMETERS: 
+ * w - the worker
+ * s - the slot of the job
+ */
+static void slot_advance(Worker *w, Slot *s) {
+    des_job *job = s->job;
+    uint64_t data = (uint64_t)(s - w->slots) << TAG_BITS;
+    while (!s->failed) {
+        if (s->inlen > 0 && s->queued < 0 && s->wout != s->cur) {
+            if (!s->eof) {      //in[cur ^ 1] is free, read the next buffer
+                ring_queue(&w->ring, IORING_OP_READ, job->infd,
+                        s->in[s->cur ^ 1], DES_JOB_BUF, data | TAG_READ);
+                s->reading = true;
+            }
+            size_t len = 0;
+            s->failed = !des_mode_update(&job->ctx, s->out[s->cur], &len,
+                    s->in[s->cur], s->inlen);
+            s->inlen = 0;
+            s->queued = s->cur;
+            s->qlen = len;
+            s->cur ^= 1;
+        } else if (s->queued >= 0 && s->wout < 0) {
+            if (s->qlen > 0) {
+                s->wout = s->queued;
+                s->wbuf = s->out[s->queued];
+                s->wlen = s->qlen;
+                ring_queue(&w->ring, IORING_OP_WRITE, job->outfd, s->wbuf,
+                        s->wlen, data | TAG_WRITE);
+            }
+            s->queued = -1;
+        } else if (s->eof && !s->reading && s->inlen == 0 &&
+                s->queued < 0 && s->wout < 0 && !s->final) {
+            size_t len = 0;
+            s->failed = !des_mode_final(&job->ctx, s->out[s->cur], &len);
+            s->final = true;
+            s->queued = s->cur;
+            s->qlen = len;
+        } else {
+            break;
+        }
+    }
+
+    if (s->failed && !s->cancelled) {
+        s->cancelled = true;    //a pipe may never complete on its own
+        for (int t = TAG_READ; t <= TAG_WRITE; t++) {
+            if (t == TAG_READ ? s->reading : s->wout >= 0) {
+                ring_queue(&w->ring, IORING_OP_ASYNC_CANCEL, -1,
+                        (void *)(uintptr_t)(data | (uint64_t)t), 0,
+                        data | TAG_CANCEL);
+                s->cancels++;
+            }
+        }
+    }
+    if (!s->reading && s->wout < 0 && s->cancels == 0 && (s->failed ||
+            (s->final && s->queued < 0))) {
+        job->ok = !s->failed;
+        s->job = NULL;
+        finish_job(w, job);
+    }
+}
+
+/**
+ * Handles a completed request of the specified slot, then moves its job 
+ * on. 
+ *
+ * PARAMETERS: 
+ * w   - the worker
+ * s   - the slot of the request
+ * tag - the kind of request
+ * res - the result of the request, the number of bytes or a negative errno
+ */
+static void slot_complete(Worker *w, Slot *s, int tag, int res) {
+    uint64_t data = (uint64_t)(s - w->slots) << TAG_BITS;
+    if (tag == TAG_READ) {
+        s->reading = false;
+        if (!s->failed) {       //otherwise the job is over, cancelled or not
+            if (res == -EINTR || res == -EAGAIN) {
+                ring_queue(&w->ring, IORING_OP_READ, s->job->infd,
+                        s->in[s->cur], DES_JOB_BUF, data | TAG_READ);
+                s->reading = true;
+            } else if (res <= 0) {
+                s->failed = res < 0;
+                s->eof = true;  //read error, or end of input
+            } else {
+                s->inlen = (size_t)res;
+            }
+        }
+    } else if (tag == TAG_WRITE) {
+        if (res == -EINTR || res == -EAGAIN)
+            res = 0;
+        else if (res <= 0)
+            s->failed = true;
+        s->wbuf += (res > 0 ? res : 0);
+        s->wlen -= (res > 0 ? (size_t)res : 0);
+        if (s->failed || s->wlen == 0)
+            s->wout = -1;
+        else                    //a short write, write the rest
+            ring_queue(&w->ring, IORING_OP_WRITE, s->job->outfd, s->wbuf,
+                    s->wlen, data | TAG_WRITE);
+    } else {
+        s->cancels--;
+    }
+    slot_advance(w, s);
+}
+
+/**
+ * Queues a request to submit on the next ring_enter(). Reads and writes 
+ * are at the current file position. 
+ *
+ * PARAMETERS: 
+ * r    - the ring
+ * op   - the io_uring operation
+ * fd   - the file descriptor, or -1 for a cancel
+ * buf  - the buffer to read into or write from, or the request to cancel
+ * len  - the number of bytes
+ * data - the user data of the request, its slot and kind
+ */
+static void ring_queue(Ring *r, int op, int fd, const void *buf, size_t len,
+        uint64_t data) {
+    unsigned tail = *r->sq_tail;
+    unsigned i = tail & *r->sq_mask;
+    struct io_uring_sqe *sqe = &r->sqes[i];
+    memset(sqe, 0, sizeof *sqe);
+    sqe->opcode = (uint8_t)op;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)buf;
+    sqe->len = (uint32_t)len;
+    if (op != IORING_OP_ASYNC_CANCEL)
+        sqe->off = (uint64_t)-1;    //the current file position
+    sqe->user_data = data;
+    r->sq_array[i] = i;
+    __atomic_store_n(r->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    r->queued++;
+}
+
+/**
+ * Submits the queued requests and handles every completed request, 
+ * waiting for at least one to complete if asked to. 
+ *
+ * PARAMETERS: 
+ * w    - the worker
+ * wait - whether to wait for a completion
+ */
+static void ring_enter(Worker *w, _Bool wait) {
+    Ring *r = &w->ring;
+    for (;;) {
+        long n = syscall(__NR_io_uring_enter, r->fd, r->queued,
+                (wait ? 1 : 0), (wait ? IORING_ENTER_GETEVENTS : 0), NULL, 0);
+        if (n >= 0) {
+            r->queued -= (unsigned)n;
+            break;
+        }
+        if (errno != EINTR)
+            break;              //busy, handle the completions first
+    }
+
+    unsigned head = *r->cq_head;
+    while (head != __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE)) {
+        struct io_uring_cqe *cqe = &r->cqes[head & *r->cq_mask];
+        uint64_t data = cqe->user_data;
+        int res = cqe->res;
+        __atomic_store_n(r->cq_head, ++head, __ATOMIC_RELEASE);
+
+        int tag = (int)(data & ((1u << TAG_BITS) - 1));
+        if (tag == TAG_WAKE) {
+            pthread_mutex_lock(&w->q->lock);
+            w->kicked = false;
+            pthread_mutex_unlock(&w->q->lock);
+            ring_queue(r, IORING_OP_READ, w->efd, &w->ebuf, sizeof w->ebuf,
+                    TAG_WAKE);
+        } else {
+            slot_complete(w, &w->slots[data >> TAG_BITS], tag, res);
+        }
+    }
+}
+#endif
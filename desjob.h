@@ -0,0 +1,115 @@
+/**
+ * FILE:   desjob.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Asynchronous encryption jobs. Buffers and files are submitted to a queue 
+ * served by a fixed set of worker threads, and collected once complete. 
+ * On Linux every worker keeps up to DES_JOB_DEPTH file jobs in flight on 
+ * its own io_uring, handling whichever read or write completes first, so 
+ * the I/O of some jobs overlaps with the encryption of others. Other 
+ * systems, or kernels without io_uring, run one job at a time per worker 
+ * through des_stream(). Building with DES_NO_URING always uses the 
+ * fallback. 
+ *
+ * C99, POSIX threads
+ */
+
+#ifndef __desjob_h__
+#define __desjob_h__
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "desmode.h"
+
+/**
+ * The size of every I/O buffer of a worker. 
+ */
+#define DES_JOB_BUF (256 << 10)
+
+/**
+ * The most file jobs a worker has in flight at once on its ring. 
+ */
+#define DES_JOB_DEPTH 8
+
+/**
+ * A queue of jobs, served by a fixed set of worker threads. 
+ */
+typedef struct des_jobq des_jobq;
+
+/**
+ * An encryption job. Initialise the context with des_mode_init() or 
+ * tdes_mode_init(), so the key is expanded once for the whole job, then 
+ * fill either the buffers or the file descriptors. The job must stay 
+ * alive until it is returned by des_jobq_wait() or des_jobq_poll(). 
+ */
+typedef struct des_job {
+    des_mode_ctx ctx;           //the context, holding the key schedule
+    const uint8_t *in;          //input buffer, when infd is -1
+    size_t inlen;               //number of input bytes
+    uint8_t *out;               //output buffer, room for inlen + 16 bytes
+    size_t outlen;              //bytes written to the output buffer
+    int infd;                   //input file, or -1 for the buffer
+    int outfd;                  //output file, or -1 for the buffer
+    void *user;                 //caller data, not used by the queue
+    _Bool ok;                   //whether the job succeeded
+    struct des_job *next;       //used by the queue
+} des_job;
+
+/**
+ * Creates a queue with the specified number of worker threads. If the 
+ * number is 0, one worker is started for every online CPU. The queue must 
+ * be freed with des_jobq_free(). 
+ *
+ * PARAMETERS: 
+ * nthreads - the number of worker threads, or 0 for every CPU
+ *
+ * RETURNS: 
+ * The new queue, or NULL if any error occurred. 
+ */
+des_jobq *des_jobq_new(size_t nthreads);
+
+/**
+ * Waits for every submitted job to finish, stops the worker threads and 
+ * frees the specified queue. Jobs not collected yet are left as they are. 
+ *
+ * PARAMETERS: 
+ * q - the queue to free
+ */
+void des_jobq_free(des_jobq *q);
+
+/**
+ * Submits the specified job to the queue, returning straight away. 
+ *
+ * PARAMETERS: 
+ * q   - the queue
+ * job - the job to run
+ *
+ * RETURNS: 
+ * 1 (true) if the job is queued, 0 (false) if the job is invalid. 
+ */
+_Bool des_jobq_submit(des_jobq *q, des_job *job);
+
+/**
+ * Waits for the next job to complete. Jobs complete in any order. 
+ *
+ * PARAMETERS: 
+ * q - the queue
+ *
+ * RETURNS: 
+ * The completed job, or NULL if no job is submitted or running. 
+ */
+des_job *des_jobq_wait(des_jobq *q);
+
+/**
+ * Returns the next completed job without waiting. 
+ *
+ * PARAMETERS: 
+ * q - the queue
+ *
+ * RETURNS: 
+ * The completed job, or NULL if no job has completed yet. 
+ */
+des_job *des_jobq_poll(des_jobq *q);
+
+#endif
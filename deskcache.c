@@ -0,0 +1,327 @@
+/**
+ * FILE:   deskcache.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * A cache of expanded key schedules, keyed by the raw 64-bit key. Callers 
+ * passing the same few keys again and again, like the bit string API, 
+ * skip the key schedule on a hit. The cache is a fixed set-associative 
+ * table evicting the least recently used key of a set. Lookups take no 
+ * lock, every entry is guarded by a sequence counter instead. A hit only 
+ * reads shared memory: the counters belong to the calling thread and are 
+ * added up on read, and the stamp of an entry is refreshed only once it 
+ * falls behind by STAMP_SLACK misses. 
+ *
+ * C99, POSIX threads
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+#include <pthread.h>
+#include "deskcache.h"
+
+#define NSETS (DES_KCACHE_SIZE / DES_KCACHE_WAYS)
+#define PARITY_CLEAR 0xfefefefefefefefeULL      //bit 8 of every key byte
+#define LINE 64                 //the size of a cache line
+#define STAMP_SLACK (NSETS / 4 + 1)     //misses before a hit restamps
+
+/**
+ * A cached key schedule, alone on its cache lines. Readers copy it without 
+ * a lock, then check that the sequence did not change meanwhile. 
+ */
+typedef struct Entry {
+    unsigned seq;           //odd while the entry is written
+    uint64_t tag;           //key without parity, bit 0 set, 0 if empty
+    uint64_t k48[16];       //the subkeys
+} __attribute__((aligned(LINE))) Entry;
+
+/**
+ * A set of entries. The lock and the stamps, written by misses and by the 
+ * occasional restamp, are kept off the cache lines of the entries. Only 
+ * writers take the lock. 
+ */
+typedef struct Set {
+    Entry e[DES_KCACHE_WAYS];
+    unsigned char lock __attribute__((aligned(LINE)));  //held by a writer
+    uint64_t stamp[DES_KCACHE_WAYS];    //the clock when last used
+} Set;
+
+/**
+ * The counters of a thread, in the list of every thread that used the 
+ * cache. Only the owning thread writes the counters. 
+ */
+typedef struct Counters {
+    uint64_t hits;          //lookups served from the cache
+    uint64_t misses;        //lookups that expanded the key
+    uint64_t evictions;     //keys replaced by another key
+    struct Counters *prev;  //previous thread in the list
+    struct Counters *next;  //next thread in the list
+} __attribute__((aligned(LINE))) Counters;
+
+static Set sets[NSETS];                 //the cache
+static uint64_t clock_now __attribute__((aligned(LINE))) = 1;  //per miss
+
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+static pthread_key_t exit_key;          //retires the counters on exit
+static pthread_mutex_t list_lock = PTHREAD_MUTEX_INITIALIZER;  //guards below
+static Counters *threads = NULL;        //counters of the running threads
+static Counters retired;                //counters of the exited threads
+static Counters base;                   //the sum at the last clear
+static __thread Counters *local = NULL; //counters of this thread
+
+static _Bool read_entry(Entry *e, uint64_t tag, des_key_schedule *ks);
+static void write_entry(Entry *e, uint64_t tag, const uint64_t *k48);
+static size_t set_index(uint64_t tag);
+static void init(void);
+static Counters *counters(void);
+static void retire(void *arg);
+static void sum(Counters *c);
+static void bump(uint64_t *c);
+
+/**
+ * Stores the key schedule of the specified key, from the cache if the key 
+ * is in it, otherwise expanding the key and adding it to the cache. Keys 
+ * differing only in their parity bits share an entry. Safe to call from 
+ * any thread, and never waits for another thread. 
+ *
+ * PARAMETERS: 
+ * ks  - the key schedule to store the subkeys
+ * k64 - the 64-bit key
+ */
+void des_kcache_setup(des_key_schedule *ks, uint64_t k64) {
+    uint64_t tag = (k64 & PARITY_CLEAR) | 1;
+    Set *s = &sets[set_index(tag)];
+    Counters *c = counters();
+    for (int i = 0; i < DES_KCACHE_WAYS; i++) {
+        if (read_entry(&s->e[i], tag, ks)) {
+            uint64_t now = __atomic_load_n(&clock_now, __ATOMIC_RELAXED);
+            if (now - __atomic_load_n(&s->stamp[i], __ATOMIC_RELAXED) >=
+                    STAMP_SLACK)
+                __atomic_store_n(&s->stamp[i], now, __ATOMIC_RELAXED);
+            if (c != NULL)
+                bump(&c->hits);
+            return;
+        }
+    }
+
+    if (c != NULL)
+        bump(&c->misses);
+    des_key_setup(ks, k64);
+    uint64_t now = __atomic_add_fetch(&clock_now, 1, __ATOMIC_RELAXED);
+    if (__atomic_test_and_set(&s->lock, __ATOMIC_ACQUIRE))
+        return;                 //another thread is writing, skip adding
+
+    int victim = 0;
+    for (int i = 0; i < DES_KCACHE_WAYS; i++) {
+        uint64_t t = s->e[i].tag;
+        if (t == tag) {
+            victim = -1;        //added by a racing thread
+            break;
+        }
+        if (s->e[victim].tag != 0 && (t == 0 ||
+                __atomic_load_n(&s->stamp[i], __ATOMIC_RELAXED) <
+                __atomic_load_n(&s->stamp[victim], __ATOMIC_RELAXED)))
+            victim = i;         //an empty entry, or used longer ago
+    }
+    if (victim >= 0) {
+        if (s->e[victim].tag != 0 && c != NULL)
+            bump(&c->evictions);
+        write_entry(&s->e[victim], tag, ks->k48);
+        __atomic_store_n(&s->stamp[victim], now, __ATOMIC_RELAXED);
+    }
+    __atomic_clear(&s->lock, __ATOMIC_RELEASE);
+}
+
+/**
+ * Stores the counters of the cache, the sum of the counters of every 
+ * thread. The counters are updated without a lock, so they are a snapshot 
+ * while other threads use the cache. 
+ *
+ * PARAMETERS: 
+ * st - the counters to fill
+ */
+void des_kcache_stats_get(des_kcache_stats *st) {
+    if (st == NULL)
+        return;
+
+    Counters total = {0};
+    pthread_mutex_lock(&list_lock);
+    sum(&total);
+    st->hits = total.hits - base.hits;
+    st->misses = total.misses - base.misses;
+    st->evictions = total.evictions - base.evictions;
+    pthread_mutex_unlock(&list_lock);
+    st->entries = 0;
+    st->size = NSETS * DES_KCACHE_WAYS;
+    for (size_t i = 0; i < NSETS; i++)
+        for (int j = 0; j < DES_KCACHE_WAYS; j++)
+            st->entries += (__atomic_load_n(&sets[i].e[j].tag,
+                    __ATOMIC_RELAXED) != 0);
+}
+
+/**
+ * Removes every key from the cache and resets the counters. 
+ */
+void des_kcache_clear(void) {
+    static const uint64_t zero[16] = {0};
+    for (size_t i = 0; i < NSETS; i++) {
+        Set *s = &sets[i];
+        while (__atomic_test_and_set(&s->lock, __ATOMIC_ACQUIRE))
+            ;                   //wait for the writer of the set
+        for (int j = 0; j < DES_KCACHE_WAYS; j++) {
+            if (s->e[j].tag != 0)
+                write_entry(&s->e[j], 0, zero);
+            __atomic_store_n(&s->stamp[j], 0, __ATOMIC_RELAXED);
+        }
+        __atomic_clear(&s->lock, __ATOMIC_RELEASE);
+    }
+
+    pthread_mutex_lock(&list_lock);
+    memset(&base, 0, sizeof base);
+    sum(&base);
+    pthread_mutex_unlock(&list_lock);
+}
+
+/**
+ * Copies the subkeys of the specified entry if it holds the specified key. 
+ * Fails without waiting if the entry is being written. 
+ *
+ * PARAMETERS: 
+ * e   - the entry to read
+ * tag - the key without parity, bit 0 set
+ * ks  - the key schedule to store the subkeys
+ *
+ * RETURNS: 
+ * 1 (true) if the key schedule is copied, 0 (false) otherwise. 
+ */
+static _Bool read_entry(Entry *e, uint64_t tag, des_key_schedule *ks) {
+    unsigned seq = __atomic_load_n(&e->seq, __ATOMIC_ACQUIRE);
+    if ((seq & 1) || __atomic_load_n(&e->tag, __ATOMIC_RELAXED) != tag)
+        return false;
+    for (int i = 0; i < 16; i++)
+        ks->k48[i] = __atomic_load_n(&e->k48[i], __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&e->seq, __ATOMIC_RELAXED) == seq;
+}
+
+/**
+ * Writes the specified entry. The lock of its set must be held. 
+ *
+ * PARAMETERS: 
+ * e     - the entry to write
+ * tag   - the key without parity, bit 0 set, or 0 to empty the entry
+ * k48   - the 16 subkeys
+ */
+static void write_entry(Entry *e, uint64_t tag, const uint64_t *k48) {
+    unsigned seq = __atomic_load_n(&e->seq, __ATOMIC_RELAXED);
+    __atomic_store_n(&e->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&e->tag, tag, __ATOMIC_RELAXED);
+    for (int i = 0; i < 16; i++)
+        __atomic_store_n(&e->k48[i], k48[i], __ATOMIC_RELAXED);
+    __atomic_store_n(&e->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+/**
+ * Returns the set of the specified key. 
+ *
+ * PARAMETERS: 
+ * tag - the key without parity, bit 0 set
+ *
+ * RETURNS: 
+ * The index of the set. 
+ */
+static size_t set_index(uint64_t tag) {
+    return (size_t)((tag * 0x9e3779b97f4a7c15ULL) >> 32) % NSETS;
+}
+
+/**
+ * Creates the key retiring the counters of exiting threads. 
+ */
+static void init(void) {
+    pthread_key_create(&exit_key, &retire);
+}
+
+/**
+ * Returns the counters of the calling thread, adding them to the list of 
+ * every thread on first use. The counters get cache lines of their own, 
+ * so counting never touches a line another thread writes. 
+ *
+ * RETURNS: 
+ * The counters, or NULL if they cannot be allocated. 
+ */
+static Counters *counters(void) {
+    if (local != NULL)
+        return local;
+    pthread_once(&once, &init);
+    void *mem;
+    if (posix_memalign(&mem, LINE, sizeof(Counters)) != 0)
+        return NULL;
+    Counters *c = memset(mem, 0, sizeof *c);
+
+    pthread_mutex_lock(&list_lock);
+    c->next = threads;
+    if (threads != NULL)
+        threads->prev = c;
+    threads = c;
+    pthread_mutex_unlock(&list_lock);
+    pthread_setspecific(exit_key, c);
+    local = c;
+    return c;
+}
+
+/**
+ * Adds the counters of an exiting thread to the retired counters, then 
+ * frees them. 
+ *
+ * PARAMETERS: 
+ * arg - the counters of the thread
+ */
+static void retire(void *arg) {
+    Counters *c = arg;
+    pthread_mutex_lock(&list_lock);
+    retired.hits += c->hits;
+    retired.misses += c->misses;
+    retired.evictions += c->evictions;
+    if (c->prev != NULL)
+        c->prev->next = c->next;
+    else
+        threads = c->next;
+    if (c->next != NULL)
+        c->next->prev = c->prev;
+    pthread_mutex_unlock(&list_lock);
+    local = NULL;
+    free(c);
+}
+
+/**
+ * Adds up the counters of the running and the exited threads into the 
+ * specified counters, reading them atomically as their threads may be 
+ * updating them. The list lock must be held. 
+ *
+ * PARAMETERS: 
+ * c - the counters to add to
+ */
+static void sum(Counters *c) {
+    c->hits += retired.hits;
+    c->misses += retired.misses;
+    c->evictions += retired.evictions;
+    for (const Counters *t = threads; t != NULL; t = t->next) {
+        c->hits += __atomic_load_n(&t->hits, __ATOMIC_RELAXED);
+        c->misses += __atomic_load_n(&t->misses, __ATOMIC_RELAXED);
+        c->evictions += __atomic_load_n(&t->evictions, __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ * Adds 1 to a counter of the calling thread. Only the owning thread writes 
+ * the counter, so a plain load and store is enough, atomic only so that a 
+ * reader never sees a torn value. 
+ *
+ * PARAMETERS: 
+ * c - the counter
+ */
+static void bump(uint64_t *c) {
+    __atomic_store_n(c, __atomic_load_n(c, __ATOMIC_RELAXED) + 1,
+            __ATOMIC_RELAXED);
+}
@@ -0,0 +1,75 @@
+/**
+ * FILE:   deskcache.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * A cache of expanded key schedules, keyed by the raw 64-bit key. Callers 
+ * passing the same few keys again and again, like the bit string API, 
+ * skip the key schedule on a hit. The cache is a fixed set-associative 
+ * table evicting the least recently used key of a set. Lookups take no 
+ * lock, every entry is guarded by a sequence counter instead. A hit only 
+ * reads shared memory: the counters belong to the calling thread and are 
+ * added up on read, and the stamp of an entry used for eviction is only 
+ * refreshed once many misses have passed. 
+ *
+ * C99, POSIX threads
+ */
+
+#ifndef __deskcache_h__
+#define __deskcache_h__
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "des.h"
+
+/**
+ * The most key schedules kept in the cache, a multiple of DES_KCACHE_WAYS. 
+ */
+#ifndef DES_KCACHE_SIZE
+#define DES_KCACHE_SIZE 1024
+#endif
+
+/**
+ * The number of keys sharing a set, the set of a key is picked by its hash. 
+ */
+#define DES_KCACHE_WAYS 4
+
+/**
+ * The counters of the cache, since start or the last des_kcache_clear(). 
+ */
+typedef struct des_kcache_stats {
+    uint64_t hits;          //lookups served from the cache
+    uint64_t misses;        //lookups that expanded the key
+    uint64_t evictions;     //keys replaced by another key
+    size_t entries;         //keys currently in the cache
+    size_t size;            //the most keys kept, DES_KCACHE_SIZE
+} des_kcache_stats;
+
+/**
+ * Stores the key schedule of the specified key, from the cache if the key 
+ * is in it, otherwise expanding the key and adding it to the cache. Keys 
+ * differing only in their parity bits share an entry. Safe to call from 
+ * any thread, and never waits for another thread. 
+ *
+ * PARAMETERS: 
+ * ks  - the key schedule to store the subkeys
+ * k64 - the 64-bit key
+ */
+void des_kcache_setup(des_key_schedule *ks, uint64_t k64);
+
+/**
+ * Stores the counters of the cache, the sum of the counters of every 
+ * thread. The counters are updated without a lock, so they are a snapshot 
+ * while other threads use the cache. 
+ *
+ * PARAMETERS: 
+ * st - the counters to fill
+ */
+void des_kcache_stats_get(des_kcache_stats *st);
+
+/**
+ * Removes every key from the cache and resets the counters. 
+ */
+void des_kcache_clear(void);
+
+#endif
@@ -0,0 +1,214 @@
+/**
+ * FILE:   deskey.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Command line front end for des_search_run(), recovering the DES key of 
+ * a known plain text and cipher text pair. 
+ *
+ *     deskey [-c ct2] [-p part/parts] [-k bits] [-t threads] [-s file]
+ *            pt ct
+ *     deskey [-t threads] -r file
+ *
+ * The blocks are 16 hex digits. With -c the cipher text of the complement 
+ * of pt is also known, halving the search. -p searches one of several 
+ * partitions, for several machines, and -k sets the chunk size to 2 ^ bits 
+ * keys, 30 by default; every partition must use the same chunk size. -t 
+ * sets the number of threads, 0 for every CPU. The progress is printed 
+ * every second and, with -s, saved to the checkpoint file, also when the 
+ * search is interrupted. -r resumes a search from its checkpoint file. 
+ *
+ * C99, POSIX
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <unistd.h>
+#include "dessearch.h"
+
+static volatile sig_atomic_t interrupted = 0;   //set by SIGINT and SIGTERM
+
+static void on_signal(int sig);
+static _Bool report(const des_search *s, const des_search_stats *st,
+        void *user);
+static _Bool parse_hex(const char *str, uint64_t *v);
+static int usage(const char *prog);
+
+/**
+ * Parses the arguments, then searches for the key. 
+ *
+ * PARAMETERS: 
+ * argc - the number of arguments
+ * argv - the arguments
+ *
+ * RETURNS: 
+ * 0 if the key is found, 1 otherwise. 
+ */
+int main(int argc, char **argv) {
+    const char *ct2 = NULL, *part = NULL, *save = NULL, *resume = NULL;
+    long bits = 30, threads = 0;
+
+    int opt;
+    char *end;
+    while ((opt = getopt(argc, argv, "c:p:k:t:s:r:")) != -1) {
+        switch (opt) {
+        case 'c':
+            ct2 = optarg;
+            break;
+        case 'p':
+            part = optarg;
+            break;
+        case 'k':
+            bits = strtol(optarg, &end, 10);
+            if (end == optarg || *end != '\0')
+                return usage(argv[0]);
+            break;
+        case 't':
+            threads = strtol(optarg, &end, 10);
+            if (end == optarg || *end != '\0')
+                return usage(argv[0]);
+            break;
+        case 's':
+            save = optarg;
+            break;
+        case 'r':
+            resume = optarg;
+            break;
+        default:
+            return usage(argv[0]);
+        }
+    }
+    if (bits < 6 || bits > 55 || threads < 0)
+        return usage(argv[0]);
+
+    des_search s;
+    des_search_init(&s, 0, 0);
+    if (resume != NULL) {
+        if (argc != optind || ct2 != NULL || part != NULL)
+            return usage(argv[0]);
+        if (!des_search_load(&s, resume)) {
+            fprintf(stderr, "%s: cannot resume from %s\n", argv[0], resume);
+            return 1;
+        }
+        save = resume;
+    } else {
+        if (argc - optind != 2 || !parse_hex(argv[optind], &s.pt) ||
+                !parse_hex(argv[optind + 1], &s.ct))
+            return usage(argv[0]);
+        if (ct2 != NULL) {
+            if (!parse_hex(ct2, &s.ct2))
+                return usage(argv[0]);
+            s.comp = true;
+        }
+        s.chunk = s.stride = (uint64_t)1 << bits;
+        uint64_t i = 0, n = 1;
+        int len = 0;
+        if (part != NULL && (sscanf(part, "%" SCNu64 "/%" SCNu64 "%n", &i,
+                &n, &len) != 2 || part[len] != '\0' ||
+                !des_search_partition(&s, i, n)))
+            return usage(argv[0]);
+    }
+    s.threads = (size_t)threads;
+    s.checkpoint = save;
+    s.report = &report;
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof sa);
+    sa.sa_handler = &on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    uint64_t key = 0;
+    des_search_stats st;
+    _Bool found = des_search_run(&s, &key, &st);
+    fprintf(stderr, "%" PRIu64 " keys in %.1f s, %.0f keys/s\n", st.tested,
+            st.seconds, st.keys_per_sec);
+    if (found) {
+        printf("%016" PRIx64 "\n", key);
+        return 0;
+    }
+    if (interrupted)
+        fprintf(stderr, "%s: stopped at chunk %" PRIu64 " of %" PRIu64 "\n",
+                argv[0], st.next, st.total);
+    else
+        fprintf(stderr, "%s: key not in this partition\n", argv[0]);
+    return 1;
+}
+
+/**
+ * Asks the search to stop, it is saved to the checkpoint file first. 
+ *
+ * PARAMETERS: 
+ * sig - the signal
+ */
+static void on_signal(int sig) {
+    (void)sig;
+    interrupted = 1;
+}
+
+/**
+ * Prints the progress of the search. 
+ *
+ * PARAMETERS: 
+ * s    - the search
+ * st   - the progress
+ * user - not used
+ *
+ * RETURNS: 
+ * 1 (true) to continue, 0 (false) once interrupted. 
+ */
+static _Bool report(const des_search *s, const des_search_stats *st,
+        void *user) {
+    (void)s;
+    (void)user;
+    fprintf(stderr, "chunk %" PRIu64 "/%" PRIu64 ", %.2f%%, %.0f keys/s\n",
+            st->next, st->total, 100.0 * (double)st->next / (double)st->total,
+            st->keys_per_sec);
+    return !interrupted;
+}
+
+/**
+ * Parses 16 hex digits into a 64-bit block. 
+ *
+ * PARAMETERS: 
+ * str - the hex digits
+ * v   - the block to store the result
+ *
+ * RETURNS: 
+ * 1 (true) if the string is 16 valid digits, 0 (false) otherwise. 
+ */
+static _Bool parse_hex(const char *str, uint64_t *v) {
+    if (strlen(str) != 16)
+        return false;
+    uint64_t r = 0;
+    for (int i = 0; i < 16; i++) {
+        char c = str[i];
+        int d = (c >= '0' && c <= '9' ? c - '0' :
+                c >= 'a' && c <= 'f' ? c - 'a' + 10 :
+                c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1);
+        if (d < 0)
+            return false;
+        r = (r << 4) | (uint64_t)d;
+    }
+    *v = r;
+    return true;
+}
+
+/**
+ * Prints the usage of the program. 
+ *
+ * PARAMETERS: 
+ * prog - the name of the program
+ *
+ * RETURNS: 
+ * 1, the exit status for bad arguments. 
+ */
+static int usage(const char *prog) {
+    fprintf(stderr, "usage: %s [-c ct2] [-p part/parts] [-k bits] "
+            "[-t threads] [-s file] pt ct\n"
+            "       %s [-t threads] -r file\n", prog, prog);
+    return 1;
+}
@@ -0,0 +1,560 @@
+/**
+ * FILE:   desmode.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Modes of operation for the DES and triple DES ciphers, encrypting 
+ * messages of any length through a streaming context. 
+ *
+ * C99
+ */
+
+#include "desmode.h"
+#include "desbs.h"
+#include "desstats.h"
+#include "desprobe.h"
+
+/**
+ * The number of blocks loaded at a time, parallel modes pass them to the 
+ * batch functions together. 
+ */
+#define MODE_CHUNK 512
+
+static _Bool mode_init(des_mode_ctx *ctx, des_mode mode, _Bool dec,
+        uint64_t iv, _Bool pad);
+static size_t block_update(des_mode_ctx *ctx, uint8_t *out, const uint8_t *in,
+        size_t inlen);
+static size_t stream_update(des_mode_ctx *ctx, uint8_t *out, const uint8_t *in,
+        size_t inlen);
+static uint8_t stream_byte(des_mode_ctx *ctx, uint8_t in);
+static void crypt_blocks(des_mode_ctx *ctx, uint8_t *out, const uint8_t *in,
+        size_t n);
+static void crypt_chunk(des_mode_ctx *ctx, uint64_t *out, uint64_t *in,
+        size_t n);
+static _Bool ecb_bytes(uint8_t *out, const uint8_t *in, size_t n,
+        des_mode_ctx *ctx, _Bool dec);
+static uint64_t enc_block(const des_mode_ctx *ctx, uint64_t block);
+static void enc_batch(const des_mode_ctx *ctx, uint64_t *out,
+        const uint64_t *in, size_t n);
+static void dec_batch(const des_mode_ctx *ctx, uint64_t *out,
+        const uint64_t *in, size_t n);
+
+/**
+ * Initialises the specified context. The IV is ignored in ECB mode, and is 
+ * the initial counter in CTR mode. Padding only applies to ECB and CBC, 
+ * the other modes encrypt any length without padding. 
+ *
+ * PARAMETERS: 
+ * ctx  - the context to initialise
+ * mode - the mode of operation
+ * dec  - whether to decrypt instead of encrypt
+ * k64  - the 64-bit key
+ * iv   - the 64-bit initialisation vector
+ * pad  - whether to use PKCS#5 padding
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_mode_init(des_mode_ctx *ctx, des_mode mode, _Bool dec, uint64_t k64,
+        uint64_t iv, _Bool pad) {
+    if (!mode_init(ctx, mode, dec, iv, pad))
+        return false;
+
+    des_key_setup(&ctx->ks.ks[0], k64);
+    ctx->triple = false;
+    return true;
+}
+
+/**
+ * Initialises the specified context for triple DES. For 2-key triple DES 
+ * k3 is the same as k1. The IV is ignored in ECB mode, and is the initial 
+ * counter in CTR mode. Padding only applies to ECB and CBC, the other 
+ * modes encrypt any length without padding. 
+ *
+ * PARAMETERS: 
+ * ctx  - the context to initialise
+ * mode - the mode of operation
+ * dec  - whether to decrypt instead of encrypt
+ * k1   - the 64-bit key of the first stage
+ * k2   - the 64-bit key of the second stage
+ * k3   - the 64-bit key of the third stage
+ * iv   - the 64-bit initialisation vector
+ * pad  - whether to use PKCS#5 padding
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool tdes_mode_init(des_mode_ctx *ctx, des_mode mode, _Bool dec, uint64_t k1,
+        uint64_t k2, uint64_t k3, uint64_t iv, _Bool pad) {
+    if (!mode_init(ctx, mode, dec, iv, pad))
+        return false;
+
+    tdes_key_setup(&ctx->ks, k1, k2, k3);
+    ctx->triple = true;
+    return true;
+}
+
+/**
+ * Encrypts or decrypts the specified bytes. The output must have room for 
+ * inlen + 8 bytes, as partial blocks from earlier calls are completed. 
+ * The output may be the same as the input in CFB, OFB and CTR mode, or 
+ * when no partial block is held from an earlier call. 
+ *
+ * PARAMETERS: 
+ * ctx    - the context
+ * out    - the output bytes
+ * outlen - the number of bytes written to the output
+ * in     - the input bytes
+ * inlen  - the number of input bytes
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_mode_update(des_mode_ctx *ctx, uint8_t *out, size_t *outlen,
+        const uint8_t *in, size_t inlen) {
+    if (ctx == NULL || outlen == NULL)
+        return false;
+    *outlen = 0;
+    if (inlen == 0)
+        return true;
+    if (in == NULL || out == NULL)
+        return false;
+
+    DES_STAT_BYTES(ctx->mode, inlen);
+    DES_PROBE3(mode_start, (int)ctx->mode, ctx->dec, inlen);
+    if (ctx->mode == DES_ECB || ctx->mode == DES_CBC)
+        *outlen = block_update(ctx, out, in, inlen);
+    else
+        *outlen = stream_update(ctx, out, in, inlen);
+    DES_PROBE2(mode_done, (int)ctx->mode, *outlen);
+    return true;
+}
+
+/**
+ * Finishes the message, writing the padded last block when encrypting or 
+ * the unpadded last block when decrypting. The output must have room for 
+ * 8 bytes. Fails if the message length does not fit the mode, or if the 
+ * padding of a decrypted message is invalid. 
+ *
+ * PARAMETERS: 
+ * ctx    - the context
+ * out    - the output bytes
+ * outlen - the number of bytes written to the output
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_mode_final(des_mode_ctx *ctx, uint8_t *out, size_t *outlen) {
+    if (ctx == NULL || outlen == NULL)
+        return false;
+    *outlen = 0;
+    if (ctx->mode != DES_ECB && ctx->mode != DES_CBC)
+        return true;        //stream modes have nothing left
+    if (!ctx->pad)
+        return ctx->buflen == 0;
+    if (out == NULL)
+        return false;
+
+    if (!ctx->dec) {
+        uint8_t n = (uint8_t)(8 - ctx->buflen);     //always 1 to 8 bytes
+        memset(ctx->buf + ctx->buflen, n, n);
+        crypt_blocks(ctx, out, ctx->buf, 1);
+        ctx->buflen = 0;
+        *outlen = 8;
+        return true;
+    }
+
+    if (ctx->buflen != 8)
+        return false;       //cipher text is not whole blocks
+    uint8_t block[8];
+    crypt_blocks(ctx, block, ctx->buf, 1);
+    ctx->buflen = 0;
+    uint8_t n = block[7];
+    if (n == 0 || n > 8)
+        return false;
+    for (int i = 8 - n; i < 8; i++)
+        if (block[i] != n)
+            return false;   //bad padding
+
+    memcpy(out, block, 8 - n);
+    *outlen = 8 - n;
+    return true;
+}
+
+/**
+ * Encrypts the specified bytes with DES in ECB mode, loading every 8 bytes 
+ * as a big endian block. No bit strings or padding are involved, the 
+ * number of bytes must be a multiple of 8. The output may be the same as 
+ * the input. 
+ *
+ * PARAMETERS: 
+ * out - the cipher text bytes
+ * in  - the bytes to encrypt
+ * n   - the number of bytes
+ * ks  - the key schedule
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_encrypt_bytes(uint8_t *out, const uint8_t *in, size_t n,
+        const des_key_schedule *ks) {
+    des_mode_ctx ctx;
+    if (ks != NULL)
+        ctx.ks.ks[0] = *ks;
+    ctx.triple = false;
+    return ks != NULL && ecb_bytes(out, in, n, &ctx, false);
+}
+
+/**
+ * Decrypts the specified bytes with DES in ECB mode, loading every 8 bytes 
+ * as a big endian block. No bit strings or padding are involved, the 
+ * number of bytes must be a multiple of 8. The output may be the same as 
+ * the input. 
+ *
+ * PARAMETERS: 
+ * out - the plain text bytes
+ * in  - the bytes to decrypt
+ * n   - the number of bytes
+ * ks  - the key schedule
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_decrypt_bytes(uint8_t *out, const uint8_t *in, size_t n,
+        const des_key_schedule *ks) {
+    des_mode_ctx ctx;
+    if (ks != NULL)
+        ctx.ks.ks[0] = *ks;
+    ctx.triple = false;
+    return ks != NULL && ecb_bytes(out, in, n, &ctx, true);
+}
+
+/**
+ * Encrypts the specified bytes with triple DES in ECB mode, loading every 
+ * 8 bytes as a big endian block. No bit strings or padding are involved, 
+ * the number of bytes must be a multiple of 8. The output may be the same 
+ * as the input. 
+ *
+ * PARAMETERS: 
+ * out - the cipher text bytes
+ * in  - the bytes to encrypt
+ * n   - the number of bytes
+ * ks  - the triple DES key schedule
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool tdes_encrypt_bytes(uint8_t *out, const uint8_t *in, size_t n,
+        const tdes_key_schedule *ks) {
+    des_mode_ctx ctx;
+    if (ks != NULL)
+        ctx.ks = *ks;
+    ctx.triple = true;
+    return ks != NULL && ecb_bytes(out, in, n, &ctx, false);
+}
+
+/**
+ * Decrypts the specified bytes with triple DES in ECB mode, loading every 
+ * 8 bytes as a big endian block. No bit strings or padding are involved, 
+ * the number of bytes must be a multiple of 8. The output may be the same 
+ * as the input. 
+ *
+ * PARAMETERS: 
+ * out - the plain text bytes
+ * in  - the bytes to decrypt
+ * n   - the number of bytes
+ * ks  - the triple DES key schedule
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool tdes_decrypt_bytes(uint8_t *out, const uint8_t *in, size_t n,
+        const tdes_key_schedule *ks) {
+    des_mode_ctx ctx;
+    if (ks != NULL)
+        ctx.ks = *ks;
+    ctx.triple = true;
+    return ks != NULL && ecb_bytes(out, in, n, &ctx, true);
+}
+
+/**
+ * Encrypts or decrypts whole blocks of bytes in ECB mode, with the key 
+ * already in the context. 
+ *
+ * PARAMETERS: 
+ * out - the output bytes
+ * in  - the input bytes
+ * n   - the number of bytes, a multiple of 8
+ * ctx - the context holding the key
+ * dec - whether to decrypt
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+static _Bool ecb_bytes(uint8_t *out, const uint8_t *in, size_t n,
+        des_mode_ctx *ctx, _Bool dec) {
+    if (n % 8 != 0 || (n > 0 && (in == NULL || out == NULL)))
+        return false;
+
+    mode_init(ctx, DES_ECB, dec, 0, false);
+    DES_STAT_BYTES(DES_ECB, n);
+    crypt_blocks(ctx, out, in, n / 8);
+    return true;
+}
+
+/**
+ * Initialises the specified context, except for the key. 
+ *
+ * PARAMETERS: 
+ * ctx  - the context to initialise
+ * mode - the mode of operation
+ * dec  - whether to decrypt instead of encrypt
+ * iv   - the 64-bit initialisation vector
+ * pad  - whether to use PKCS#5 padding
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+static _Bool mode_init(des_mode_ctx *ctx, des_mode mode, _Bool dec,
+        uint64_t iv, _Bool pad) {
+    if (ctx == NULL || mode < DES_ECB || mode > DES_CTR)
+        return false;
+
+    ctx->mode = mode;
+    ctx->dec = dec;
+    ctx->pad = pad && (mode == DES_ECB || mode == DES_CBC);
+    ctx->iv = iv;
+    ctx->buflen = 0;
+    return true;
+}
+
+/**
+ * Passes the specified bytes through a block mode (ECB or CBC), keeping 
+ * any partial block for the next call. When decrypting with padding, the 
+ * last whole block is also kept, as it may hold the padding. 
+ *
+ * PARAMETERS: 
+ * ctx   - the context
+ * out   - the output bytes
+ * in    - the input bytes
+ * inlen - the number of input bytes
+ *
+ * RETURNS: 
+ * The number of bytes written to the output. 
+ */
+static size_t block_update(des_mode_ctx *ctx, uint8_t *out, const uint8_t *in,
+        size_t inlen) {
+    size_t n = (ctx->buflen + inlen) / 8;
+    if (ctx->dec && ctx->pad && (ctx->buflen + inlen) % 8 == 0)
+        n--;                //keep the last block for des_mode_final()
+
+    size_t written = 0;
+    if (n > 0 && ctx->buflen > 0) {
+        size_t fill = 8 - ctx->buflen;      //complete the partial block
+        memcpy(ctx->buf + ctx->buflen, in, fill);
+        crypt_blocks(ctx, out, ctx->buf, 1);
+        ctx->buflen = 0;
+        in += fill;
+        inlen -= fill;
+        out += 8;
+        written += 8;
+        n--;
+    }
+
+    crypt_blocks(ctx, out, in, n);
+    written += 8 * n;
+    memcpy(ctx->buf + ctx->buflen, in + 8 * n, inlen - 8 * n);
+    ctx->buflen += inlen - 8 * n;
+    return written;
+}
+
+/**
+ * Passes the specified bytes through a stream mode (CFB, OFB or CTR). The 
+ * key stream left over from earlier calls is used first, whole blocks are 
+ * then processed together. 
+ *
+ * PARAMETERS: 
+ * ctx   - the context
+ * out   - the output bytes
+ * in    - the input bytes
+ * inlen - the number of input bytes
+ *
+ * RETURNS: 
+ * The number of bytes written to the output. 
+ */
+static size_t stream_update(des_mode_ctx *ctx, uint8_t *out, const uint8_t *in,
+        size_t inlen) {
+    size_t i = 0;
+    for (; i < inlen && ctx->buflen != 0; i++)
+        out[i] = stream_byte(ctx, in[i]);
+
+    size_t n = (inlen - i) / 8;
+    crypt_blocks(ctx, out + i, in + i, n);
+    for (i += 8 * n; i < inlen; i++)
+        out[i] = stream_byte(ctx, in[i]);
+    return inlen;
+}
+
+/**
+ * Passes a single byte through a stream mode. A new block of key stream 
+ * is made when the current one is used up. In CFB mode the cipher text 
+ * bytes replace the key stream, and become the next feedback register. 
+ *
+ * PARAMETERS: 
+ * ctx - the context
+ * in  - the input byte
+ *
+ * RETURNS: 
+ * The output byte. 
+ */
+static uint8_t stream_byte(des_mode_ctx *ctx, uint8_t in) {
+    if (ctx->buflen == 0) {
+        if (ctx->mode == DES_OFB)
+            ctx->iv = enc_block(ctx, ctx->iv);
+        des_store64(ctx->buf, (ctx->mode == DES_OFB ?
+                ctx->iv : enc_block(ctx, ctx->iv)));
+        if (ctx->mode == DES_CTR)
+            ctx->iv++;
+    }
+
+    uint8_t out = in ^ ctx->buf[ctx->buflen];
+    if (ctx->mode == DES_CFB)
+        ctx->buf[ctx->buflen] = (ctx->dec ? in : out);
+    if (++ctx->buflen == 8) {
+        if (ctx->mode == DES_CFB)
+            ctx->iv = des_load64(ctx->buf);
+        ctx->buflen = 0;
+    }
+    return out;
+}
+
+/**
+ * Encrypts or decrypts whole blocks of bytes, a chunk of blocks at a time. 
+ *
+ * PARAMETERS: 
+ * ctx - the context
+ * out - the output bytes
+ * in  - the input bytes
+ * n   - the number of blocks
+ */
+static void crypt_blocks(des_mode_ctx *ctx, uint8_t *out, const uint8_t *in,
+        size_t n) {
+    uint64_t blocks[MODE_CHUNK], result[MODE_CHUNK];
+    while (n > 0) {
+        size_t m = (n < MODE_CHUNK ? n : MODE_CHUNK);
+        for (size_t i = 0; i < m; i++)
+            blocks[i] = des_load64(in + 8 * i);
+        crypt_chunk(ctx, result, blocks, m);
+        for (size_t i = 0; i < m; i++)
+            des_store64(out + 8 * i, result[i]);
+        in += 8 * m;
+        out += 8 * m;
+        n -= m;
+    }
+}
+
+/**
+ * Encrypts or decrypts a chunk of blocks in the mode of the context. ECB, 
+ * CBC decryption and CTR pass the whole chunk to the batch functions, the 
+ * other modes chain one block to the next. 
+ *
+ * PARAMETERS: 
+ * ctx - the context
+ * out - the output blocks
+ * in  - the input blocks, may be overwritten
+ * n   - the number of blocks
+ */
+static void crypt_chunk(des_mode_ctx *ctx, uint64_t *out, uint64_t *in,
+        size_t n) {
+    switch (ctx->mode) {
+    case DES_ECB:
+        if (ctx->dec)
+            dec_batch(ctx, out, in, n);
+        else
+            enc_batch(ctx, out, in, n);
+        break;
+    case DES_CBC:
+        if (ctx->dec) {
+            dec_batch(ctx, out, in, n);
+            out[0] ^= ctx->iv;
+            for (size_t i = 1; i < n; i++)
+                out[i] ^= in[i - 1];
+            ctx->iv = in[n - 1];
+        } else {
+            for (size_t i = 0; i < n; i++)
+                out[i] = ctx->iv = enc_block(ctx, in[i] ^ ctx->iv);
+        }
+        break;
+    case DES_CFB:
+        for (size_t i = 0; i < n; i++) {
+            out[i] = in[i] ^ enc_block(ctx, ctx->iv);
+            ctx->iv = (ctx->dec ? in[i] : out[i]);
+        }
+        break;
+    case DES_OFB:
+        for (size_t i = 0; i < n; i++) {
+            ctx->iv = enc_block(ctx, ctx->iv);
+            out[i] = in[i] ^ ctx->iv;
+        }
+        break;
+    case DES_CTR:
+        for (size_t i = 0; i < n; i++)
+            out[i] = ctx->iv++;
+        enc_batch(ctx, out, out, n);
+        for (size_t i = 0; i < n; i++)
+            out[i] ^= in[i];
+        break;
+    }
+}
+
+/**
+ * Encrypts a single block with the DES or triple DES key of the context. 
+ *
+ * PARAMETERS: 
+ * ctx   - the context
+ * block - the block to encrypt
+ *
+ * RETURNS: 
+ * The encrypted block. 
+ */
+static uint64_t enc_block(const des_mode_ctx *ctx, uint64_t block) {
+    if (ctx->triple)
+        return tdes_enc_block(block, &ctx->ks);
+    return des_enc_block(block, &ctx->ks.ks[0]);
+}
+
+/**
+ * Encrypts a batch of blocks with the DES or triple DES key of the 
+ * context. 
+ *
+ * PARAMETERS: 
+ * ctx - the context
+ * out - the encrypted blocks
+ * in  - the blocks to encrypt
+ * n   - the number of blocks
+ */
+static void enc_batch(const des_mode_ctx *ctx, uint64_t *out,
+        const uint64_t *in, size_t n) {
+    if (ctx->triple)
+        tdes_enc_batch(out, in, n, &ctx->ks);
+    else
+        des_enc_batch(out, in, n, &ctx->ks.ks[0]);
+}
+
+/**
+ * Decrypts a batch of blocks with the DES or triple DES key of the 
+ * context. 
+ *
+ * PARAMETERS: 
+ * ctx - the context
+ * out - the decrypted blocks
+ * in  - the blocks to decrypt
+ * n   - the number of blocks
+ */
+static void dec_batch(const des_mode_ctx *ctx, uint64_t *out,
+        const uint64_t *in, size_t n) {
+    if (ctx->triple)
+        tdes_dec_batch(out, in, n, &ctx->ks);
+    else
+        des_dec_batch(out, in, n, &ctx->ks.ks[0]);
+}
@@ -0,0 +1,195 @@
+/**
+ * FILE:   desmode.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Modes of operation for the DES and triple DES ciphers, encrypting 
+ * messages of any length through a streaming context. 
+ *
+ * C99
+ */
+
+#ifndef __desmode_h__
+#define __desmode_h__
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "des.h"
+
+/**
+ * The supported modes of operation. 
+ */
+typedef enum des_mode {
+    DES_ECB,        //electronic codebook
+    DES_CBC,        //cipher block chaining
+    DES_CFB,        //64-bit cipher feedback
+    DES_OFB,        //output feedback
+    DES_CTR         //counter, 64-bit big endian counter
+} des_mode;
+
+/**
+ * A streaming mode of operation context, for DES or triple DES. The key 
+ * schedule is expanded once in des_mode_init() or tdes_mode_init(), then 
+ * any number of bytes can be passed through des_mode_update() before 
+ * des_mode_final(). 
+ */
+typedef struct des_mode_ctx {
+    tdes_key_schedule ks;   //expanded keys, DES only uses the first
+    _Bool triple;           //whether to use triple DES
+    des_mode mode;          //mode of operation
+    _Bool dec;              //whether to decrypt
+    _Bool pad;              //whether to use PKCS#5 padding, ECB and CBC only
+    uint64_t iv;            //chaining block, feedback register or counter
+    uint8_t buf[8];         //partial block, or key stream of stream modes
+    size_t buflen;          //bytes in buf, or key stream bytes used
+} des_mode_ctx;
+
+/**
+ * Initialises the specified context. The IV is ignored in ECB mode, and is 
+ * the initial counter in CTR mode. Padding only applies to ECB and CBC, 
+ * the other modes encrypt any length without padding. 
+ *
+ * PARAMETERS: 
+ * ctx  - the context to initialise
+ * mode - the mode of operation
+ * dec  - whether to decrypt instead of encrypt
+ * k64  - the 64-bit key
+ * iv   - the 64-bit initialisation vector
+ * pad  - whether to use PKCS#5 padding
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_mode_init(des_mode_ctx *ctx, des_mode mode, _Bool dec, uint64_t k64,
+        uint64_t iv, _Bool pad);
+
+/**
+ * Initialises the specified context for triple DES. For 2-key triple DES 
+ * k3 is the same as k1. The IV is ignored in ECB mode, and is the initial 
+ * counter in CTR mode. Padding only applies to ECB and CBC, the other 
+ * modes encrypt any length without padding. 
+ *
+ * PARAMETERS: 
+ * ctx  - the context to initialise
+ * mode - the mode of operation
+ * dec  - whether to decrypt instead of encrypt
+ * k1   - the 64-bit key of the first stage
+ * k2   - the 64-bit key of the second stage
+ * k3   - the 64-bit key of the third stage
+ * iv   - the 64-bit initialisation vector
+ * pad  - whether to use PKCS#5 padding
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool tdes_mode_init(des_mode_ctx *ctx, des_mode mode, _Bool dec, uint64_t k1,
+        uint64_t k2, uint64_t k3, uint64_t iv, _Bool pad);
+
+/**
+ * Encrypts or decrypts the specified bytes. The output must have room for 
+ * inlen + 8 bytes, as partial blocks from earlier calls are completed. 
+ * The output may be the same as the input in CFB, OFB and CTR mode, or 
+ * when no partial block is held from an earlier call. 
+ *
+ * PARAMETERS: 
+ * ctx    - the context
+ * out    - the output bytes
+ * outlen - the number of bytes written to the output
+ * in     - the input bytes
+ * inlen  - the number of input bytes
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_mode_update(des_mode_ctx *ctx, uint8_t *out, size_t *outlen,
+        const uint8_t *in, size_t inlen);
+
+/**
+ * Finishes the message, writing the padded last block when encrypting or 
+ * the unpadded last block when decrypting. The output must have room for 
+ * 8 bytes. Fails if the message length does not fit the mode, or if the 
+ * padding of a decrypted message is invalid. 
+ *
+ * PARAMETERS: 
+ * ctx    - the context
+ * out    - the output bytes
+ * outlen - the number of bytes written to the output
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_mode_final(des_mode_ctx *ctx, uint8_t *out, size_t *outlen);
+
+/**
+ * Encrypts the specified bytes with DES in ECB mode, loading every 8 bytes 
+ * as a big endian block. No bit strings or padding are involved, the 
+ * number of bytes must be a multiple of 8. The output may be the same as 
+ * the input. 
+ *
+ * PARAMETERS: 
+ * out - the cipher text bytes
+ * in  - the bytes to encrypt
+ * n   - the number of bytes
+ * ks  - the key schedule
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_encrypt_bytes(uint8_t *out, const uint8_t *in, size_t n,
+        const des_key_schedule *ks);
+
+/**
+ * Decrypts the specified bytes with DES in ECB mode, loading every 8 bytes 
+ * as a big endian block. No bit strings or padding are involved, the 
+ * number of bytes must be a multiple of 8. The output may be the same as 
+ * the input. 
+ *
+ * PARAMETERS: 
+ * out - the plain text bytes
+ * in  - the bytes to decrypt
+ * n   - the number of bytes
+ * ks  - the key schedule
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_decrypt_bytes(uint8_t *out, const uint8_t *in, size_t n,
+        const des_key_schedule *ks);
+
+/**
+ * Encrypts the specified bytes with triple DES in ECB mode, loading every 
+ * 8 bytes as a big endian block. No bit strings or padding are involved, 
+ * the number of bytes must be a multiple of 8. The output may be the same 
+ * as the input. 
+ *
+ * PARAMETERS: 
+ * out - the cipher text bytes
+ * in  - the bytes to encrypt
+ * n   - the number of bytes
+ * ks  - the triple DES key schedule
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool tdes_encrypt_bytes(uint8_t *out, const uint8_t *in, size_t n,
+        const tdes_key_schedule *ks);
+
+/**
+ * Decrypts the specified bytes with triple DES in ECB mode, loading every 
+ * 8 bytes as a big endian block. No bit strings or padding are involved, 
+ * the number of bytes must be a multiple of 8. The output may be the same 
+ * as the input. 
+ *
+ * PARAMETERS: 
+ * out - the plain text bytes
+ * in  - the bytes to decrypt
+ * n   - the number of bytes
+ * ks  - the triple DES key schedule
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool tdes_decrypt_bytes(uint8_t *out, const uint8_t *in, size_t n,
+        const tdes_key_schedule *ks);
+
+#endif
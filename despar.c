@@ -0,0 +1,378 @@
+/**
+ * FILE:   despar.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Multi-threaded bulk encryption for the parallel modes of operation. The 
+ * input is split into chunks that are spread across a pool of worker 
+ * threads, idle workers steal chunks from busy ones. 
+ *
+ * C99, POSIX threads
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#include <unistd.h>
+#include "despar.h"
+#include "desprobe.h"
+
+/**
+ * Task function pointer, runs a single task of a job. 
+ */
+typedef void (*TaskFunc)(void *arg, size_t task);
+
+/**
+ * A worker thread of a pool, with the tasks left to it from next up to 
+ * but not including end. 
+ */
+typedef struct Worker {
+    pthread_t thread;           //the worker thread
+    struct des_pool *pool;      //the pool of the worker
+    size_t id;                  //index of the worker in the pool
+    pthread_mutex_t lock;       //guards next and end
+    size_t next;                //next task to run
+    size_t end;                 //end of the tasks left
+} Worker;
+
+/**
+ * A pool of worker threads, running one job of many tasks at a time. 
+ */
+struct des_pool {
+    Worker *workers;            //worker threads
+    size_t nthreads;            //number of worker threads
+    pthread_mutex_t run;        //held while a job runs
+    pthread_mutex_t lock;       //guards the fields below
+    pthread_cond_t work;        //signalled when a job starts
+    pthread_cond_t done;        //signalled when a job finishes
+    TaskFunc func;              //task function of the job
+    void *arg;                  //argument of the task function
+    unsigned long job;          //job number, increased every job
+    size_t active;              //workers still running the job
+    _Bool stop;                 //whether the workers should exit
+};
+
+/**
+ * A chunk of a parallel mode job. 
+ */
+typedef struct Chunk {
+    size_t start;               //first block of the chunk
+    size_t count;               //number of blocks in the chunk
+    uint64_t iv;                //chaining block or counter of the chunk
+} Chunk;
+
+/**
+ * A parallel mode job, every task encrypts or decrypts one chunk. 
+ */
+typedef struct ModeJob {
+    const des_mode_ctx *ctx;    //context at the start of the job
+    Chunk *chunks;              //chunks of the job
+    uint8_t *out;               //output bytes
+    const uint8_t *in;          //input bytes
+} ModeJob;
+
+static void *worker(void *arg);
+static _Bool take(Worker *self, size_t *task);
+static _Bool steal(Worker *self, size_t *task);
+static void pool_run(des_pool *pool, TaskFunc func, void *arg, size_t ntasks);
+static void mode_task(void *arg, size_t task);
+
+/**
+ * Creates a pool with the specified number of worker threads. If the 
+ * number is 0, one worker is started for every online CPU. The pool must 
+ * be freed with des_pool_free(). 
+ *
+ * PARAMETERS: 
+ * nthreads - the number of worker threads, or 0 for every CPU
+ *
+ * RETURNS: 
+ * The new pool, or NULL if any error occurred. 
+ */
+des_pool *des_pool_new(size_t nthreads) {
+    if (nthreads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = (cpus > 0 ? (size_t)cpus : 1);
+    }
+
+    des_pool *pool = calloc(1, sizeof *pool);
+    if (pool == NULL)
+        return NULL;
+    pool->workers = calloc(nthreads, sizeof *pool->workers);
+    if (pool->workers == NULL) {
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->run, NULL);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    for (size_t i = 0; i < nthreads; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].id = i;
+        pthread_mutex_init(&pool->workers[i].lock, NULL);
+    }
+    for (pool->nthreads = 0; pool->nthreads < nthreads; pool->nthreads++) {
+        Worker *w = &pool->workers[pool->nthreads];
+        if (pthread_create(&w->thread, NULL, &worker, w) != 0)
+            break;
+    }
+
+    for (size_t i = pool->nthreads; i < nthreads; i++)
+        pthread_mutex_destroy(&pool->workers[i].lock);
+    if (pool->nthreads == 0) {
+        des_pool_free(pool);    //no thread could be started
+        return NULL;
+    }
+    return pool;
+}
+
+/**
+ * Stops the worker threads and frees the specified pool. 
+ *
+ * PARAMETERS: 
+ * pool - the pool to free
+ */
+void des_pool_free(des_pool *pool) {
+    if (pool == NULL)
+        return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+    for (size_t i = 0; i < pool->nthreads; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+        pthread_mutex_destroy(&pool->workers[i].lock);
+    }
+
+    pthread_mutex_destroy(&pool->run);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->work);
+    pthread_cond_destroy(&pool->done);
+    free(pool->workers);
+    free(pool);
+}
+
+/**
+ * Encrypts or decrypts the specified bytes like des_mode_update(), with 
+ * the whole blocks spread across the pool. ECB, CBC decryption and CTR 
+ * run in parallel, other modes and partial blocks run on the calling 
+ * thread. The output is the same as des_mode_update(), and the context 
+ * can be used afterwards to continue the message. The output may be the 
+ * same as the input whenever des_mode_update() allows it. 
+ *
+ * PARAMETERS: 
+ * pool   - the pool to run on
+ * ctx    - the context
+ * out    - the output bytes, room for inlen + 8 bytes
+ * outlen - the number of bytes written to the output
+ * in     - the input bytes
+ * inlen  - the number of input bytes
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_mode_parallel(des_pool *pool, des_mode_ctx *ctx, uint8_t *out,
+        size_t *outlen, const uint8_t *in, size_t inlen) {
+    if (pool == NULL || ctx == NULL || outlen == NULL)
+        return false;
+    *outlen = 0;
+    if (inlen > 0 && (in == NULL || out == NULL))
+        return false;
+
+    size_t n = inlen / 8;
+    if (ctx->pad && ctx->dec && inlen % 8 == 0 && n > 0)
+        n--;                //des_mode_update() keeps the padding block
+    _Bool parallel = ctx->buflen == 0 && (ctx->mode == DES_ECB ||
+            ctx->mode == DES_CTR || (ctx->mode == DES_CBC && ctx->dec));
+    if (!parallel || n <= DES_PAR_CHUNK)
+        return des_mode_update(ctx, out, outlen, in, inlen);
+
+    size_t nchunks = (n + DES_PAR_CHUNK - 1) / DES_PAR_CHUNK;
+    Chunk *chunks = malloc(nchunks * (sizeof *chunks));
+    if (chunks == NULL)
+        return false;
+    DES_PROBE3(parallel_start, (int)ctx->mode, inlen, nchunks);
+
+    for (size_t i = 0; i < nchunks; i++) {
+        chunks[i].start = i * DES_PAR_CHUNK;
+        chunks[i].count = (i + 1 < nchunks ? DES_PAR_CHUNK :
+                n - chunks[i].start);
+        if (ctx->mode == DES_CTR)
+            chunks[i].iv = ctx->iv + chunks[i].start;
+        else if (ctx->mode == DES_CBC && i > 0)     //read before overwritten
+            chunks[i].iv = des_load64(in + 8 * (chunks[i].start - 1));
+        else
+            chunks[i].iv = ctx->iv;
+    }
+
+    uint64_t next = ctx->iv;
+    if (ctx->mode == DES_CTR)
+        next = ctx->iv + n;                 //counter after the whole blocks
+    else if (ctx->mode == DES_CBC)
+        next = des_load64(in + 8 * (n - 1));    //last cipher text block
+    ModeJob job = { ctx, chunks, out, in };
+    pool_run(pool, &mode_task, &job, nchunks);
+    free(chunks);
+
+    ctx->iv = next;
+    size_t rest = 0;
+    _Bool ok = des_mode_update(ctx, out + 8 * n, &rest, in + 8 * n,
+            inlen - 8 * n);
+    *outlen = 8 * n + rest;
+    DES_PROBE2(parallel_done, (int)ctx->mode, *outlen);
+    return ok;
+}
+
+/**
+ * The worker thread function. Waits for a job, then runs tasks from its 
+ * own range, and steals from other workers once its range is empty. 
+ *
+ * PARAMETERS: 
+ * arg - the worker
+ *
+ * RETURNS: 
+ * NULL. 
+ */
+static void *worker(void *arg) {
+    Worker *self = arg;
+    des_pool *pool = self->pool;
+    unsigned long seen = 0;     //no job runs before the pool is returned
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (!pool->stop && pool->job == seen)
+            pthread_cond_wait(&pool->work, &pool->lock);
+        if (pool->stop) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        seen = pool->job;
+        TaskFunc func = pool->func;
+        void *farg = pool->arg;
+        pthread_mutex_unlock(&pool->lock);
+
+        size_t task;
+        while (take(self, &task) || steal(self, &task)) {
+            DES_PROBE2(task_start, self->id, task);
+            func(farg, task);
+            DES_PROBE2(task_done, self->id, task);
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->active == 0)
+            pthread_cond_signal(&pool->done);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+/**
+ * Takes the next task from the front of the tasks left to a worker. 
+ *
+ * PARAMETERS: 
+ * self - the worker
+ * task - the task taken
+ *
+ * RETURNS: 
+ * 1 (true) if a task is taken, 0 (false) if no task is left. 
+ */
+static _Bool take(Worker *self, size_t *task) {
+    pthread_mutex_lock(&self->lock);
+    _Bool found = self->next < self->end;
+    if (found)
+        *task = self->next++;
+    pthread_mutex_unlock(&self->lock);
+    return found;
+}
+
+/**
+ * Steals half of the tasks left to another worker, taken from the back of 
+ * its tasks. The first stolen task is returned, the rest are left to the 
+ * stealing worker. 
+ *
+ * PARAMETERS: 
+ * self - the stealing worker
+ * task - the task taken
+ *
+ * RETURNS: 
+ * 1 (true) if a task is stolen, 0 (false) if no worker has tasks left. 
+ */
+static _Bool steal(Worker *self, size_t *task) {
+    des_pool *pool = self->pool;
+    for (size_t i = 1; i < pool->nthreads; i++) {
+        Worker *victim = &pool->workers[(self->id + i) % pool->nthreads];
+        pthread_mutex_lock(&victim->lock);
+        size_t left = victim->end - victim->next;
+        if (left == 0) {
+            pthread_mutex_unlock(&victim->lock);
+            continue;
+        }
+
+        size_t from = victim->end - (left + 1) / 2;
+        size_t end = victim->end;
+        victim->end = from;
+        pthread_mutex_unlock(&victim->lock);
+        DES_PROBE3(task_steal, self->id, victim->id, end - from);
+
+        pthread_mutex_lock(&self->lock);
+        self->next = from + 1;
+        self->end = end;
+        pthread_mutex_unlock(&self->lock);
+        *task = from;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Runs the specified job on the pool and waits for it to finish. The tasks 
+ * are split evenly between the workers to start with. 
+ *
+ * PARAMETERS: 
+ * pool   - the pool to run on
+ * func   - the task function
+ * arg    - the argument of the task function
+ * ntasks - the number of tasks
+ */
+static void pool_run(des_pool *pool, TaskFunc func, void *arg, size_t ntasks) {
+    pthread_mutex_lock(&pool->run);
+    DES_PROBE2(pool_run, ntasks, pool->nthreads);   //after any earlier job
+    for (size_t i = 0; i < pool->nthreads; i++) {
+        Worker *w = &pool->workers[i];
+        pthread_mutex_lock(&w->lock);
+        w->next = ntasks * i / pool->nthreads;
+        w->end = ntasks * (i + 1) / pool->nthreads;
+        pthread_mutex_unlock(&w->lock);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->func = func;
+    pool->arg = arg;
+    pool->active = pool->nthreads;
+    pool->job++;
+    pthread_cond_broadcast(&pool->work);
+    while (pool->active > 0)
+        pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+    DES_PROBE1(pool_done, ntasks);
+    pthread_mutex_unlock(&pool->run);
+}
+
+/**
+ * Encrypts or decrypts a single chunk of a parallel mode job, with a copy 
+ * of the context starting at the chaining block or counter of the chunk. 
+ *
+ * PARAMETERS: 
+ * arg  - the parallel mode job
+ * task - the chunk to run
+ */
+static void mode_task(void *arg, size_t task) {
+    const ModeJob *job = arg;
+    const Chunk *chunk = &job->chunks[task];
+    des_mode_ctx ctx = *job->ctx;
+    ctx.iv = chunk->iv;
+    ctx.pad = false;        //padding is left to the calling thread
+
+    size_t len = 0;
+    des_mode_update(&ctx, job->out + 8 * chunk->start, &len,
+            job->in + 8 * chunk->start, 8 * chunk->count);
+}
@@ -0,0 +1,74 @@
+/**
+ * FILE:   despar.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Multi-threaded bulk encryption for the parallel modes of operation. The 
+ * input is split into chunks that are spread across a pool of worker 
+ * threads, idle workers steal chunks from busy ones. 
+ *
+ * C99, POSIX threads
+ */
+
+#ifndef __despar_h__
+#define __despar_h__
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "desmode.h"
+
+/**
+ * The number of blocks in a chunk, the unit of work given to a worker. 
+ */
+#define DES_PAR_CHUNK 4096
+
+/**
+ * A pool of worker threads. Only one job runs on a pool at a time, jobs 
+ * from different threads wait for each other. 
+ */
+typedef struct des_pool des_pool;
+
+/**
+ * Creates a pool with the specified number of worker threads. If the 
+ * number is 0, one worker is started for every online CPU. The pool must 
+ * be freed with des_pool_free(). 
+ *
+ * PARAMETERS: 
+ * nthreads - the number of worker threads, or 0 for every CPU
+ *
+ * RETURNS: 
+ * The new pool, or NULL if any error occurred. 
+ */
+des_pool *des_pool_new(size_t nthreads);
+
+/**
+ * Stops the worker threads and frees the specified pool. 
+ *
+ * PARAMETERS: 
+ * pool - the pool to free
+ */
+void des_pool_free(des_pool *pool);
+
+/**
+ * Encrypts or decrypts the specified bytes like des_mode_update(), with 
+ * the whole blocks spread across the pool. ECB, CBC decryption and CTR 
+ * run in parallel, other modes and partial blocks run on the calling 
+ * thread. The output is the same as des_mode_update(), and the context 
+ * can be used afterwards to continue the message. The output may be the 
+ * same as the input whenever des_mode_update() allows it. 
+ *
+ * PARAMETERS: 
+ * pool   - the pool to run on
+ * ctx    - the context
+ * out    - the output bytes, room for inlen + 8 bytes
+ * outlen - the number of bytes written to the output
+ * in     - the input bytes
+ * inlen  - the number of input bytes
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_mode_parallel(des_pool *pool, des_mode_ctx *ctx, uint8_t *out,
+        size_t *outlen, const uint8_t *in, size_t inlen);
+
+#endif
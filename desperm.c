@@ -0,0 +1,261 @@
+/**
+ * FILE:   desperm.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Compiled bit permutations. A permutation table in the style of the DES 
+ * tables is compiled once into byte-indexed lookup tables and PEXT/PDEP 
+ * masks, then applied to packed blocks. The masks are used when the active 
+ * backend enables BMI2. 
+ *
+ * C99
+ */
+
+#include <string.h>
+#include <stddef.h>
+#include "desperm.h"
+#include "descpu.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DES_PERM_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * A cached permutation, kept in a list that only grows. An invalid table 
+ * is kept without the compiled permutation, so it is never compiled again. 
+ */
+typedef struct CacheEntry {
+    struct CacheEntry *next;    //next entry of the list
+    uint64_t hash;              //hash of the table
+    size_t len;                 //length of the table
+    size_t inlen;               //number of input bits
+    int p[64];                  //the table
+    _Bool valid;                //whether the table compiles
+    des_perm pm;                //the compiled permutation, if valid
+} CacheEntry;
+
+static CacheEntry *cache = NULL;        //head of the cache list
+static unsigned cache_count = 0;        //entries in the cache
+
+static _Bool table_valid(const int p[], size_t len, size_t inlen);
+static int find_groups(des_perm *pm, const int p[], size_t len);
+static uint64_t table_hash(const int p[], size_t len, size_t inlen);
+#ifdef DES_PERM_X86
+static uint64_t pext_apply(const des_perm *pm, uint64_t in);
+#endif
+
+/**
+ * Compiles the specified permutation table. Entry i of the table is the 
+ * input bit that becomes output bit i + 1, counting from 1 at the most 
+ * significant bit like the DES tables. Entries may repeat, as in the 
+ * expansion table. 
+ *
+ * PARAMETERS: 
+ * pm    - the compiled permutation to fill
+ * p     - the permutation mapping
+ * len   - the length of the permutation mapping, up to 64
+ * inlen - the number of input bits, up to 64
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) if the table is 
+ * invalid. 
+ */
+_Bool des_perm_compile(des_perm *pm, const int p[], size_t len, size_t inlen) {
+    if (pm == NULL || !table_valid(p, len, inlen))
+        return false;
+
+    pm->inlen = inlen;
+    pm->outlen = len;
+    pm->nbytes = (inlen + 7) / 8;
+    for (size_t j = 0; j < pm->nbytes; j++) {
+        uint64_t single[8] = {0};       //output bits of each input bit
+        for (size_t i = 0; i < len; i++) {
+            size_t b = inlen - (size_t)p[i];    //bit index from the lowest
+            if (b / 8 == j)
+                single[b % 8] |= (uint64_t)1 << (len - 1 - i);
+        }
+        pm->lut[j][0] = 0;
+        for (int v = 1; v < 256; v++) {     //add the lowest set bit of v
+            int low = 0;
+            while (!(v >> low & 1))
+                low++;
+            pm->lut[j][v] = pm->lut[j][v & (v - 1)] | single[low];
+        }
+    }
+
+    pm->ngroups = 0;
+    int ngroups = find_groups(pm, p, len);
+    if (ngroups > 0 && (size_t)ngroups <= pm->nbytes)
+        pm->ngroups = ngroups;      //fewer groups than lookups
+    return true;
+}
+
+/**
+ * Returns the compiled permutation of the specified table, compiling it on 
+ * first use. Tables are cached by their contents, so the same table passed 
+ * from different arrays is compiled once. Invalid tables are cached too, 
+ * so a caller falling back on every NULL only pays for the lookup. Safe to 
+ * call from any thread. The result is never freed. 
+ *
+ * PARAMETERS: 
+ * p     - the permutation mapping
+ * len   - the length of the permutation mapping, up to 64
+ * inlen - the number of input bits, up to 64
+ *
+ * RETURNS: 
+ * The compiled permutation, or NULL if the table is invalid, memory ran 
+ * out or the cache is full. 
+ */
+const des_perm *des_perm_get(const int p[], size_t len, size_t inlen) {
+    if (p == NULL || len == 0 || len > 64)
+        return NULL;
+
+    uint64_t hash = table_hash(p, len, inlen);
+    for (CacheEntry *e = __atomic_load_n(&cache, __ATOMIC_ACQUIRE); e != NULL;
+            e = e->next) {
+        if (e->hash == hash && e->len == len && e->inlen == inlen &&
+                memcmp(e->p, p, len * (sizeof *p)) == 0)
+            return (e->valid ? &e->pm : NULL);
+    }
+
+    unsigned count = __atomic_add_fetch(&cache_count, 1, __ATOMIC_RELAXED);
+    if (count > DES_PERM_CACHE) {
+        __atomic_sub_fetch(&cache_count, 1, __ATOMIC_RELAXED);
+        return NULL;        //cache is full
+    }
+    _Bool valid = table_valid(p, len, inlen);
+    CacheEntry *e = malloc(valid ? sizeof *e : offsetof(CacheEntry, pm));
+    if (e == NULL) {
+        __atomic_sub_fetch(&cache_count, 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+    if (valid)
+        des_perm_compile(&e->pm, p, len, inlen);
+
+    e->valid = valid;
+    e->hash = hash;
+    e->len = len;
+    e->inlen = inlen;
+    memcpy(e->p, p, len * (sizeof *p));
+    e->next = __atomic_load_n(&cache, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&cache, &e->next, e, true,
+            __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;                   //a racing thread may add the same table, harmless
+    return (valid ? &e->pm : NULL);
+}
+
+/**
+ * Permutes the specified packed block with a compiled permutation. 
+ *
+ * PARAMETERS: 
+ * pm - the compiled permutation
+ * in - the block to permute, stored in the lowest inlen bits
+ *
+ * RETURNS: 
+ * The permutated block, stored in the lowest outlen bits. 
+ */
+uint64_t des_perm_apply(const des_perm *pm, uint64_t in) {
+#ifdef DES_PERM_X86
+    if (pm->ngroups > 0 && (des_cpu_enabled() & DES_CPU_BMI2))
+        return pext_apply(pm, in);
+#endif
+    uint64_t out = 0;
+    for (size_t j = 0; j < pm->nbytes; j++, in >>= 8)
+        out |= pm->lut[j][in & 0xff];
+    return out;
+}
+
+/**
+ * Checks that the specified table can be compiled, every entry naming one 
+ * of the input bits. 
+ *
+ * PARAMETERS: 
+ * p     - the permutation mapping
+ * len   - the length of the permutation mapping, up to 64
+ * inlen - the number of input bits, up to 64
+ *
+ * RETURNS: 
+ * 1 (true) if the table is valid, 0 (false) otherwise. 
+ */
+static _Bool table_valid(const int p[], size_t len, size_t inlen) {
+    if (p == NULL || len == 0 || len > 64 || inlen == 0 || inlen > 64)
+        return false;
+    for (size_t i = 0; i < len; i++)
+        if (p[i] < 1 || (size_t)p[i] > inlen)
+            return false;   //an element is out of bound
+    return true;
+}
+
+/**
+ * Splits the specified table into PEXT/PDEP groups. The bits of a group 
+ * keep their order, so a PEXT of the input bits followed by a PDEP to the 
+ * output bits moves the whole group at once. 
+ *
+ * PARAMETERS: 
+ * pm  - the compiled permutation to store the group masks
+ * p   - the permutation mapping
+ * len - the length of the permutation mapping
+ *
+ * RETURNS: 
+ * The number of groups, or 0 if more than DES_PERM_GROUPS are needed. 
+ */
+static int find_groups(des_perm *pm, const int p[], size_t len) {
+    int last[DES_PERM_GROUPS];      //last input bit of every group
+    int ngroups = 0;
+    for (size_t i = 0; i < len; i++) {
+        int g = 0;
+        while (g < ngroups && last[g] >= p[i])
+            g++;                    //first group the bit can follow
+        if (g == DES_PERM_GROUPS)
+            return 0;
+        if (g == ngroups) {
+            pm->inmask[g] = pm->outmask[g] = 0;
+            ngroups++;
+        }
+        last[g] = p[i];
+        pm->inmask[g] |= (uint64_t)1 << (pm->inlen - (size_t)p[i]);
+        pm->outmask[g] |= (uint64_t)1 << (len - 1 - i);
+    }
+    return ngroups;
+}
+
+/**
+ * Hashes the specified table with FNV-1a. 
+ *
+ * PARAMETERS: 
+ * p     - the permutation mapping
+ * len   - the length of the permutation mapping
+ * inlen - the number of input bits
+ *
+ * RETURNS: 
+ * The hash of the table. 
+ */
+static uint64_t table_hash(const int p[], size_t len, size_t inlen) {
+    uint64_t h = 0xcbf29ce484222325 ^ inlen;
+    for (size_t i = 0; i < len; i++)
+        h = (h ^ (uint32_t)p[i]) * 0x100000001b3;
+    return h;
+}
+
+#ifdef DES_PERM_X86
+#pragma GCC push_options
+#pragma GCC target("bmi2")
+/**
+ * Permutes the specified block with PEXT and PDEP, one group at a time. 
+ *
+ * PARAMETERS: 
+ * pm - the compiled permutation
+ * in - the block to permute
+ *
+ * RETURNS: 
+ * The permutated block. 
+ */
+static uint64_t pext_apply(const des_perm *pm, uint64_t in) {
+    uint64_t out = 0;
+    for (int i = 0; i < pm->ngroups; i++)
+        out |= _pdep_u64(_pext_u64(in, pm->inmask[i]), pm->outmask[i]);
+    return out;
+}
+#pragma GCC pop_options
+#endif
@@ -0,0 +1,94 @@
+/**
+ * FILE:   desperm.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Compiled bit permutations. A permutation table in the style of the DES 
+ * tables is compiled once into byte-indexed lookup tables and PEXT/PDEP 
+ * masks, then applied to packed blocks. The masks are used when the active 
+ * backend enables BMI2. 
+ *
+ * C99
+ */
+
+#ifndef __desperm_h__
+#define __desperm_h__
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * The most PEXT/PDEP groups a compiled permutation may use, permutations 
+ * needing more always use the lookup tables. 
+ */
+#define DES_PERM_GROUPS 8
+
+/**
+ * The most permutations kept by des_perm_get(), valid or not, compile any 
+ * others with des_perm_compile(). 
+ */
+#define DES_PERM_CACHE 64
+
+/**
+ * A compiled permutation, from up to 64 input bits to up to 64 output bits. 
+ * Bit 1 of the table refers to the most significant of the input bits. 
+ */
+typedef struct des_perm {
+    size_t inlen;                       //number of input bits
+    size_t outlen;                      //number of output bits
+    size_t nbytes;                      //number of input bytes to look up
+    int ngroups;                        //PEXT/PDEP groups, 0 if slower
+    uint64_t inmask[DES_PERM_GROUPS];   //input bits of every group
+    uint64_t outmask[DES_PERM_GROUPS];  //output bits of every group
+    uint64_t lut[8][256];               //output bits of every input byte
+} des_perm;
+
+/**
+ * Compiles the specified permutation table. Entry i of the table is the 
+ * input bit that becomes output bit i + 1, counting from 1 at the most 
+ * significant bit like the DES tables. Entries may repeat, as in the 
+ * expansion table. 
+ *
+ * PARAMETERS: 
+ * pm    - the compiled permutation to fill
+ * p     - the permutation mapping
+ * len   - the length of the permutation mapping, up to 64
+ * inlen - the number of input bits, up to 64
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) if the table is 
+ * invalid. 
+ */
+_Bool des_perm_compile(des_perm *pm, const int p[], size_t len, size_t inlen);
+
+/**
+ * Returns the compiled permutation of the specified table, compiling it on 
+ * first use. Tables are cached by their contents, so the same table passed 
+ * from different arrays is compiled once. Invalid tables are cached too, 
+ * so a caller falling back on every NULL only pays for the lookup. Safe to 
+ * call from any thread. The result is never freed. 
+ *
+ * PARAMETERS: 
+ * p     - the permutation mapping
+ * len   - the length of the permutation mapping, up to 64
+ * inlen - the number of input bits, up to 64
+ *
+ * RETURNS: 
+ * The compiled permutation, or NULL if the table is invalid, memory ran 
+ * out or the cache is full. 
+ */
+const des_perm *des_perm_get(const int p[], size_t len, size_t inlen);
+
+/**
+ * Permutes the specified packed block with a compiled permutation. 
+ *
+ * PARAMETERS: 
+ * pm - the compiled permutation
+ * in - the block to permute, stored in the lowest inlen bits
+ *
+ * RETURNS: 
+ * The permutated block, stored in the lowest outlen bits. 
+ */
+uint64_t des_perm_apply(const des_perm *pm, uint64_t in);
+
+#endif
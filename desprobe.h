@@ -0,0 +1,53 @@
+/**
+ * FILE:   desprobe.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Static tracepoints (USDT probes) of the provider des, for bpftrace and 
+ * perf on a running process. A probe is a single nop until a tracer 
+ * attaches to it, so the probes are compiled in whenever <sys/sdt.h> is 
+ * available. Building with DES_NO_PROBES, or without <sys/sdt.h>, turns 
+ * every probe into nothing. The arguments are integers and pointers only, 
+ * never key material. 
+ *
+ *     enc_start, enc_done(ok)             des_enc_r(), des_enc()
+ *     dec_start, dec_done(ok)             des_dec_r(), des_dec()
+ *     key_setup_start(ks), key_setup_done(ks)
+ *     batch_start(n, backend, triple), batch_done(n, backend)
+ *     batch_keys_start(n, backend), batch_keys_done(n, backend)
+ *     mode_start(mode, dec, inlen), mode_done(mode, outlen)
+ *     parallel_start(mode, inlen, chunks), parallel_done(mode, outlen)
+ *     pool_run(tasks, threads), pool_done(tasks)
+ *     task_start(worker, task), task_done(worker, task)
+ *     task_steal(worker, victim, tasks)
+ *     job_submit(job, inlen), job_start(job), job_done(job, ok)
+ *
+ * C99
+ */
+
+#ifndef __desprobe_h__
+#define __desprobe_h__
+
+#if !defined(DES_NO_PROBES) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define DES_PROBES
+#include <sys/sdt.h>
+#endif
+#endif
+
+/**
+ * The probe macros, by number of arguments. 
+ */
+#ifdef DES_PROBES
+#define DES_PROBE(name) DTRACE_PROBE(des, name)
+#define DES_PROBE1(name, a) DTRACE_PROBE1(des, name, a)
+#define DES_PROBE2(name, a, b) DTRACE_PROBE2(des, name, a, b)
+#define DES_PROBE3(name, a, b, c) DTRACE_PROBE3(des, name, a, b, c)
+#else
+#define DES_PROBE(name) ((void)0)
+#define DES_PROBE1(name, a) ((void)0)
+#define DES_PROBE2(name, a, b) ((void)0)
+#define DES_PROBE3(name, a, b, c) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,419 @@
+/**
+ * FILE:   dessearch.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Exhaustive search of the 56-bit DES key space for a known plain text and 
+ * cipher text pair. The key indexes are split into chunks, and a partition 
+ * is every stride-th chunk from a start index, so separate machines or 
+ * processes can search separate partitions. The chunks of a partition are 
+ * spread across worker threads testing keys with des_search_batch(). The 
+ * progress can be saved to a checkpoint file and resumed later. 
+ *
+ * C99, POSIX threads
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "dessearch.h"
+
+/**
+ * The number of keys a worker tests between checks for a stop. 
+ */
+#define SEARCH_STEP ((uint64_t)1 << 20)
+
+/**
+ * The chunk of an idle worker. 
+ */
+#define IDLE UINT64_MAX
+
+typedef struct Run Run;
+
+/**
+ * A worker thread and the chunk it is searching. 
+ */
+typedef struct Worker {
+    pthread_t thread;           //the thread
+    Run *run;                   //the search run
+    uint64_t chunk;             //chunk being searched, IDLE once done
+} Worker;
+
+/**
+ * The state of a search shared by the workers. 
+ */
+struct Run {
+    const des_search *s;        //the search
+    uint64_t space;             //number of key indexes searched
+    uint64_t total;             //chunks in the partition
+    uint64_t ct[2];             //the cipher texts to look for
+    size_t nct;                 //number of cipher texts
+    uint64_t claim;             //next chunk to hand out
+    uint64_t tested;            //keys ruled out so far
+    int stop;                   //set to stop the workers
+    int found;                  //set once the key is found
+    uint64_t key;               //the key, once found
+    size_t running;             //workers still running
+    pthread_mutex_t lock;       //guards running
+    pthread_cond_t done;        //signalled when a worker stops
+};
+
+static void *worker(void *arg);
+static void search_chunk(Worker *w, uint64_t c);
+static uint64_t resume_point(Run *run, const Worker *workers, size_t n);
+static uint64_t key_space(const des_search *s);
+static double now_sec(void);
+
+/**
+ * Initialises the specified search for the specified pair, over the whole 
+ * key space in one partition, on every CPU, reporting every second. 
+ *
+ * PARAMETERS: 
+ * s  - the search to initialise
+ * pt - the known plain text
+ * ct - the cipher text of pt
+ */
+void des_search_init(des_search *s, uint64_t pt, uint64_t ct) {
+    memset(s, 0, sizeof *s);
+    s->pt = pt;
+    s->ct = ct;
+    s->chunk = DES_SEARCH_CHUNK;
+    s->stride = DES_SEARCH_CHUNK;
+    s->interval = 1000;
+}
+
+/**
+ * Makes the specified search cover one of the specified number of equal 
+ * partitions, interleaved chunk by chunk. Every partition must use the 
+ * same chunk size. 
+ *
+ * PARAMETERS: 
+ * s     - the search
+ * part  - the partition, from 0
+ * parts - the number of partitions
+ *
+ * RETURNS: 
+ * 1 (true) if the partition is valid, 0 (false) otherwise. 
+ */
+_Bool des_search_partition(des_search *s, uint64_t part, uint64_t parts) {
+    if (s == NULL || s->chunk == 0 || parts == 0 || part >= parts ||
+            parts > key_space(s) / s->chunk + 1)
+        return false;
+    s->start = part * s->chunk;
+    s->stride = parts * s->chunk;
+    s->next = 0;
+    return true;
+}
+
+/**
+ * Returns the number of chunks in the partition of the specified search. 
+ *
+ * PARAMETERS: 
+ * s - the search
+ *
+ * RETURNS: 
+ * The number of chunks, or 0 if the search is invalid. 
+ */
+uint64_t des_search_chunks(const des_search *s) {
+    uint64_t space = key_space(s);
+    if (s == NULL || s->chunk == 0 || s->stride < s->chunk ||
+            s->start >= space)
+        return 0;
+    return (space - s->start - 1) / s->stride + 1;
+}
+
+/**
+ * Searches the partition from chunk next until the key is found, the 
+ * partition is done, or the report callback returns 0 (false). Every 
+ * interval the progress is passed to the callback and saved to the 
+ * checkpoint file. On return next holds the chunk to resume from, chunks 
+ * before it are all searched. 
+ *
+ * PARAMETERS: 
+ * s   - the search
+ * key - the key to store the result, with odd parity
+ * st  - the progress to store the final statistics, or NULL
+ *
+ * RETURNS: 
+ * 1 (true) if the key is found, 0 (false) otherwise. 
+ */
+_Bool des_search_run(des_search *s, uint64_t *key, des_search_stats *st) {
+    Run run;
+    memset(&run, 0, sizeof run);
+    run.s = s;
+    run.space = key_space(s);
+    run.total = des_search_chunks(s);
+    run.claim = s->next;
+    run.ct[0] = s->ct;
+    run.ct[1] = ~s->ct2;        //E(k, pt) = ~ct2 means the key is ~k
+    run.nct = (s->comp ? 2 : 1);
+    if (key == NULL || run.total == 0)
+        return false;
+
+    size_t n = s->threads;
+    if (n == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        n = (cpus > 0 ? (size_t)cpus : 1);
+    }
+    Worker *workers = calloc(n, sizeof *workers);
+    if (workers == NULL)
+        return false;
+
+    for (size_t i = 0; i < n; i++) {
+        workers[i].run = &run;
+        workers[i].chunk = IDLE;
+    }
+    pthread_mutex_init(&run.lock, NULL);
+    pthread_cond_init(&run.done, NULL);
+    double start = now_sec();
+    size_t started = 0;
+    for (; started < n; started++) {
+        run.running++;          //counted before the worker can stop
+        if (pthread_create(&workers[started].thread, NULL, &worker,
+                &workers[started]) != 0) {
+            run.running--;
+            break;
+        }
+    }
+    if (started == 0) {         //search on the calling thread instead
+        run.running = 1;
+        worker(&workers[0]);
+    }
+
+    des_search_stats stats;
+    memset(&stats, 0, sizeof stats);
+    stats.total = run.total;
+    pthread_mutex_lock(&run.lock);
+    for (;;) {
+        struct timespec until;
+        clock_gettime(CLOCK_REALTIME, &until);
+        until.tv_sec += s->interval / 1000;
+        until.tv_nsec += (long)(s->interval % 1000) * 1000000;
+        if (until.tv_nsec >= 1000000000) {
+            until.tv_sec++;
+            until.tv_nsec -= 1000000000;
+        }
+        while (run.running > 0 &&
+                pthread_cond_timedwait(&run.done, &run.lock, &until) == 0)
+            ;                   //woken early by a stopped worker
+        _Bool finished = (run.running == 0);
+        pthread_mutex_unlock(&run.lock);
+
+        s->next = resume_point(&run, workers, (started > 0 ? started : 1));
+        stats.next = s->next;
+        stats.tested = __atomic_load_n(&run.tested, __ATOMIC_RELAXED);
+        stats.seconds = now_sec() - start;
+        stats.keys_per_sec = (stats.seconds > 0 ?
+                (double)stats.tested / stats.seconds : 0);
+        if (s->checkpoint != NULL)
+            des_search_save(s, s->checkpoint);
+        if (finished)
+            break;
+        if (s->report != NULL && !s->report(s, &stats, s->user))
+            __atomic_store_n(&run.stop, 1, __ATOMIC_RELAXED);
+        pthread_mutex_lock(&run.lock);
+    }
+
+    for (size_t i = 0; i < started; i++)
+        pthread_join(workers[i].thread, NULL);
+    free(workers);
+    pthread_mutex_destroy(&run.lock);
+    pthread_cond_destroy(&run.done);
+    if (st != NULL)
+        *st = stats;
+    if (run.found)
+        *key = run.key;
+    return run.found != 0;
+}
+
+/**
+ * Saves the pair, the partition and the progress of the specified search 
+ * to a checkpoint file. The file is replaced atomically. 
+ *
+ * PARAMETERS: 
+ * s    - the search
+ * path - the checkpoint file
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_search_save(const des_search *s, const char *path) {
+    if (s == NULL || path == NULL)
+        return false;
+    char tmp[4096];
+    if (snprintf(tmp, sizeof tmp, "%s.tmp", path) >= (int)sizeof tmp)
+        return false;
+    FILE *f = fopen(tmp, "w");
+    if (f == NULL)
+        return false;
+
+    fprintf(f, "des-search 1\n");
+    fprintf(f, "pt %016" PRIx64 "\nct %016" PRIx64 "\n", s->pt, s->ct);
+    fprintf(f, "ct2 %016" PRIx64 "\ncomp %d\n", s->ct2, s->comp ? 1 : 0);
+    fprintf(f, "start %" PRIu64 "\nstride %" PRIu64 "\n", s->start,
+            s->stride);
+    fprintf(f, "chunk %" PRIu64 "\nnext %" PRIu64 "\n", s->chunk, s->next);
+    _Bool ok = !ferror(f);
+    if (fclose(f) != 0 || !ok || rename(tmp, path) != 0) {
+        remove(tmp);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Loads the pair, the partition and the progress of a search from a 
+ * checkpoint file. The other fields of the search are left as they are. 
+ *
+ * PARAMETERS: 
+ * s    - the search to fill
+ * path - the checkpoint file
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_search_load(des_search *s, const char *path) {
+    if (s == NULL || path == NULL)
+        return false;
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+        return false;
+
+    des_search t = *s;
+    int version = 0, comp = 0;
+    int n = fscanf(f, "des-search %d pt %" SCNx64 " ct %" SCNx64
+            " ct2 %" SCNx64 " comp %d start %" SCNu64 " stride %" SCNu64
+            " chunk %" SCNu64 " next %" SCNu64, &version, &t.pt, &t.ct,
+            &t.ct2, &comp, &t.start, &t.stride, &t.chunk, &t.next);
+    fclose(f);
+    if (n != 9 || version != 1)
+        return false;
+    t.comp = (comp != 0);
+    if (des_search_chunks(&t) == 0 || t.next > des_search_chunks(&t))
+        return false;   //not a valid partition
+    *s = t;
+    return true;
+}
+
+/**
+ * Searches chunks until the partition is done or the search stops. A 
+ * chunk is claimed only after the worker marks it as its own, so a chunk 
+ * handed out is never missed by resume_point(). 
+ *
+ * PARAMETERS: 
+ * arg - the worker
+ *
+ * RETURNS: 
+ * NULL. 
+ */
+static void *worker(void *arg) {
+    Worker *w = arg;
+    Run *run = w->run;
+    for (;;) {
+        uint64_t c = __atomic_load_n(&run->claim, __ATOMIC_RELAXED);
+        do {
+            __atomic_store_n(&w->chunk, c, __ATOMIC_SEQ_CST);
+        } while (!__atomic_compare_exchange_n(&run->claim, &c, c + 1, false,
+                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+        if (c >= run->total) {
+            __atomic_store_n(&w->chunk, IDLE, __ATOMIC_SEQ_CST);
+            break;
+        }
+        if (__atomic_load_n(&run->stop, __ATOMIC_RELAXED))
+            break;              //the chunk stays unsearched
+        search_chunk(w, c);
+        if (__atomic_load_n(&run->stop, __ATOMIC_RELAXED))
+            break;
+    }
+
+    pthread_mutex_lock(&run->lock);
+    run->running--;
+    pthread_cond_signal(&run->done);
+    pthread_mutex_unlock(&run->lock);
+    return NULL;
+}
+
+/**
+ * Searches the specified chunk, a step at a time so that a stop or a 
+ * found key ends the chunk early. 
+ *
+ * PARAMETERS: 
+ * w - the worker
+ * c - the chunk of the partition
+ */
+static void search_chunk(Worker *w, uint64_t c) {
+    Run *run = w->run;
+    const des_search *s = run->s;
+    uint64_t first = s->start + c * s->stride;
+    uint64_t end = (run->space - first > s->chunk ? first + s->chunk :
+            run->space);
+
+    for (uint64_t i = first; i < end; i += SEARCH_STEP) {
+        if (__atomic_load_n(&run->stop, __ATOMIC_RELAXED))
+            return;
+        uint64_t n = (end - i < SEARCH_STEP ? end - i : SEARCH_STEP);
+        des_key_match m;
+        if (des_search_batch(&m, 1, i, n, s->pt, run->ct, run->nct) > 0) {
+            uint64_t key = des_index_key(m.index);
+            int expected = 0;
+            if (__atomic_compare_exchange_n(&run->found, &expected, 1,
+                    false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                run->key = (m.target == 0 ? key : ~key);
+            __atomic_store_n(&run->stop, 1, __ATOMIC_RELAXED);
+        }
+        __atomic_add_fetch(&run->tested, n * run->nct, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&w->chunk, IDLE, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * Returns the first chunk that may not be searched yet: the lowest chunk 
+ * a worker is on, or the next chunk to hand out. 
+ *
+ * PARAMETERS: 
+ * run     - the search run
+ * workers - the workers
+ * n       - the number of workers
+ *
+ * RETURNS: 
+ * The chunk to resume from. 
+ */
+static uint64_t resume_point(Run *run, const Worker *workers, size_t n) {
+    uint64_t next = __atomic_load_n(&run->claim, __ATOMIC_SEQ_CST);
+    for (size_t i = 0; i < n; i++) {
+        uint64_t c = __atomic_load_n(&workers[i].chunk, __ATOMIC_SEQ_CST);
+        if (c < next)
+            next = c;
+    }
+    return (next < run->total ? next : run->total);
+}
+
+/**
+ * Returns the number of key indexes the specified search covers, half the 
+ * key space with the complementation property. 
+ *
+ * PARAMETERS: 
+ * s - the search
+ *
+ * RETURNS: 
+ * The number of key indexes. 
+ */
+static uint64_t key_space(const des_search *s) {
+    return (uint64_t)1 << (s != NULL && s->comp ? 55 : 56);
+}
+
+/**
+ * Returns the time of a monotonic clock in seconds. 
+ *
+ * RETURNS: 
+ * The time in seconds. 
+ */
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
@@ -0,0 +1,144 @@
+/**
+ * FILE:   dessearch.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Exhaustive search of the 56-bit DES key space for a known plain text and 
+ * cipher text pair. The key indexes are split into chunks, and a partition 
+ * is every stride-th chunk from a start index, so separate machines or 
+ * processes can search separate partitions. The chunks of a partition are 
+ * spread across worker threads testing keys with des_search_batch(). The 
+ * progress can be saved to a checkpoint file and resumed later. 
+ *
+ * C99, POSIX threads
+ */
+
+#ifndef __dessearch_h__
+#define __dessearch_h__
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "desbs.h"
+
+/**
+ * The default number of keys in a chunk, the unit of work of a thread and 
+ * of a checkpoint. 
+ */
+#define DES_SEARCH_CHUNK ((uint64_t)1 << 30)
+
+/**
+ * The progress of a search. 
+ */
+typedef struct des_search_stats {
+    uint64_t tested;            //keys ruled out by this run
+    uint64_t next;              //chunks of the partition searched so far
+    uint64_t total;             //chunks in the partition
+    double seconds;             //time taken by this run
+    double keys_per_sec;        //keys ruled out per second by this run
+} des_search_stats;
+
+/**
+ * A key search. Fill it with des_search_init(), then change the fields as 
+ * needed. With comp set, the cipher text ct2 of the complement of pt under 
+ * the same key is known, and the complementation property of DES tests 
+ * two keys with every encryption: E(~k, pt) = ~E(k, ~pt) = ~ct2 if k is 
+ * the key. Only the key indexes below 2 ^ 55 are then searched. 
+ */
+typedef struct des_search {
+    uint64_t pt;                //the known plain text
+    uint64_t ct;                //the cipher text of pt
+    uint64_t ct2;               //the cipher text of ~pt, if comp is set
+    _Bool comp;                 //whether ct2 is known
+    uint64_t start;             //the first key index of the partition
+    uint64_t stride;            //key indexes from one chunk to the next
+    uint64_t chunk;             //keys in a chunk, up to stride
+    uint64_t next;              //chunks of the partition searched so far
+    size_t threads;             //worker threads, 0 for every CPU
+    const char *checkpoint;     //file saved at every report, or NULL
+    unsigned interval;          //milliseconds between reports
+    _Bool (*report)(const struct des_search *s, const des_search_stats *st,
+            void *user);        //called at every report, or NULL
+    void *user;                 //caller data for report
+} des_search;
+
+/**
+ * Initialises the specified search for the specified pair, over the whole 
+ * key space in one partition, on every CPU, reporting every second. 
+ *
+ * PARAMETERS: 
+ * s  - the search to initialise
+ * pt - the known plain text
+ * ct - the cipher text of pt
+ */
+void des_search_init(des_search *s, uint64_t pt, uint64_t ct);
+
+/**
+ * Makes the specified search cover one of the specified number of equal 
+ * partitions, interleaved chunk by chunk. Every partition must use the 
+ * same chunk size. 
+ *
+ * PARAMETERS: 
+ * s     - the search
+ * part  - the partition, from 0
+ * parts - the number of partitions
+ *
+ * RETURNS: 
+ * 1 (true) if the partition is valid, 0 (false) otherwise. 
+ */
+_Bool des_search_partition(des_search *s, uint64_t part, uint64_t parts);
+
+/**
+ * Returns the number of chunks in the partition of the specified search. 
+ *
+ * PARAMETERS: 
+ * s - the search
+ *
+ * RETURNS: 
+ * The number of chunks, or 0 if the search is invalid. 
+ */
+uint64_t des_search_chunks(const des_search *s);
+
+/**
+ * Searches the partition from chunk next until the key is found, the 
+ * partition is done, or the report callback returns 0 (false). Every 
+ * interval the progress is passed to the callback and saved to the 
+ * checkpoint file. On return next holds the chunk to resume from, chunks 
+ * before it are all searched. 
+ *
+ * PARAMETERS: 
+ * s   - the search
+ * key - the key to store the result, with odd parity
+ * st  - the progress to store the final statistics, or NULL
+ *
+ * RETURNS: 
+ * 1 (true) if the key is found, 0 (false) otherwise. 
+ */
+_Bool des_search_run(des_search *s, uint64_t *key, des_search_stats *st);
+
+/**
+ * Saves the pair, the partition and the progress of the specified search 
+ * to a checkpoint file. The file is replaced atomically. 
+ *
+ * PARAMETERS: 
+ * s    - the search
+ * path - the checkpoint file
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_search_save(const des_search *s, const char *path);
+
+/**
+ * Loads the pair, the partition and the progress of a search from a 
+ * checkpoint file. The other fields of the search are left as they are. 
+ *
+ * PARAMETERS: 
+ * s    - the search to fill
+ * path - the checkpoint file
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+_Bool des_search_load(des_search *s, const char *path);
+
+#endif
@@ -0,0 +1,482 @@
+/**
+ * FILE:   desstats.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Counters of the hot paths of the library, compiled in only when 
+ * DES_STATS is defined (make STATS=1). Every thread counts into its own 
+ * counters without a lock or a shared cache line, and a snapshot adds up 
+ * the counters of every thread, including threads that have exited. 
+ * Without DES_STATS the counting macros are empty and a snapshot is all 
+ * 0, so callers need no conditional code. Setting DES_STATS_DUMP to a 
+ * number of milliseconds prints the counters to stderr periodically. 
+ *
+ * C99, POSIX threads
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+#include <pthread.h>
+#include "desstats.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define STATS_TSC
+#endif
+
+static const char *NAMES[DES_STAT_COUNT] = {
+    "key_setup", "f_func", "permute", "block", "tdes_block", "batch"
+};
+
+static const char *MODES[DES_STATS_MODES] = {
+    "ecb", "cbc", "cfb", "ofb", "ctr"
+};
+
+#ifdef DES_STATS
+/**
+ * The counters of a thread, in the list of every counting thread. Only 
+ * the owning thread writes the counters, other threads only read them. 
+ */
+typedef struct Counters {
+    des_stats st;               //the counters of the thread
+    struct Counters *prev;      //previous thread in the list
+    struct Counters *next;      //next thread in the list
+} Counters;
+
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+static pthread_key_t exit_key;          //retires the counters on exit
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;   //guards below
+static Counters *threads = NULL;        //counters of the running threads
+static des_stats retired;               //counters of the exited threads
+static des_stats base;                  //the sum at the last reset
+static size_t nthreads = 0;             //threads that have counted
+static __thread Counters *local = NULL; //counters of this thread
+
+static pthread_mutex_t dump_ctl = PTHREAD_MUTEX_INITIALIZER;    //one dump
+static pthread_mutex_t dump_lock = PTHREAD_MUTEX_INITIALIZER;   //guards below
+static pthread_cond_t dump_wake = PTHREAD_COND_INITIALIZER;
+static pthread_t dumper;                //the dump thread
+static _Bool dumping = false;           //whether the dump thread runs
+static _Bool dump_stop = false;         //set to stop the dump thread
+static FILE *dump_file = NULL;          //file of the dump
+static unsigned dump_ms = 0;            //milliseconds between dumps
+
+static void init(void);
+static Counters *counters(void);
+static void retire(void *arg);
+static void sum(des_stats *st);
+static void merge(des_stats *to, const des_stats *from, _Bool sub);
+static void add(uint64_t *to, const uint64_t *from, _Bool sub);
+static void bump(uint64_t *c, uint64_t n);
+static void *dump(void *arg);
+#endif
+
+/**
+ * Returns whether the library was built with DES_STATS. 
+ *
+ * RETURNS: 
+ * 1 (true) if the counters are compiled in, 0 (false) otherwise. 
+ */
+_Bool des_stats_enabled(void) {
+#ifdef DES_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Stores the sum of the counters of every thread. The counters of running 
+ * threads are read without stopping them, so the sum is a snapshot. 
+ *
+ * PARAMETERS: 
+ * st - the snapshot to store the counters
+ */
+void des_stats_snapshot(des_stats *st) {
+    if (st == NULL)
+        return;
+    memset(st, 0, sizeof *st);
+#ifdef DES_STATS
+    pthread_mutex_lock(&lock);
+    sum(st);
+    merge(st, &base, true);
+    st->threads = nthreads;
+    pthread_mutex_unlock(&lock);
+#endif
+    st->backend = des_backend_get();
+}
+
+/**
+ * Starts the counters again from 0, for every thread. 
+ */
+void des_stats_reset(void) {
+#ifdef DES_STATS
+    pthread_mutex_lock(&lock);
+    memset(&base, 0, sizeof base);
+    sum(&base);
+    pthread_mutex_unlock(&lock);
+#endif
+}
+
+/**
+ * Returns the name of the specified timed function. 
+ *
+ * PARAMETERS: 
+ * id - the timed function
+ *
+ * RETURNS: 
+ * The name, or NULL if the id is invalid. 
+ */
+const char *des_stat_name(des_stat_id id) {
+    return ((unsigned)id < DES_STAT_COUNT ? NAMES[id] : NULL);
+}
+
+/**
+ * Prints the specified snapshot, one counter per line. 
+ *
+ * PARAMETERS: 
+ * f  - the file to print to
+ * st - the snapshot
+ */
+void des_stats_print(FILE *f, const des_stats *st) {
+    if (f == NULL || st == NULL)
+        return;
+    fprintf(f, "backend %s, %zu threads\n", des_backend_name(st->backend),
+            st->threads);
+    for (int i = 0; i < DES_STAT_COUNT; i++) {
+        const des_stat *s = &st->func[i];
+        fprintf(f, "%-12s %12" PRIu64 " calls %16" PRIu64 " cycles "
+                "%10.1f per call\n", NAMES[i], s->calls, s->cycles,
+                (s->calls > 0 ? (double)s->cycles / (double)s->calls : 0));
+    }
+    for (int i = 0; i < DES_STATS_MODES; i++)
+        fprintf(f, "%-12s %12" PRIu64 " bytes\n", MODES[i],
+                st->mode_bytes[i]);
+    for (int i = DES_BACKEND_SCALAR; i < DES_BACKEND_COUNT; i++)
+        fprintf(f, "%-12s %12" PRIu64 " batch blocks\n",
+                des_backend_name((des_backend)i), st->backend_blocks[i]);
+    fprintf(f, "%-12s %12" PRIu64 " calls %16" PRIu64 " bytes\n", "alloc",
+            st->allocs, st->alloc_bytes);
+}
+
+/**
+ * Prints a snapshot to the specified file every interval from a background 
+ * thread, replacing any earlier dump. An interval of 0 stops the dump. 
+ *
+ * PARAMETERS: 
+ * f        - the file to print to
+ * interval - milliseconds between snapshots, 0 to stop
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) if the counters are 
+ * not compiled in or the thread cannot be started. 
+ */
+_Bool des_stats_dump(FILE *f, unsigned interval) {
+#ifdef DES_STATS
+    if (interval > 0 && f == NULL)
+        return false;
+    pthread_mutex_lock(&dump_ctl);
+    if (dumping) {                      //stop the earlier dump first
+        pthread_mutex_lock(&dump_lock);
+        dump_stop = true;
+        pthread_cond_signal(&dump_wake);
+        pthread_mutex_unlock(&dump_lock);
+        pthread_join(dumper, NULL);
+        dumping = false;
+    }
+
+    _Bool ok = true;
+    if (interval > 0) {
+        dump_stop = false;
+        dump_file = f;
+        dump_ms = interval;
+        ok = dumping = (pthread_create(&dumper, NULL, &dump, NULL) == 0);
+    }
+    pthread_mutex_unlock(&dump_ctl);
+    return ok;
+#else
+    (void)f;
+    return interval == 0;
+#endif
+}
+
+/**
+ * Returns the clock the timed functions are measured with, the time stamp 
+ * counter on x86 and a monotonic clock in nanoseconds elsewhere. 
+ *
+ * RETURNS: 
+ * The clock. 
+ */
+uint64_t des_stats_clock(void) {
+#ifdef STATS_TSC
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/**
+ * Counts a call to the specified function on the calling thread, for the 
+ * DES_STAT_STOP() macro. 
+ *
+ * PARAMETERS: 
+ * id     - the timed function
+ * cycles - the clock ticks the call took
+ */
+void des_stats_add(des_stat_id id, uint64_t cycles) {
+#ifdef DES_STATS
+    Counters *c = counters();
+    if (c != NULL && (unsigned)id < DES_STAT_COUNT) {
+        bump(&c->st.func[id].calls, 1);
+        bump(&c->st.func[id].cycles, cycles);
+    }
+#else
+    (void)id;
+    (void)cycles;
+#endif
+}
+
+/**
+ * Counts untimed calls to the specified function on the calling thread, 
+ * for the DES_STAT_CALLS() macro. 
+ *
+ * PARAMETERS: 
+ * id - the counted function
+ * n  - the number of calls
+ */
+void des_stats_calls(des_stat_id id, uint64_t n) {
+#ifdef DES_STATS
+    Counters *c = counters();
+    if (c != NULL && (unsigned)id < DES_STAT_COUNT)
+        bump(&c->st.func[id].calls, n);
+#else
+    (void)id;
+    (void)n;
+#endif
+}
+
+/**
+ * Counts bytes through the specified mode on the calling thread, for the 
+ * DES_STAT_BYTES() macro. 
+ *
+ * PARAMETERS: 
+ * mode - the mode of operation
+ * n    - the number of bytes
+ */
+void des_stats_bytes(des_mode mode, uint64_t n) {
+#ifdef DES_STATS
+    Counters *c = counters();
+    if (c != NULL && (unsigned)mode < DES_STATS_MODES)
+        bump(&c->st.mode_bytes[mode], n);
+#else
+    (void)mode;
+    (void)n;
+#endif
+}
+
+/**
+ * Counts bitsliced blocks on the specified backend on the calling thread, 
+ * for the DES_STAT_BLOCKS() macro. 
+ *
+ * PARAMETERS: 
+ * b - the backend running the blocks
+ * n - the number of blocks
+ */
+void des_stats_blocks(des_backend b, uint64_t n) {
+#ifdef DES_STATS
+    Counters *c = counters();
+    if (c != NULL && (unsigned)b < DES_BACKEND_COUNT)
+        bump(&c->st.backend_blocks[b], n);
+#else
+    (void)b;
+    (void)n;
+#endif
+}
+
+/**
+ * Counts an allocation on the calling thread, for the DES_STAT_ALLOC() 
+ * macro. 
+ *
+ * PARAMETERS: 
+ * n - the number of bytes allocated
+ */
+void des_stats_alloc(uint64_t n) {
+#ifdef DES_STATS
+    Counters *c = counters();
+    if (c != NULL) {
+        bump(&c->st.allocs, 1);
+        bump(&c->st.alloc_bytes, n);
+    }
+#else
+    (void)n;
+#endif
+}
+
+#ifdef DES_STATS
+/**
+ * Creates the key retiring the counters of exiting threads, and starts the 
+ * dump named by the DES_STATS_DUMP environment variable. 
+ */
+static void init(void) {
+    pthread_key_create(&exit_key, &retire);
+    const char *env = getenv("DES_STATS_DUMP");
+    if (env != NULL) {
+        unsigned long ms = strtoul(env, NULL, 10);
+        if (ms > 0 && ms <= 86400000ul)
+            des_stats_dump(stderr, (unsigned)ms);
+    }
+}
+
+/**
+ * Returns the counters of the calling thread, adding them to the list of 
+ * every thread on first use. 
+ *
+ * RETURNS: 
+ * The counters, or NULL if they cannot be allocated. 
+ */
+static Counters *counters(void) {
+    if (local != NULL)
+        return local;
+    pthread_once(&once, &init);
+    Counters *c = calloc(1, sizeof *c);     //not counted as an allocation
+    if (c == NULL)
+        return NULL;
+
+    pthread_mutex_lock(&lock);
+    c->next = threads;
+    if (threads != NULL)
+        threads->prev = c;
+    threads = c;
+    nthreads++;
+    pthread_mutex_unlock(&lock);
+    pthread_setspecific(exit_key, c);
+    local = c;
+    return c;
+}
+
+/**
+ * Adds the counters of an exiting thread to the retired counters, then 
+ * frees them. 
+ *
+ * PARAMETERS: 
+ * arg - the counters of the thread
+ */
+static void retire(void *arg) {
+    Counters *c = arg;
+    pthread_mutex_lock(&lock);
+    merge(&retired, &c->st, false);
+    if (c->prev != NULL)
+        c->prev->next = c->next;
+    else
+        threads = c->next;
+    if (c->next != NULL)
+        c->next->prev = c->prev;
+    pthread_mutex_unlock(&lock);
+    local = NULL;
+    free(c);
+}
+
+/**
+ * Adds up the counters of the running and the exited threads into the 
+ * specified counters. The lock must be held. 
+ *
+ * PARAMETERS: 
+ * st - the counters to add to
+ */
+static void sum(des_stats *st) {
+    merge(st, &retired, false);
+    for (const Counters *c = threads; c != NULL; c = c->next)
+        merge(st, &c->st, false);
+}
+
+/**
+ * Adds or subtracts the specified counters, reading them atomically as 
+ * their thread may be updating them. 
+ *
+ * PARAMETERS: 
+ * to   - the counters to update
+ * from - the counters to add or subtract
+ * sub  - whether to subtract
+ */
+static void merge(des_stats *to, const des_stats *from, _Bool sub) {
+    for (int i = 0; i < DES_STAT_COUNT; i++) {
+        add(&to->func[i].calls, &from->func[i].calls, sub);
+        add(&to->func[i].cycles, &from->func[i].cycles, sub);
+    }
+    for (int i = 0; i < DES_STATS_MODES; i++)
+        add(&to->mode_bytes[i], &from->mode_bytes[i], sub);
+    for (int i = 0; i < DES_BACKEND_COUNT; i++)
+        add(&to->backend_blocks[i], &from->backend_blocks[i], sub);
+    add(&to->allocs, &from->allocs, sub);
+    add(&to->alloc_bytes, &from->alloc_bytes, sub);
+}
+
+/**
+ * Adds or subtracts a counter, reading it atomically. 
+ *
+ * PARAMETERS: 
+ * to   - the counter to update
+ * from - the counter to add or subtract
+ * sub  - whether to subtract
+ */
+static void add(uint64_t *to, const uint64_t *from, _Bool sub) {
+    uint64_t n = __atomic_load_n(from, __ATOMIC_RELAXED);
+    *to += (sub ? -n : n);
+}
+
+/**
+ * Adds to a counter of the calling thread. Only the owning thread writes 
+ * the counter, so a plain load and store is enough, atomic only so that a 
+ * snapshot never reads a torn value. 
+ *
+ * PARAMETERS: 
+ * c - the counter
+ * n - the amount to add
+ */
+static void bump(uint64_t *c, uint64_t n) {
+    __atomic_store_n(c, __atomic_load_n(c, __ATOMIC_RELAXED) + n,
+            __ATOMIC_RELAXED);
+}
+
+/**
+ * The dump thread function. Prints a snapshot every interval until 
+ * stopped. 
+ *
+ * PARAMETERS: 
+ * arg - not used
+ *
+ * RETURNS: 
+ * NULL. 
+ */
+static void *dump(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&dump_lock);
+    while (!dump_stop) {
+        struct timespec until;
+        clock_gettime(CLOCK_REALTIME, &until);
+        until.tv_sec += dump_ms / 1000;
+        until.tv_nsec += (long)(dump_ms % 1000) * 1000000;
+        if (until.tv_nsec >= 1000000000) {
+            until.tv_sec++;
+            until.tv_nsec -= 1000000000;
+        }
+        while (!dump_stop && pthread_cond_timedwait(&dump_wake, &dump_lock,
+                &until) == 0)
+            ;                   //woken early, not stopped
+        if (dump_stop)
+            break;
+        pthread_mutex_unlock(&dump_lock);
+
+        des_stats st;
+        des_stats_snapshot(&st);
+        des_stats_print(dump_file, &st);
+        fflush(dump_file);
+        pthread_mutex_lock(&dump_lock);
+    }
+    pthread_mutex_unlock(&dump_lock);
+    return NULL;
+}
+#endif
@@ -0,0 +1,203 @@
+/**
+ * FILE:   desstats.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Counters of the hot paths of the library, compiled in only when 
+ * DES_STATS is defined (make STATS=1). Every thread counts into its own 
+ * counters without a lock or a shared cache line, and a snapshot adds up 
+ * the counters of every thread, including threads that have exited. 
+ * Without DES_STATS the counting macros are empty and a snapshot is all 
+ * 0, so callers need no conditional code. Setting DES_STATS_DUMP to a 
+ * number of milliseconds prints the counters to stderr periodically. 
+ *
+ * C99, POSIX threads
+ */
+
+#ifndef __desstats_h__
+#define __desstats_h__
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "descpu.h"
+#include "desmode.h"
+
+/**
+ * The number of modes of operation counted, one for every des_mode. 
+ */
+#define DES_STATS_MODES (DES_CTR + 1)
+
+/**
+ * The timed functions. 
+ */
+typedef enum des_stat_id {
+    DES_STAT_KEY_SETUP,     //des_key_setup()
+    DES_STAT_F_FUNC,        //every round of a single block, see below
+    DES_STAT_PERMUTE,       //des_permute() and des_permute_r()
+    DES_STAT_BLOCK,         //des_enc_block() and des_dec_block()
+    DES_STAT_TDES_BLOCK,    //tdes_enc_block() and tdes_dec_block()
+    DES_STAT_BATCH,         //the bitsliced batches, of any key
+    DES_STAT_COUNT
+} des_stat_id;
+
+/**
+ * The counters of a timed function. The f-function runs inline in the 
+ * rounds, so DES_STAT_F_FUNC counts 16 calls for every DES stage of a 
+ * single block without timing them, its cycles are only those of direct 
+ * calls to des_f_func(). The rounds of the bitsliced batches and of 
+ * desinline.h in the caller are not counted. 
+ */
+typedef struct des_stat {
+    uint64_t calls;         //number of calls
+    uint64_t cycles;        //TSC cycles in the calls, or nanoseconds
+} des_stat;
+
+/**
+ * A snapshot of the counters, since start or the last des_stats_reset(). 
+ */
+typedef struct des_stats {
+    des_stat func[DES_STAT_COUNT];          //every timed function
+    uint64_t mode_bytes[DES_STATS_MODES];   //bytes through every mode
+    uint64_t backend_blocks[DES_BACKEND_COUNT]; //batch blocks by backend
+    uint64_t allocs;        //allocations made through bstr_alloc()
+    uint64_t alloc_bytes;   //bytes allocated through bstr_alloc()
+    des_backend backend;    //the active backend
+    size_t threads;         //threads that have counted so far
+} des_stats;
+
+/**
+ * The counting macros placed in the library functions. DES_STAT_START() 
+ * declares a start time and DES_STAT_STOP() counts the call since then. 
+ */
+#ifdef DES_STATS
+#define DES_STAT_START(t) uint64_t t = des_stats_clock()
+#define DES_STAT_STOP(id, t) des_stats_add((id), des_stats_clock() - (t))
+#define DES_STAT_CALLS(id, n) des_stats_calls((id), (n))
+#define DES_STAT_BYTES(mode, n) des_stats_bytes((mode), (n))
+#define DES_STAT_BLOCKS(n) des_stats_blocks(des_backend_get(), (n))
+#define DES_STAT_ALLOC(n) des_stats_alloc(n)
+#else
+#define DES_STAT_START(t) ((void)0)
+#define DES_STAT_STOP(id, t) ((void)0)
+#define DES_STAT_CALLS(id, n) ((void)0)
+#define DES_STAT_BYTES(mode, n) ((void)0)
+#define DES_STAT_BLOCKS(n) ((void)0)
+#define DES_STAT_ALLOC(n) ((void)0)
+#endif
+
+/**
+ * Returns whether the library was built with DES_STATS. 
+ *
+ * RETURNS: 
+ * 1 (true) if the counters are compiled in, 0 (false) otherwise. 
+ */
+_Bool des_stats_enabled(void);
+
+/**
+ * Stores the sum of the counters of every thread. The counters of running 
+ * threads are read without stopping them, so the sum is a snapshot. 
+ *
+ * PARAMETERS: 
+ * st - the snapshot to store the counters
+ */
+void des_stats_snapshot(des_stats *st);
+
+/**
+ * Starts the counters again from 0, for every thread. 
+ */
+void des_stats_reset(void);
+
+/**
+ * Returns the name of the specified timed function. 
+ *
+ * PARAMETERS: 
+ * id - the timed function
+ *
+ * RETURNS: 
+ * The name, or NULL if the id is invalid. 
+ */
+const char *des_stat_name(des_stat_id id);
+
+/**
+ * Prints the specified snapshot, one counter per line. 
+ *
+ * PARAMETERS: 
+ * f  - the file to print to
+ * st - the snapshot
+ */
+void des_stats_print(FILE *f, const des_stats *st);
+
+/**
+ * Prints a snapshot to the specified file every interval from a background 
+ * thread, replacing any earlier dump. An interval of 0 stops the dump. 
+ *
+ * PARAMETERS: 
+ * f        - the file to print to
+ * interval - milliseconds between snapshots, 0 to stop
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) if the counters are 
+ * not compiled in or the thread cannot be started. 
+ */
+_Bool des_stats_dump(FILE *f, unsigned interval);
+
+/**
+ * Returns the clock the timed functions are measured with, the time stamp 
+ * counter on x86 and a monotonic clock in nanoseconds elsewhere. 
+ *
+ * RETURNS: 
+ * The clock. 
+ */
+uint64_t des_stats_clock(void);
+
+/**
+ * Counts a call to the specified function on the calling thread, for the 
+ * DES_STAT_STOP() macro. 
+ *
+ * PARAMETERS: 
+ * id     - the timed function
+ * cycles - the clock ticks the call took
+ */
+void des_stats_add(des_stat_id id, uint64_t cycles);
+
+/**
+ * Counts untimed calls to the specified function on the calling thread, 
+ * for the DES_STAT_CALLS() macro. 
+ *
+ * PARAMETERS: 
+ * id - the counted function
+ * n  - the number of calls
+ */
+void des_stats_calls(des_stat_id id, uint64_t n);
+
+/**
+ * Counts bytes through the specified mode on the calling thread, for the 
+ * DES_STAT_BYTES() macro. 
+ *
+ * PARAMETERS: 
+ * mode - the mode of operation
+ * n    - the number of bytes
+ */
+void des_stats_bytes(des_mode mode, uint64_t n);
+
+/**
+ * Counts bitsliced blocks on the specified backend on the calling thread, 
+ * for the DES_STAT_BLOCKS() macro. 
+ *
+ * PARAMETERS: 
+ * b - the backend running the blocks
+ * n - the number of blocks
+ */
+void des_stats_blocks(des_backend b, uint64_t n);
+
+/**
+ * Counts an allocation on the calling thread, for the DES_STAT_ALLOC() 
+ * macro. 
+ *
+ * PARAMETERS: 
+ * n - the number of bytes allocated
+ */
+void des_stats_alloc(uint64_t n);
+
+#endif
@@ -0,0 +1,308 @@
+/**
+ * FILE:   desstream.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Streaming encryption of files and pipes through a mode of operation 
+ * context, with bounded memory. Regular files are mapped into memory a 
+ * window at a time, then read to the end in case they grew. Other inputs 
+ * are read by a second thread into two buffers, every read handed over as 
+ * soon as it returns, so reading overlaps with encrypting and writing. 
+ *
+ * C99, POSIX
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <errno.h>
+#include <pthread.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "desstream.h"
+
+/**
+ * The state of a stream, shared by the reading and the encrypting side. 
+ */
+typedef struct Stream {
+    des_mode_ctx *ctx;          //the context
+    des_pool *pool;             //pool for parallel modes, may be NULL
+    int infd;                   //input file descriptor
+    int outfd;                  //output file descriptor
+    uint8_t *out;               //output buffer, DES_STREAM_BUF + 8 bytes
+} Stream;
+
+/**
+ * The double buffer of a pipe, filled by the reader thread. 
+ */
+typedef struct Reader {
+    int fd;                     //input file descriptor
+    uint8_t *buf[2];            //the two read buffers
+    size_t len[2];              //bytes in each buffer, 0 at the end
+    _Bool full[2];              //whether each buffer is waiting to be used
+    _Bool err;                  //whether reading failed
+    _Bool stop;                 //whether the reader should exit
+    pthread_mutex_t lock;       //guards the fields above
+    pthread_cond_t cond;        //signalled when a buffer changes
+    int wake[2];                //self-pipe waking a reader blocked on fd
+} Reader;
+
+static _Bool stream_mmap(Stream *s, size_t size);
+static _Bool stream_pipe(Stream *s);
+static void *reader(void *arg);
+static ssize_t read_some(Reader *r, uint8_t *b);
+static _Bool process(Stream *s, const uint8_t *in, size_t len);
+static _Bool write_all(int fd, const uint8_t *b, size_t len);
+
+/**
+ * Encrypts or decrypts everything from the input file descriptor to the 
+ * output file descriptor, then finishes the message with des_mode_final(). 
+ * The context must be initialised with des_mode_init() or 
+ * tdes_mode_init(). At most a few buffers of DES_STREAM_BUF bytes are 
+ * allocated, whatever the length of the input. 
+ *
+ * PARAMETERS: 
+ * ctx   - the context
+ * pool  - the pool for parallel modes, or NULL to run on this thread
+ * infd  - the input file descriptor
+ * outfd - the output file descriptor
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) if reading or 
+ * writing failed, or if the message does not fit the mode or padding. 
+ */
+_Bool des_stream(des_mode_ctx *ctx, des_pool *pool, int infd, int outfd) {
+    if (ctx == NULL || infd < 0 || outfd < 0)
+        return false;
+
+    Stream s = { ctx, pool, infd, outfd, malloc(DES_STREAM_BUF + 8) };
+    if (s.out == NULL)
+        return false;
+
+    struct stat st;
+    _Bool ok;
+    if (fstat(infd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 &&
+            lseek(infd, 0, SEEK_CUR) == 0)
+        ok = stream_mmap(&s, (size_t)st.st_size);
+    else
+        ok = stream_pipe(&s);
+
+    size_t len = 0;
+    ok = ok && des_mode_final(ctx, s.out, &len) &&
+            write_all(outfd, s.out, len);
+    free(s.out);
+    return ok;
+}
+
+/**
+ * Streams a regular file, mapping DES_STREAM_MAP bytes of it at a time up 
+ * to the size reported by fstat(), then reads anything appended since up 
+ * to the end. Falls back to reading the file when it cannot be mapped. 
+ *
+ * PARAMETERS: 
+ * s    - the stream
+ * size - the size of the file when opened
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+static _Bool stream_mmap(Stream *s, size_t size) {
+    for (size_t off = 0; off < size; off += DES_STREAM_MAP) {
+        size_t len = (size - off < DES_STREAM_MAP ? size - off :
+                DES_STREAM_MAP);
+        uint8_t *map = mmap(NULL, len, PROT_READ, MAP_PRIVATE, s->infd,
+                (off_t)off);
+        if (map == MAP_FAILED) {
+            if (off == 0)
+                return stream_pipe(s);      //not mappable, read it instead
+            return false;
+        }
+
+        posix_madvise(map, len, POSIX_MADV_SEQUENTIAL);
+        _Bool ok = true;
+        for (size_t i = 0; ok && i < len; i += DES_STREAM_BUF)
+            ok = process(s, map + i, (len - i < DES_STREAM_BUF ?
+                    len - i : DES_STREAM_BUF));
+        munmap(map, len);
+        if (!ok)
+            return false;
+    }
+    if (lseek(s->infd, (off_t)size, SEEK_SET) < 0)
+        return false;
+    return stream_pipe(s);      //the file may have grown since fstat()
+}
+
+/**
+ * Streams a pipe or any other input through two buffers. A reader thread 
+ * fills one buffer while this thread encrypts and writes the other. When 
+ * this thread fails, the self-pipe wakes the reader even if it is blocked 
+ * waiting for input. 
+ *
+ * PARAMETERS: 
+ * s - the stream
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+static _Bool stream_pipe(Stream *s) {
+    Reader r = { s->infd, { NULL, NULL }, { 0, 0 }, { false, false }, false,
+            false, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER,
+            { -1, -1 } };
+    if (pipe(r.wake) != 0)
+        return false;
+    r.buf[0] = malloc(DES_STREAM_BUF);
+    r.buf[1] = malloc(DES_STREAM_BUF);
+    pthread_t thread;
+    if (r.buf[0] == NULL || r.buf[1] == NULL ||
+            pthread_create(&thread, NULL, &reader, &r) != 0) {
+        free(r.buf[0]);
+        free(r.buf[1]);
+        close(r.wake[0]);
+        close(r.wake[1]);
+        return false;
+    }
+
+    _Bool ok = true;
+    for (int i = 0; ok; i ^= 1) {
+        pthread_mutex_lock(&r.lock);
+        while (!r.full[i])
+            pthread_cond_wait(&r.cond, &r.lock);
+        size_t len = r.len[i];
+        ok = !r.err;
+        pthread_mutex_unlock(&r.lock);
+        if (!ok || len == 0)
+            break;              //read error, or end of input
+
+        ok = process(s, r.buf[i], len);
+        pthread_mutex_lock(&r.lock);
+        r.full[i] = false;      //hand the buffer back to the reader
+        pthread_cond_broadcast(&r.cond);
+        pthread_mutex_unlock(&r.lock);
+    }
+
+    pthread_mutex_lock(&r.lock);
+    r.stop = true;
+    pthread_cond_broadcast(&r.cond);
+    pthread_mutex_unlock(&r.lock);
+    while (write(r.wake[1], "", 1) < 0 && errno == EINTR)
+        ;                       //wake the reader blocked in poll()
+    pthread_join(thread, NULL);
+    pthread_mutex_destroy(&r.lock);
+    pthread_cond_destroy(&r.cond);
+    close(r.wake[0]);
+    close(r.wake[1]);
+    free(r.buf[0]);
+    free(r.buf[1]);
+    return ok;
+}
+
+/**
+ * The reader thread function. Fills the two buffers in turn until the end 
+ * of input, an error, or until told to stop. Every buffer holds the bytes 
+ * of a single read, so slow input is passed on as soon as it arrives. An 
+ * empty buffer marks the end. 
+ *
+ * PARAMETERS: 
+ * arg - the double buffer
+ *
+ * RETURNS: 
+ * NULL. 
+ */
+static void *reader(void *arg) {
+    Reader *r = arg;
+    for (int i = 0;; i ^= 1) {
+        pthread_mutex_lock(&r->lock);
+        while (r->full[i] && !r->stop)
+            pthread_cond_wait(&r->cond, &r->lock);
+        _Bool stop = r->stop;
+        pthread_mutex_unlock(&r->lock);
+        if (stop)
+            return NULL;
+
+        ssize_t n = read_some(r, r->buf[i]);
+        if (n == -2)
+            return NULL;        //woken to stop
+        size_t len = (n > 0 ? (size_t)n : 0);
+
+        pthread_mutex_lock(&r->lock);
+        r->len[i] = len;
+        r->err = r->err || n < 0;
+        r->full[i] = true;
+        pthread_cond_broadcast(&r->cond);
+        pthread_mutex_unlock(&r->lock);
+        if (len == 0)
+            return NULL;
+    }
+}
+
+/**
+ * Reads up to DES_STREAM_BUF bytes of input once some are available, 
+ * waiting in poll() on the input and the self-pipe together so that 
+ * stopping the reader never waits for the input. 
+ *
+ * PARAMETERS: 
+ * r - the double buffer
+ * b - the buffer to read into
+ *
+ * RETURNS: 
+ * The number of bytes read, 0 at the end of input, -1 if reading failed 
+ * or -2 if the reader is told to stop. 
+ */
+static ssize_t read_some(Reader *r, uint8_t *b) {
+    for (;;) {
+        struct pollfd fds[2] = { { r->fd, POLLIN, 0 },
+                { r->wake[0], POLLIN, 0 } };
+        if (poll(fds, 2, -1) < 0 && errno == EINTR)
+            continue;           //on other errors, let read() decide
+        if (fds[1].revents != 0)
+            return -2;
+        ssize_t n = read(r->fd, b, DES_STREAM_BUF);
+        if (n < 0 && (errno == EINTR || errno == EAGAIN))
+            continue;
+        return n;
+    }
+}
+
+/**
+ * Passes the specified bytes through the context, on the pool if there is 
+ * one, and writes the result. 
+ *
+ * PARAMETERS: 
+ * s   - the stream
+ * in  - the input bytes
+ * len - the number of input bytes, up to DES_STREAM_BUF
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) otherwise. 
+ */
+static _Bool process(Stream *s, const uint8_t *in, size_t len) {
+    size_t outlen = 0;
+    _Bool ok = (s->pool != NULL ?
+            des_mode_parallel(s->pool, s->ctx, s->out, &outlen, in, len) :
+            des_mode_update(s->ctx, s->out, &outlen, in, len));
+    return ok && write_all(s->outfd, s->out, outlen);
+}
+
+/**
+ * Writes all of the specified bytes, retrying short writes. 
+ *
+ * PARAMETERS: 
+ * fd  - the file descriptor to write
+ * b   - the bytes to write
+ * len - the number of bytes
+ *
+ * RETURNS: 
+ * 1 (true) if every byte is written, 0 (false) otherwise. 
+ */
+static _Bool write_all(int fd, const uint8_t *b, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, b, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        b += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
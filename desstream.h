@@ -0,0 +1,53 @@
+/**
+ * FILE:   desstream.h
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Streaming encryption of files and pipes through a mode of operation 
+ * context, with bounded memory. Regular files are mapped into memory a 
+ * window at a time, then read to the end in case they grew. Other inputs 
+ * are read by a second thread into two buffers, every read handed over as 
+ * soon as it returns, so reading overlaps with encrypting and writing. 
+ *
+ * C99, POSIX
+ */
+
+#ifndef __desstream_h__
+#define __desstream_h__
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "desmode.h"
+#include "despar.h"
+
+/**
+ * The size of every read buffer, and the most bytes passed to the context 
+ * at a time. 
+ */
+#define DES_STREAM_BUF (1 << 20)
+
+/**
+ * The size of the window of a regular file mapped into memory at a time. 
+ */
+#define DES_STREAM_MAP (64 << 20)
+
+/**
+ * Encrypts or decrypts everything from the input file descriptor to the 
+ * output file descriptor, then finishes the message with des_mode_final(). 
+ * The context must be initialised with des_mode_init() or 
+ * tdes_mode_init(). At most a few buffers of DES_STREAM_BUF bytes are 
+ * allocated, whatever the length of the input. 
+ *
+ * PARAMETERS: 
+ * ctx   - the context
+ * pool  - the pool for parallel modes, or NULL to run on this thread
+ * infd  - the input file descriptor
+ * outfd - the output file descriptor
+ *
+ * RETURNS: 
+ * 1 (true) if this function is successful, 0 (false) if reading or 
+ * writing failed, or if the message does not fit the mode or padding. 
+ */
+_Bool des_stream(des_mode_ctx *ctx, des_pool *pool, int infd, int outfd);
+
+#endif
@@ -0,0 +1,2169 @@
+/**
+ * FILE:   destab.h
+ * AUTHOR: PotatoMaster101
+ * 
+ * Lookup tables for the DES cipher. Generated by tabgen.c, do not edit. 
+ *
+ * C99
+ */
+
+#ifndef __destab_h__
+#define __destab_h__
+#include <stdint.h>
+#include "desperm.h"
+
+
+/**
+ * The initial permutation IP, compiled by des_perm_compile(). 
+ */
+static const des_perm STD_IP = {
+    64, 64, 8, 0, 
+    //input bits of every PEXT/PDEP group
+    {
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000
+    }, 
+    //output bits of every PEXT/PDEP group
+    {
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000
+    }, 
+    {
+        //byte 0
+        {
+            0x0000000000000000, 0x0000008000000000, 0x0000000000000080, 0x0000008000000080, 
+            0x0000800000000000, 0x0000808000000000, 0x0000800000000080, 0x0000808000000080, 
+            0x0000000000008000, 0x0000008000008000, 0x0000000000008080, 0x0000008000008080, 
+            0x0000800000008000, 0x0000808000008000, 0x0000800000008080, 0x0000808000008080, 
+            0x0080000000000000, 0x0080008000000000, 0x0080000000000080, 0x0080008000000080, 
+            0x0080800000000000, 0x0080808000000000, 0x0080800000000080, 0x0080808000000080, 
+            0x0080000000008000, 0x0080008000008000, 0x0080000000008080, 0x0080008000008080, 
+            0x0080800000008000, 0x0080808000008000, 0x0080800000008080, 0x0080808000008080, 
+            0x0000000000800000, 0x0000008000800000, 0x0000000000800080, 0x0000008000800080, 
+            0x0000800000800000, 0x0000808000800000, 0x0000800000800080, 0x0000808000800080, 
+            0x0000000000808000, 0x0000008000808000, 0x0000000000808080, 0x0000008000808080, 
+            0x0000800000808000, 0x0000808000808000, 0x0000800000808080, 0x0000808000808080, 
+            0x0080000000800000, 0x0080008000800000, 0x0080000000800080, 0x0080008000800080, 
+            0x0080800000800000, 0x0080808000800000, 0x0080800000800080, 0x0080808000800080, 
+            0x0080000000808000, 0x0080008000808000, 0x0080000000808080, 0x0080008000808080, 
+            0x0080800000808000, 0x0080808000808000, 0x0080800000808080, 0x0080808000808080, 
+            0x8000000000000000, 0x8000008000000000, 0x8000000000000080, 0x8000008000000080, 
+            0x8000800000000000, 0x8000808000000000, 0x8000800000000080, 0x8000808000000080, 
+            0x8000000000008000, 0x8000008000008000, 0x8000000000008080, 0x8000008000008080, 
+            0x8000800000008000, 0x8000808000008000, 0x8000800000008080, 0x8000808000008080, 
+            0x8080000000000000, 0x8080008000000000, 0x8080000000000080, 0x8080008000000080, 
+            0x8080800000000000, 0x8080808000000000, 0x8080800000000080, 0x8080808000000080, 
+            0x8080000000008000, 0x8080008000008000, 0x8080000000008080, 0x8080008000008080, 
+            0x8080800000008000, 0x8080808000008000, 0x8080800000008080, 0x8080808000008080, 
+            0x8000000000800000, 0x8000008000800000, 0x8000000000800080, 0x8000008000800080, 
+            0x8000800000800000, 0x8000808000800000, 0x8000800000800080, 0x8000808000800080, 
+            0x8000000000808000, 0x8000008000808000, 0x8000000000808080, 0x8000008000808080, 
+            0x8000800000808000, 0x8000808000808000, 0x8000800000808080, 0x8000808000808080, 
+            0x8080000000800000, 0x8080008000800000, 0x8080000000800080, 0x8080008000800080, 
+            0x8080800000800000, 0x8080808000800000, 0x8080800000800080, 0x8080808000800080, 
+            0x8080000000808000, 0x8080008000808000, 0x8080000000808080, 0x8080008000808080, 
+            0x8080800000808000, 0x8080808000808000, 0x8080800000808080, 0x8080808000808080, 
+            0x0000000080000000, 0x0000008080000000, 0x0000000080000080, 0x0000008080000080, 
+            0x0000800080000000, 0x0000808080000000, 0x0000800080000080, 0x0000808080000080, 
+            0x0000000080008000, 0x0000008080008000, 0x0000000080008080, 0x0000008080008080, 
+            0x0000800080008000, 0x0000808080008000, 0x0000800080008080, 0x0000808080008080, 
+            0x0080000080000000, 0x0080008080000000, 0x0080000080000080, 0x0080008080000080, 
+            0x0080800080000000, 0x0080808080000000, 0x0080800080000080, 0x0080808080000080, 
+            0x0080000080008000, 0x0080008080008000, 0x0080000080008080, 0x0080008080008080, 
+            0x0080800080008000, 0x0080808080008000, 0x0080800080008080, 0x0080808080008080, 
+            0x0000000080800000, 0x0000008080800000, 0x0000000080800080, 0x0000008080800080, 
+            0x0000800080800000, 0x0000808080800000, 0x0000800080800080, 0x0000808080800080, 
+            0x0000000080808000, 0x0000008080808000, 0x0000000080808080, 0x0000008080808080, 
+            0x0000800080808000, 0x0000808080808000, 0x0000800080808080, 0x0000808080808080, 
+            0x0080000080800000, 0x0080008080800000, 0x0080000080800080, 0x0080008080800080, 
+            0x0080800080800000, 0x0080808080800000, 0x0080800080800080, 0x0080808080800080, 
+            0x0080000080808000, 0x0080008080808000, 0x0080000080808080, 0x0080008080808080, 
+            0x0080800080808000, 0x0080808080808000, 0x0080800080808080, 0x0080808080808080, 
+            0x8000000080000000, 0x8000008080000000, 0x8000000080000080, 0x8000008080000080, 
+            0x8000800080000000, 0x8000808080000000, 0x8000800080000080, 0x8000808080000080, 
+            0x8000000080008000, 0x8000008080008000, 0x8000000080008080, 0x8000008080008080, 
+            0x8000800080008000, 0x8000808080008000, 0x8000800080008080, 0x8000808080008080, 
+            0x8080000080000000, 0x8080008080000000, 0x8080000080000080, 0x8080008080000080, 
+            0x8080800080000000, 0x8080808080000000, 0x8080800080000080, 0x8080808080000080, 
+            0x8080000080008000, 0x8080008080008000, 0x8080000080008080, 0x8080008080008080, 
+            0x8080800080008000, 0x8080808080008000, 0x8080800080008080, 0x8080808080008080, 
+            0x8000000080800000, 0x8000008080800000, 0x8000000080800080, 0x8000008080800080, 
+            0x8000800080800000, 0x8000808080800000, 0x8000800080800080, 0x8000808080800080, 
+            0x8000000080808000, 0x8000008080808000, 0x8000000080808080, 0x8000008080808080, 
+            0x8000800080808000, 0x8000808080808000, 0x8000800080808080, 0x8000808080808080, 
+            0x8080000080800000, 0x8080008080800000, 0x8080000080800080, 0x8080008080800080, 
+            0x8080800080800000, 0x8080808080800000, 0x8080800080800080, 0x8080808080800080, 
+            0x8080000080808000, 0x8080008080808000, 0x8080000080808080, 0x8080008080808080, 
+            0x8080800080808000, 0x8080808080808000, 0x8080800080808080, 0x8080808080808080
+        }, 
+        //byte 1
+        {
+            0x0000000000000000, 0x0000004000000000, 0x0000000000000040, 0x0000004000000040, 
+            0x0000400000000000, 0x0000404000000000, 0x0000400000000040, 0x0000404000000040, 
+            0x0000000000004000, 0x0000004000004000, 0x0000000000004040, 0x0000004000004040, 
+            0x0000400000004000, 0x0000404000004000, 0x0000400000004040, 0x0000404000004040, 
+            0x0040000000000000, 0x0040004000000000, 0x0040000000000040, 0x0040004000000040, 
+            0x0040400000000000, 0x0040404000000000, 0x0040400000000040, 0x0040404000000040, 
+            0x0040000000004000, 0x0040004000004000, 0x0040000000004040, 0x0040004000004040, 
+            0x0040400000004000, 0x0040404000004000, 0x0040400000004040, 0x0040404000004040, 
+            0x0000000000400000, 0x0000004000400000, 0x0000000000400040, 0x0000004000400040, 
+            0x0000400000400000, 0x0000404000400000, 0x0000400000400040, 0x0000404000400040, 
+            0x0000000000404000, 0x0000004000404000, 0x0000000000404040, 0x0000004000404040, 
+            0x0000400000404000, 0x0000404000404000, 0x0000400000404040, 0x0000404000404040, 
+            0x0040000000400000, 0x0040004000400000, 0x0040000000400040, 0x0040004000400040, 
+            0x0040400000400000, 0x0040404000400000, 0x0040400000400040, 0x0040404000400040, 
+            0x0040000000404000, 0x0040004000404000, 0x0040000000404040, 0x0040004000404040, 
+            0x0040400000404000, 0x0040404000404000, 0x0040400000404040, 0x0040404000404040, 
+            0x4000000000000000, 0x4000004000000000, 0x4000000000000040, 0x4000004000000040, 
+            0x4000400000000000, 0x4000404000000000, 0x4000400000000040, 0x4000404000000040, 
+            0x4000000000004000, 0x4000004000004000, 0x4000000000004040, 0x4000004000004040, 
+            0x4000400000004000, 0x4000404000004000, 0x4000400000004040, 0x4000404000004040, 
+            0x4040000000000000, 0x4040004000000000, 0x4040000000000040, 0x4040004000000040, 
+            0x4040400000000000, 0x4040404000000000, 0x4040400000000040, 0x4040404000000040, 
+            0x4040000000004000, 0x4040004000004000, 0x4040000000004040, 0x4040004000004040, 
+            0x4040400000004000, 0x4040404000004000, 0x4040400000004040, 0x4040404000004040, 
+            0x4000000000400000, 0x4000004000400000, 0x4000000000400040, 0x4000004000400040, 
+            0x4000400000400000, 0x4000404000400000, 0x4000400000400040, 0x4000404000400040, 
+            0x4000000000404000, 0x4000004000404000, 0x4000000000404040, 0x4000004000404040, 
+            0x4000400000404000, 0x4000404000404000, 0x4000400000404040, 0x4000404000404040, 
+            0x4040000000400000, 0x4040004000400000, 0x4040000000400040, 0x4040004000400040, 
+            0x4040400000400000, 0x4040404000400000, 0x4040400000400040, 0x4040404000400040, 
+            0x4040000000404000, 0x4040004000404000, 0x4040000000404040, 0x4040004000404040, 
+            0x4040400000404000, 0x4040404000404000, 0x4040400000404040, 0x4040404000404040, 
+            0x0000000040000000, 0x0000004040000000, 0x0000000040000040, 0x0000004040000040, 
+            0x0000400040000000, 0x0000404040000000, 0x0000400040000040, 0x0000404040000040, 
+            0x0000000040004000, 0x0000004040004000, 0x0000000040004040, 0x0000004040004040, 
+            0x0000400040004000, 0x0000404040004000, 0x0000400040004040, 0x0000404040004040, 
+            0x0040000040000000, 0x0040004040000000, 0x0040000040000040, 0x0040004040000040, 
+            0x0040400040000000, 0x0040404040000000, 0x0040400040000040, 0x0040404040000040, 
+            0x0040000040004000, 0x0040004040004000, 0x0040000040004040, 0x0040004040004040, 
+            0x0040400040004000, 0x0040404040004000, 0x0040400040004040, 0x0040404040004040, 
+            0x0000000040400000, 0x0000004040400000, 0x0000000040400040, 0x0000004040400040, 
+            0x0000400040400000, 0x0000404040400000, 0x0000400040400040, 0x0000404040400040, 
+            0x0000000040404000, 0x0000004040404000, 0x0000000040404040, 0x0000004040404040, 
+            0x0000400040404000, 0x0000404040404000, 0x0000400040404040, 0x0000404040404040, 
+            0x0040000040400000, 0x0040004040400000, 0x0040000040400040, 0x0040004040400040, 
+            0x0040400040400000, 0x0040404040400000, 0x0040400040400040, 0x0040404040400040, 
+            0x0040000040404000, 0x0040004040404000, 0x0040000040404040, 0x0040004040404040, 
+            0x0040400040404000, 0x0040404040404000, 0x0040400040404040, 0x0040404040404040, 
+            0x4000000040000000, 0x4000004040000000, 0x4000000040000040, 0x4000004040000040, 
+            0x4000400040000000, 0x4000404040000000, 0x4000400040000040, 0x4000404040000040, 
+            0x4000000040004000, 0x4000004040004000, 0x4000000040004040, 0x4000004040004040, 
+            0x4000400040004000, 0x4000404040004000, 0x4000400040004040, 0x4000404040004040, 
+            0x4040000040000000, 0x4040004040000000, 0x4040000040000040, 0x4040004040000040, 
+            0x4040400040000000, 0x4040404040000000, 0x4040400040000040, 0x4040404040000040, 
+            0x4040000040004000, 0x4040004040004000, 0x4040000040004040, 0x4040004040004040, 
+            0x4040400040004000, 0x4040404040004000, 0x4040400040004040, 0x4040404040004040, 
+            0x4000000040400000, 0x4000004040400000, 0x4000000040400040, 0x4000004040400040, 
+            0x4000400040400000, 0x4000404040400000, 0x4000400040400040, 0x4000404040400040, 
+            0x4000000040404000, 0x4000004040404000, 0x4000000040404040, 0x4000004040404040, 
+            0x4000400040404000, 0x4000404040404000, 0x4000400040404040, 0x4000404040404040, 
+            0x4040000040400000, 0x4040004040400000, 0x4040000040400040, 0x4040004040400040, 
+            0x4040400040400000, 0x4040404040400000, 0x4040400040400040, 0x4040404040400040, 
+            0x4040000040404000, 0x4040004040404000, 0x4040000040404040, 0x4040004040404040, 
+            0x4040400040404000, 0x4040404040404000, 0x4040400040404040, 0x4040404040404040
+        }, 
+        //byte 2
+        {
+            0x0000000000000000, 0x0000002000000000, 0x0000000000000020, 0x0000002000000020, 
+            0x0000200000000000, 0x0000202000000000, 0x0000200000000020, 0x0000202000000020, 
+            0x0000000000002000, 0x0000002000002000, 0x0000000000002020, 0x0000002000002020, 
+            0x0000200000002000, 0x0000202000002000, 0x0000200000002020, 0x0000202000002020, 
+            0x0020000000000000, 0x0020002000000000, 0x0020000000000020, 0x0020002000000020, 
+            0x0020200000000000, 0x0020202000000000, 0x0020200000000020, 0x0020202000000020, 
+            0x0020000000002000, 0x0020002000002000, 0x0020000000002020, 0x0020002000002020, 
+            0x0020200000002000, 0x0020202000002000, 0x0020200000002020, 0x0020202000002020, 
+            0x0000000000200000, 0x0000002000200000, 0x0000000000200020, 0x0000002000200020, 
+            0x0000200000200000, 0x0000202000200000, 0x0000200000200020, 0x0000202000200020, 
+            0x0000000000202000, 0x0000002000202000, 0x0000000000202020, 0x0000002000202020, 
+            0x0000200000202000, 0x0000202000202000, 0x0000200000202020, 0x0000202000202020, 
+            0x0020000000200000, 0x0020002000200000, 0x0020000000200020, 0x0020002000200020, 
+            0x0020200000200000, 0x0020202000200000, 0x0020200000200020, 0x0020202000200020, 
+            0x0020000000202000, 0x0020002000202000, 0x0020000000202020, 0x0020002000202020, 
+            0x0020200000202000, 0x0020202000202000, 0x0020200000202020, 0x0020202000202020, 
+            0x2000000000000000, 0x2000002000000000, 0x2000000000000020, 0x2000002000000020, 
+            0x2000200000000000, 0x2000202000000000, 0x2000200000000020, 0x2000202000000020, 
+            0x2000000000002000, 0x2000002000002000, 0x2000000000002020, 0x2000002000002020, 
+            0x2000200000002000, 0x2000202000002000, 0x2000200000002020, 0x2000202000002020, 
+            0x2020000000000000, 0x2020002000000000, 0x2020000000000020, 0x2020002000000020, 
+            0x2020200000000000, 0x2020202000000000, 0x2020200000000020, 0x2020202000000020, 
+            0x2020000000002000, 0x2020002000002000, 0x2020000000002020, 0x2020002000002020, 
+            0x2020200000002000, 0x2020202000002000, 0x2020200000002020, 0x2020202000002020, 
+            0x2000000000200000, 0x2000002000200000, 0x2000000000200020, 0x2000002000200020, 
+            0x2000200000200000, 0x2000202000200000, 0x2000200000200020, 0x2000202000200020, 
+            0x2000000000202000, 0x2000002000202000, 0x2000000000202020, 0x2000002000202020, 
+            0x2000200000202000, 0x2000202000202000, 0x2000200000202020, 0x2000202000202020, 
+            0x2020000000200000, 0x2020002000200000, 0x2020000000200020, 0x2020002000200020, 
+            0x2020200000200000, 0x2020202000200000, 0x2020200000200020, 0x2020202000200020, 
+            0x2020000000202000, 0x2020002000202000, 0x2020000000202020, 0x2020002000202020, 
+            0x2020200000202000, 0x2020202000202000, 0x2020200000202020, 0x2020202000202020, 
+            0x0000000020000000, 0x0000002020000000, 0x0000000020000020, 0x0000002020000020, 
+            0x0000200020000000, 0x0000202020000000, 0x0000200020000020, 0x0000202020000020, 
+            0x0000000020002000, 0x0000002020002000, 0x0000000020002020, 0x0000002020002020, 
+            0x0000200020002000, 0x0000202020002000, 0x0000200020002020, 0x0000202020002020, 
+            0x0020000020000000, 0x0020002020000000, 0x0020000020000020, 0x0020002020000020, 
+            0x0020200020000000, 0x0020202020000000, 0x0020200020000020, 0x0020202020000020, 
+            0x0020000020002000, 0x0020002020002000, 0x0020000020002020, 0x0020002020002020, 
+            0x0020200020002000, 0x0020202020002000, 0x0020200020002020, 0x0020202020002020, 
+            0x0000000020200000, 0x0000002020200000, 0x0000000020200020, 0x0000002020200020, 
+            0x0000200020200000, 0x0000202020200000, 0x0000200020200020, 0x0000202020200020, 
+            0x0000000020202000, 0x0000002020202000, 0x0000000020202020, 0x0000002020202020, 
+            0x0000200020202000, 0x0000202020202000, 0x0000200020202020, 0x0000202020202020, 
+            0x0020000020200000, 0x0020002020200000, 0x0020000020200020, 0x0020002020200020, 
+            0x0020200020200000, 0x0020202020200000, 0x0020200020200020, 0x0020202020200020, 
+            0x0020000020202000, 0x0020002020202000, 0x0020000020202020, 0x0020002020202020, 
+            0x0020200020202000, 0x0020202020202000, 0x0020200020202020, 0x0020202020202020, 
+            0x2000000020000000, 0x2000002020000000, 0x2000000020000020, 0x2000002020000020, 
+            0x2000200020000000, 0x2000202020000000, 0x2000200020000020, 0x2000202020000020, 
+            0x2000000020002000, 0x2000002020002000, 0x2000000020002020, 0x2000002020002020, 
+            0x2000200020002000, 0x2000202020002000, 0x2000200020002020, 0x2000202020002020, 
+            0x2020000020000000, 0x2020002020000000, 0x2020000020000020, 0x2020002020000020, 
+            0x2020200020000000, 0x2020202020000000, 0x2020200020000020, 0x2020202020000020, 
+            0x2020000020002000, 0x2020002020002000, 0x2020000020002020, 0x2020002020002020, 
+            0x2020200020002000, 0x2020202020002000, 0x2020200020002020, 0x2020202020002020, 
+            0x2000000020200000, 0x2000002020200000, 0x2000000020200020, 0x2000002020200020, 
+            0x2000200020200000, 0x2000202020200000, 0x2000200020200020, 0x2000202020200020, 
+            0x2000000020202000, 0x2000002020202000, 0x2000000020202020, 0x2000002020202020, 
+            0x2000200020202000, 0x2000202020202000, 0x2000200020202020, 0x2000202020202020, 
+            0x2020000020200000, 0x2020002020200000, 0x2020000020200020, 0x2020002020200020, 
+            0x2020200020200000, 0x2020202020200000, 0x2020200020200020, 0x2020202020200020, 
+            0x2020000020202000, 0x2020002020202000, 0x2020000020202020, 0x2020002020202020, 
+            0x2020200020202000, 0x2020202020202000, 0x2020200020202020, 0x2020202020202020
+        }, 
+        //byte 3
+        {
+            0x0000000000000000, 0x0000001000000000, 0x0000000000000010, 0x0000001000000010, 
+            0x0000100000000000, 0x0000101000000000, 0x0000100000000010, 0x0000101000000010, 
+            0x0000000000001000, 0x0000001000001000, 0x0000000000001010, 0x0000001000001010, 
+            0x0000100000001000, 0x0000101000001000, 0x0000100000001010, 0x0000101000001010, 
+            0x0010000000000000, 0x0010001000000000, 0x0010000000000010, 0x0010001000000010, 
+            0x0010100000000000, 0x0010101000000000, 0x0010100000000010, 0x0010101000000010, 
+            0x0010000000001000, 0x0010001000001000, 0x0010000000001010, 0x0010001000001010, 
+            0x0010100000001000, 0x0010101000001000, 0x0010100000001010, 0x0010101000001010, 
+            0x0000000000100000, 0x0000001000100000, 0x0000000000100010, 0x0000001000100010, 
+            0x0000100000100000, 0x0000101000100000, 0x0000100000100010, 0x0000101000100010, 
+            0x0000000000101000, 0x0000001000101000, 0x0000000000101010, 0x0000001000101010, 
+            0x0000100000101000, 0x0000101000101000, 0x0000100000101010, 0x0000101000101010, 
+            0x0010000000100000, 0x0010001000100000, 0x0010000000100010, 0x0010001000100010, 
+            0x0010100000100000, 0x0010101000100000, 0x0010100000100010, 0x0010101000100010, 
+            0x0010000000101000, 0x0010001000101000, 0x0010000000101010, 0x0010001000101010, 
+            0x0010100000101000, 0x0010101000101000, 0x0010100000101010, 0x0010101000101010, 
+            0x1000000000000000, 0x1000001000000000, 0x1000000000000010, 0x1000001000000010, 
+            0x1000100000000000, 0x1000101000000000, 0x1000100000000010, 0x1000101000000010, 
+            0x1000000000001000, 0x1000001000001000, 0x1000000000001010, 0x1000001000001010, 
+            0x1000100000001000, 0x1000101000001000, 0x1000100000001010, 0x1000101000001010, 
+            0x1010000000000000, 0x1010001000000000, 0x1010000000000010, 0x1010001000000010, 
+            0x1010100000000000, 0x1010101000000000, 0x1010100000000010, 0x1010101000000010, 
+            0x1010000000001000, 0x1010001000001000, 0x1010000000001010, 0x1010001000001010, 
+            0x1010100000001000, 0x1010101000001000, 0x1010100000001010, 0x1010101000001010, 
+            0x1000000000100000, 0x1000001000100000, 0x1000000000100010, 0x1000001000100010, 
+            0x1000100000100000, 0x1000101000100000, 0x1000100000100010, 0x1000101000100010, 
+            0x1000000000101000, 0x1000001000101000, 0x1000000000101010, 0x1000001000101010, 
+            0x1000100000101000, 0x1000101000101000, 0x1000100000101010, 0x1000101000101010, 
+            0x1010000000100000, 0x1010001000100000, 0x1010000000100010, 0x1010001000100010, 
+            0x1010100000100000, 0x1010101000100000, 0x1010100000100010, 0x1010101000100010, 
+            0x1010000000101000, 0x1010001000101000, 0x1010000000101010, 0x1010001000101010, 
+            0x1010100000101000, 0x1010101000101000, 0x1010100000101010, 0x1010101000101010, 
+            0x0000000010000000, 0x0000001010000000, 0x0000000010000010, 0x0000001010000010, 
+            0x0000100010000000, 0x0000101010000000, 0x0000100010000010, 0x0000101010000010, 
+            0x0000000010001000, 0x0000001010001000, 0x0000000010001010, 0x0000001010001010, 
+            0x0000100010001000, 0x0000101010001000, 0x0000100010001010, 0x0000101010001010, 
+            0x0010000010000000, 0x0010001010000000, 0x0010000010000010, 0x0010001010000010, 
+            0x0010100010000000, 0x0010101010000000, 0x0010100010000010, 0x0010101010000010, 
+            0x0010000010001000, 0x0010001010001000, 0x0010000010001010, 0x0010001010001010, 
+            0x0010100010001000, 0x0010101010001000, 0x0010100010001010, 0x0010101010001010, 
+            0x0000000010100000, 0x0000001010100000, 0x0000000010100010, 0x0000001010100010, 
+            0x0000100010100000, 0x0000101010100000, 0x0000100010100010, 0x0000101010100010, 
+            0x0000000010101000, 0x0000001010101000, 0x0000000010101010, 0x0000001010101010, 
+            0x0000100010101000, 0x0000101010101000, 0x0000100010101010, 0x0000101010101010, 
+            0x0010000010100000, 0x0010001010100000, 0x0010000010100010, 0x0010001010100010, 
+            0x0010100010100000, 0x0010101010100000, 0x0010100010100010, 0x0010101010100010, 
+            0x0010000010101000, 0x0010001010101000, 0x0010000010101010, 0x0010001010101010, 
+            0x0010100010101000, 0x0010101010101000, 0x0010100010101010, 0x0010101010101010, 
+            0x1000000010000000, 0x1000001010000000, 0x1000000010000010, 0x1000001010000010, 
+            0x1000100010000000, 0x1000101010000000, 0x1000100010000010, 0x1000101010000010, 
+            0x1000000010001000, 0x1000001010001000, 0x1000000010001010, 0x1000001010001010, 
+            0x1000100010001000, 0x1000101010001000, 0x1000100010001010, 0x1000101010001010, 
+            0x1010000010000000, 0x1010001010000000, 0x1010000010000010, 0x1010001010000010, 
+            0x1010100010000000, 0x1010101010000000, 0x1010100010000010, 0x1010101010000010, 
+            0x1010000010001000, 0x1010001010001000, 0x1010000010001010, 0x1010001010001010, 
+            0x1010100010001000, 0x1010101010001000, 0x1010100010001010, 0x1010101010001010, 
+            0x1000000010100000, 0x1000001010100000, 0x1000000010100010, 0x1000001010100010, 
+            0x1000100010100000, 0x1000101010100000, 0x1000100010100010, 0x1000101010100010, 
+            0x1000000010101000, 0x1000001010101000, 0x1000000010101010, 0x1000001010101010, 
+            0x1000100010101000, 0x1000101010101000, 0x1000100010101010, 0x1000101010101010, 
+            0x1010000010100000, 0x1010001010100000, 0x1010000010100010, 0x1010001010100010, 
+            0x1010100010100000, 0x1010101010100000, 0x1010100010100010, 0x1010101010100010, 
+            0x1010000010101000, 0x1010001010101000, 0x1010000010101010, 0x1010001010101010, 
+            0x1010100010101000, 0x1010101010101000, 0x1010100010101010, 0x1010101010101010
+        }, 
+        //byte 4
+        {
+            0x0000000000000000, 0x0000000800000000, 0x0000000000000008, 0x0000000800000008, 
+            0x0000080000000000, 0x0000080800000000, 0x0000080000000008, 0x0000080800000008, 
+            0x0000000000000800, 0x0000000800000800, 0x0000000000000808, 0x0000000800000808, 
+            0x0000080000000800, 0x0000080800000800, 0x0000080000000808, 0x0000080800000808, 
+            0x0008000000000000, 0x0008000800000000, 0x0008000000000008, 0x0008000800000008, 
+            0x0008080000000000, 0x0008080800000000, 0x0008080000000008, 0x0008080800000008, 
+            0x0008000000000800, 0x0008000800000800, 0x0008000000000808, 0x0008000800000808, 
+            0x0008080000000800, 0x0008080800000800, 0x0008080000000808, 0x0008080800000808, 
+            0x0000000000080000, 0x0000000800080000, 0x0000000000080008, 0x0000000800080008, 
+            0x0000080000080000, 0x0000080800080000, 0x0000080000080008, 0x0000080800080008, 
+            0x0000000000080800, 0x0000000800080800, 0x0000000000080808, 0x0000000800080808, 
+            0x0000080000080800, 0x0000080800080800, 0x0000080000080808, 0x0000080800080808, 
+            0x0008000000080000, 0x0008000800080000, 0x0008000000080008, 0x0008000800080008, 
+            0x0008080000080000, 0x0008080800080000, 0x0008080000080008, 0x0008080800080008, 
+            0x0008000000080800, 0x0008000800080800, 0x0008000000080808, 0x0008000800080808, 
+            0x0008080000080800, 0x0008080800080800, 0x0008080000080808, 0x0008080800080808, 
+            0x0800000000000000, 0x0800000800000000, 0x0800000000000008, 0x0800000800000008, 
+            0x0800080000000000, 0x0800080800000000, 0x0800080000000008, 0x0800080800000008, 
+            0x0800000000000800, 0x0800000800000800, 0x0800000000000808, 0x0800000800000808, 
+            0x0800080000000800, 0x0800080800000800, 0x0800080000000808, 0x0800080800000808, 
+            0x0808000000000000, 0x0808000800000000, 0x0808000000000008, 0x0808000800000008, 
+            0x0808080000000000, 0x0808080800000000, 0x0808080000000008, 0x0808080800000008, 
+            0x0808000000000800, 0x0808000800000800, 0x0808000000000808, 0x0808000800000808, 
+            0x0808080000000800, 0x0808080800000800, 0x0808080000000808, 0x0808080800000808, 
+            0x0800000000080000, 0x0800000800080000, 0x0800000000080008, 0x0800000800080008, 
+            0x0800080000080000, 0x0800080800080000, 0x0800080000080008, 0x0800080800080008, 
+            0x0800000000080800, 0x0800000800080800, 0x0800000000080808, 0x0800000800080808, 
+            0x0800080000080800, 0x0800080800080800, 0x0800080000080808, 0x0800080800080808, 
+            0x0808000000080000, 0x0808000800080000, 0x0808000000080008, 0x0808000800080008, 
+            0x0808080000080000, 0x0808080800080000, 0x0808080000080008, 0x0808080800080008, 
+            0x0808000000080800, 0x0808000800080800, 0x0808000000080808, 0x0808000800080808, 
+            0x0808080000080800, 0x0808080800080800, 0x0808080000080808, 0x0808080800080808, 
+            0x0000000008000000, 0x0000000808000000, 0x0000000008000008, 0x0000000808000008, 
+            0x0000080008000000, 0x0000080808000000, 0x0000080008000008, 0x0000080808000008, 
+            0x0000000008000800, 0x0000000808000800, 0x0000000008000808, 0x0000000808000808, 
+            0x0000080008000800, 0x0000080808000800, 0x0000080008000808, 0x0000080808000808, 
+            0x0008000008000000, 0x0008000808000000, 0x0008000008000008, 0x0008000808000008, 
+            0x0008080008000000, 0x0008080808000000, 0x0008080008000008, 0x0008080808000008, 
+            0x0008000008000800, 0x0008000808000800, 0x0008000008000808, 0x0008000808000808, 
+            0x0008080008000800, 0x0008080808000800, 0x0008080008000808, 0x0008080808000808, 
+            0x0000000008080000, 0x0000000808080000, 0x0000000008080008, 0x0000000808080008, 
+            0x0000080008080000, 0x0000080808080000, 0x0000080008080008, 0x0000080808080008, 
+            0x0000000008080800, 0x0000000808080800, 0x0000000008080808, 0x0000000808080808, 
+            0x0000080008080800, 0x0000080808080800, 0x0000080008080808, 0x0000080808080808, 
+            0x0008000008080000, 0x0008000808080000, 0x0008000008080008, 0x0008000808080008, 
+            0x0008080008080000, 0x0008080808080000, 0x0008080008080008, 0x0008080808080008, 
+            0x0008000008080800, 0x0008000808080800, 0x0008000008080808, 0x0008000808080808, 
+            0x0008080008080800, 0x0008080808080800, 0x0008080008080808, 0x0008080808080808, 
+            0x0800000008000000, 0x0800000808000000, 0x0800000008000008, 0x0800000808000008, 
+            0x0800080008000000, 0x0800080808000000, 0x0800080008000008, 0x0800080808000008, 
+            0x0800000008000800, 0x0800000808000800, 0x0800000008000808, 0x0800000808000808, 
+            0x0800080008000800, 0x0800080808000800, 0x0800080008000808, 0x0800080808000808, 
+            0x0808000008000000, 0x0808000808000000, 0x0808000008000008, 0x0808000808000008, 
+            0x0808080008000000, 0x0808080808000000, 0x0808080008000008, 0x0808080808000008, 
+            0x0808000008000800, 0x0808000808000800, 0x0808000008000808, 0x0808000808000808, 
+            0x0808080008000800, 0x0808080808000800, 0x0808080008000808, 0x0808080808000808, 
+            0x0800000008080000, 0x0800000808080000, 0x0800000008080008, 0x0800000808080008, 
+            0x0800080008080000, 0x0800080808080000, 0x0800080008080008, 0x0800080808080008, 
+            0x0800000008080800, 0x0800000808080800, 0x0800000008080808, 0x0800000808080808, 
+            0x0800080008080800, 0x0800080808080800, 0x0800080008080808, 0x0800080808080808, 
+            0x0808000008080000, 0x0808000808080000, 0x0808000008080008, 0x0808000808080008, 
+            0x0808080008080000, 0x0808080808080000, 0x0808080008080008, 0x0808080808080008, 
+            0x0808000008080800, 0x0808000808080800, 0x0808000008080808, 0x0808000808080808, 
+            0x0808080008080800, 0x0808080808080800, 0x0808080008080808, 0x0808080808080808
+        }, 
+        //byte 5
+        {
+            0x0000000000000000, 0x0000000400000000, 0x0000000000000004, 0x0000000400000004, 
+            0x0000040000000000, 0x0000040400000000, 0x0000040000000004, 0x0000040400000004, 
+            0x0000000000000400, 0x0000000400000400, 0x0000000000000404, 0x0000000400000404, 
+            0x0000040000000400, 0x0000040400000400, 0x0000040000000404, 0x0000040400000404, 
+            0x0004000000000000, 0x0004000400000000, 0x0004000000000004, 0x0004000400000004, 
+            0x0004040000000000, 0x0004040400000000, 0x0004040000000004, 0x0004040400000004, 
+            0x0004000000000400, 0x0004000400000400, 0x0004000000000404, 0x0004000400000404, 
+            0x0004040000000400, 0x0004040400000400, 0x0004040000000404, 0x0004040400000404, 
+            0x0000000000040000, 0x0000000400040000, 0x0000000000040004, 0x0000000400040004, 
+            0x0000040000040000, 0x0000040400040000, 0x0000040000040004, 0x0000040400040004, 
+            0x0000000000040400, 0x0000000400040400, 0x0000000000040404, 0x0000000400040404, 
+            0x0000040000040400, 0x0000040400040400, 0x0000040000040404, 0x0000040400040404, 
+            0x0004000000040000, 0x0004000400040000, 0x0004000000040004, 0x0004000400040004, 
+            0x0004040000040000, 0x0004040400040000, 0x0004040000040004, 0x0004040400040004, 
+            0x0004000000040400, 0x0004000400040400, 0x0004000000040404, 0x0004000400040404, 
+            0x0004040000040400, 0x0004040400040400, 0x0004040000040404, 0x0004040400040404, 
+            0x0400000000000000, 0x0400000400000000, 0x0400000000000004, 0x0400000400000004, 
+            0x0400040000000000, 0x0400040400000000, 0x0400040000000004, 0x0400040400000004, 
+            0x0400000000000400, 0x0400000400000400, 0x0400000000000404, 0x0400000400000404, 
+            0x0400040000000400, 0x0400040400000400, 0x0400040000000404, 0x0400040400000404, 
+            0x0404000000000000, 0x0404000400000000, 0x0404000000000004, 0x0404000400000004, 
+            0x0404040000000000, 0x0404040400000000, 0x0404040000000004, 0x0404040400000004, 
+            0x0404000000000400, 0x0404000400000400, 0x0404000000000404, 0x0404000400000404, 
+            0x0404040000000400, 0x0404040400000400, 0x0404040000000404, 0x0404040400000404, 
+            0x0400000000040000, 0x0400000400040000, 0x0400000000040004, 0x0400000400040004, 
+            0x0400040000040000, 0x0400040400040000, 0x0400040000040004, 0x0400040400040004, 
+            0x0400000000040400, 0x0400000400040400, 0x0400000000040404, 0x0400000400040404, 
+            0x0400040000040400, 0x0400040400040400, 0x0400040000040404, 0x0400040400040404, 
+            0x0404000000040000, 0x0404000400040000, 0x0404000000040004, 0x0404000400040004, 
+            0x0404040000040000, 0x0404040400040000, 0x0404040000040004, 0x0404040400040004, 
+            0x0404000000040400, 0x0404000400040400, 0x0404000000040404, 0x0404000400040404, 
+            0x0404040000040400, 0x0404040400040400, 0x0404040000040404, 0x0404040400040404, 
+            0x0000000004000000, 0x0000000404000000, 0x0000000004000004, 0x0000000404000004, 
+            0x0000040004000000, 0x0000040404000000, 0x0000040004000004, 0x0000040404000004, 
+            0x0000000004000400, 0x0000000404000400, 0x0000000004000404, 0x0000000404000404, 
+            0x0000040004000400, 0x0000040404000400, 0x0000040004000404, 0x0000040404000404, 
+            0x0004000004000000, 0x0004000404000000, 0x0004000004000004, 0x0004000404000004, 
+            0x0004040004000000, 0x0004040404000000, 0x0004040004000004, 0x0004040404000004, 
+            0x0004000004000400, 0x0004000404000400, 0x0004000004000404, 0x0004000404000404, 
+            0x0004040004000400, 0x0004040404000400, 0x0004040004000404, 0x0004040404000404, 
+            0x0000000004040000, 0x0000000404040000, 0x0000000004040004, 0x0000000404040004, 
+            0x0000040004040000, 0x0000040404040000, 0x0000040004040004, 0x0000040404040004, 
+            0x0000000004040400, 0x0000000404040400, 0x0000000004040404, 0x0000000404040404, 
+            0x0000040004040400, 0x0000040404040400, 0x0000040004040404, 0x0000040404040404, 
+            0x0004000004040000, 0x0004000404040000, 0x0004000004040004, 0x0004000404040004, 
+            0x0004040004040000, 0x0004040404040000, 0x0004040004040004, 0x0004040404040004, 
+            0x0004000004040400, 0x0004000404040400, 0x0004000004040404, 0x0004000404040404, 
+            0x0004040004040400, 0x0004040404040400, 0x0004040004040404, 0x0004040404040404, 
+            0x0400000004000000, 0x0400000404000000, 0x0400000004000004, 0x0400000404000004, 
+            0x0400040004000000, 0x0400040404000000, 0x0400040004000004, 0x0400040404000004, 
+            0x0400000004000400, 0x0400000404000400, 0x0400000004000404, 0x0400000404000404, 
+            0x0400040004000400, 0x0400040404000400, 0x0400040004000404, 0x0400040404000404, 
+            0x0404000004000000, 0x0404000404000000, 0x0404000004000004, 0x0404000404000004, 
+            0x0404040004000000, 0x0404040404000000, 0x0404040004000004, 0x0404040404000004, 
+            0x0404000004000400, 0x0404000404000400, 0x0404000004000404, 0x0404000404000404, 
+            0x0404040004000400, 0x0404040404000400, 0x0404040004000404, 0x0404040404000404, 
+            0x0400000004040000, 0x0400000404040000, 0x0400000004040004, 0x0400000404040004, 
+            0x0400040004040000, 0x0400040404040000, 0x0400040004040004, 0x0400040404040004, 
+            0x0400000004040400, 0x0400000404040400, 0x0400000004040404, 0x0400000404040404, 
+            0x0400040004040400, 0x0400040404040400, 0x0400040004040404, 0x0400040404040404, 
+            0x0404000004040000, 0x0404000404040000, 0x0404000004040004, 0x0404000404040004, 
+            0x0404040004040000, 0x0404040404040000, 0x0404040004040004, 0x0404040404040004, 
+            0x0404000004040400, 0x0404000404040400, 0x0404000004040404, 0x0404000404040404, 
+            0x0404040004040400, 0x0404040404040400, 0x0404040004040404, 0x0404040404040404
+        }, 
+        //byte 6
+        {
+            0x0000000000000000, 0x0000000200000000, 0x0000000000000002, 0x0000000200000002, 
+            0x0000020000000000, 0x0000020200000000, 0x0000020000000002, 0x0000020200000002, 
+            0x0000000000000200, 0x0000000200000200, 0x0000000000000202, 0x0000000200000202, 
+            0x0000020000000200, 0x0000020200000200, 0x0000020000000202, 0x0000020200000202, 
+            0x0002000000000000, 0x0002000200000000, 0x0002000000000002, 0x0002000200000002, 
+            0x0002020000000000, 0x0002020200000000, 0x0002020000000002, 0x0002020200000002, 
+            0x0002000000000200, 0x0002000200000200, 0x0002000000000202, 0x0002000200000202, 
+            0x0002020000000200, 0x0002020200000200, 0x0002020000000202, 0x0002020200000202, 
+            0x0000000000020000, 0x0000000200020000, 0x0000000000020002, 0x0000000200020002, 
+            0x0000020000020000, 0x0000020200020000, 0x0000020000020002, 0x0000020200020002, 
+            0x0000000000020200, 0x0000000200020200, 0x0000000000020202, 0x0000000200020202, 
+            0x0000020000020200, 0x0000020200020200, 0x0000020000020202, 0x0000020200020202, 
+            0x0002000000020000, 0x0002000200020000, 0x0002000000020002, 0x0002000200020002, 
+            0x0002020000020000, 0x0002020200020000, 0x0002020000020002, 0x0002020200020002, 
+            0x0002000000020200, 0x0002000200020200, 0x0002000000020202, 0x0002000200020202, 
+            0x0002020000020200, 0x0002020200020200, 0x0002020000020202, 0x0002020200020202, 
+            0x0200000000000000, 0x0200000200000000, 0x0200000000000002, 0x0200000200000002, 
+            0x0200020000000000, 0x0200020200000000, 0x0200020000000002, 0x0200020200000002, 
+            0x0200000000000200, 0x0200000200000200, 0x0200000000000202, 0x0200000200000202, 
+            0x0200020000000200, 0x0200020200000200, 0x0200020000000202, 0x0200020200000202, 
+            0x0202000000000000, 0x0202000200000000, 0x0202000000000002, 0x0202000200000002, 
+            0x0202020000000000, 0x0202020200000000, 0x0202020000000002, 0x0202020200000002, 
+            0x0202000000000200, 0x0202000200000200, 0x0202000000000202, 0x0202000200000202, 
+            0x0202020000000200, 0x0202020200000200, 0x0202020000000202, 0x0202020200000202, 
+            0x0200000000020000, 0x0200000200020000, 0x0200000000020002, 0x0200000200020002, 
+            0x0200020000020000, 0x0200020200020000, 0x0200020000020002, 0x0200020200020002, 
+            0x0200000000020200, 0x0200000200020200, 0x0200000000020202, 0x0200000200020202, 
+            0x0200020000020200, 0x0200020200020200, 0x0200020000020202, 0x0200020200020202, 
+            0x0202000000020000, 0x0202000200020000, 0x0202000000020002, 0x0202000200020002, 
+            0x0202020000020000, 0x0202020200020000, 0x0202020000020002, 0x0202020200020002, 
+            0x0202000000020200, 0x0202000200020200, 0x0202000000020202, 0x0202000200020202, 
+            0x0202020000020200, 0x0202020200020200, 0x0202020000020202, 0x0202020200020202, 
+            0x0000000002000000, 0x0000000202000000, 0x0000000002000002, 0x0000000202000002, 
+            0x0000020002000000, 0x0000020202000000, 0x0000020002000002, 0x0000020202000002, 
+            0x0000000002000200, 0x0000000202000200, 0x0000000002000202, 0x0000000202000202, 
+            0x0000020002000200, 0x0000020202000200, 0x0000020002000202, 0x0000020202000202, 
+            0x0002000002000000, 0x0002000202000000, 0x0002000002000002, 0x0002000202000002, 
+            0x0002020002000000, 0x0002020202000000, 0x0002020002000002, 0x0002020202000002, 
+            0x0002000002000200, 0x0002000202000200, 0x0002000002000202, 0x0002000202000202, 
+            0x0002020002000200, 0x0002020202000200, 0x0002020002000202, 0x0002020202000202, 
+            0x0000000002020000, 0x0000000202020000, 0x0000000002020002, 0x0000000202020002, 
+            0x0000020002020000, 0x0000020202020000, 0x0000020002020002, 0x0000020202020002, 
+            0x0000000002020200, 0x0000000202020200, 0x0000000002020202, 0x0000000202020202, 
+            0x0000020002020200, 0x0000020202020200, 0x0000020002020202, 0x0000020202020202, 
+            0x0002000002020000, 0x0002000202020000, 0x0002000002020002, 0x0002000202020002, 
+            0x0002020002020000, 0x0002020202020000, 0x0002020002020002, 0x0002020202020002, 
+            0x0002000002020200, 0x0002000202020200, 0x0002000002020202, 0x0002000202020202, 
+            0x0002020002020200, 0x0002020202020200, 0x0002020002020202, 0x0002020202020202, 
+            0x0200000002000000, 0x0200000202000000, 0x0200000002000002, 0x0200000202000002, 
+            0x0200020002000000, 0x0200020202000000, 0x0200020002000002, 0x0200020202000002, 
+            0x0200000002000200, 0x0200000202000200, 0x0200000002000202, 0x0200000202000202, 
+            0x0200020002000200, 0x0200020202000200, 0x0200020002000202, 0x0200020202000202, 
+            0x0202000002000000, 0x0202000202000000, 0x0202000002000002, 0x0202000202000002, 
+            0x0202020002000000, 0x0202020202000000, 0x0202020002000002, 0x0202020202000002, 
+            0x0202000002000200, 0x0202000202000200, 0x0202000002000202, 0x0202000202000202, 
+            0x0202020002000200, 0x0202020202000200, 0x0202020002000202, 0x0202020202000202, 
+            0x0200000002020000, 0x0200000202020000, 0x0200000002020002, 0x0200000202020002, 
+            0x0200020002020000, 0x0200020202020000, 0x0200020002020002, 0x0200020202020002, 
+            0x0200000002020200, 0x0200000202020200, 0x0200000002020202, 0x0200000202020202, 
+            0x0200020002020200, 0x0200020202020200, 0x0200020002020202, 0x0200020202020202, 
+            0x0202000002020000, 0x0202000202020000, 0x0202000002020002, 0x0202000202020002, 
+            0x0202020002020000, 0x0202020202020000, 0x0202020002020002, 0x0202020202020002, 
+            0x0202000002020200, 0x0202000202020200, 0x0202000002020202, 0x0202000202020202, 
+            0x0202020002020200, 0x0202020202020200, 0x0202020002020202, 0x0202020202020202
+        }, 
+        //byte 7
+        {
+            0x0000000000000000, 0x0000000100000000, 0x0000000000000001, 0x0000000100000001, 
+            0x0000010000000000, 0x0000010100000000, 0x0000010000000001, 0x0000010100000001, 
+            0x0000000000000100, 0x0000000100000100, 0x0000000000000101, 0x0000000100000101, 
+            0x0000010000000100, 0x0000010100000100, 0x0000010000000101, 0x0000010100000101, 
+            0x0001000000000000, 0x0001000100000000, 0x0001000000000001, 0x0001000100000001, 
+            0x0001010000000000, 0x0001010100000000, 0x0001010000000001, 0x0001010100000001, 
+            0x0001000000000100, 0x0001000100000100, 0x0001000000000101, 0x0001000100000101, 
+            0x0001010000000100, 0x0001010100000100, 0x0001010000000101, 0x0001010100000101, 
+            0x0000000000010000, 0x0000000100010000, 0x0000000000010001, 0x0000000100010001, 
+            0x0000010000010000, 0x0000010100010000, 0x0000010000010001, 0x0000010100010001, 
+            0x0000000000010100, 0x0000000100010100, 0x0000000000010101, 0x0000000100010101, 
+            0x0000010000010100, 0x0000010100010100, 0x0000010000010101, 0x0000010100010101, 
+            0x0001000000010000, 0x0001000100010000, 0x0001000000010001, 0x0001000100010001, 
+            0x0001010000010000, 0x0001010100010000, 0x0001010000010001, 0x0001010100010001, 
+            0x0001000000010100, 0x0001000100010100, 0x0001000000010101, 0x0001000100010101, 
+            0x0001010000010100, 0x0001010100010100, 0x0001010000010101, 0x0001010100010101, 
+            0x0100000000000000, 0x0100000100000000, 0x0100000000000001, 0x0100000100000001, 
+            0x0100010000000000, 0x0100010100000000, 0x0100010000000001, 0x0100010100000001, 
+            0x0100000000000100, 0x0100000100000100, 0x0100000000000101, 0x0100000100000101, 
+            0x0100010000000100, 0x0100010100000100, 0x0100010000000101, 0x0100010100000101, 
+            0x0101000000000000, 0x0101000100000000, 0x0101000000000001, 0x0101000100000001, 
+            0x0101010000000000, 0x0101010100000000, 0x0101010000000001, 0x0101010100000001, 
+            0x0101000000000100, 0x0101000100000100, 0x0101000000000101, 0x0101000100000101, 
+            0x0101010000000100, 0x0101010100000100, 0x0101010000000101, 0x0101010100000101, 
+            0x0100000000010000, 0x0100000100010000, 0x0100000000010001, 0x0100000100010001, 
+            0x0100010000010000, 0x0100010100010000, 0x0100010000010001, 0x0100010100010001, 
+            0x0100000000010100, 0x0100000100010100, 0x0100000000010101, 0x0100000100010101, 
+            0x0100010000010100, 0x0100010100010100, 0x0100010000010101, 0x0100010100010101, 
+            0x0101000000010000, 0x0101000100010000, 0x0101000000010001, 0x0101000100010001, 
+            0x0101010000010000, 0x0101010100010000, 0x0101010000010001, 0x0101010100010001, 
+            0x0101000000010100, 0x0101000100010100, 0x0101000000010101, 0x0101000100010101, 
+            0x0101010000010100, 0x0101010100010100, 0x0101010000010101, 0x0101010100010101, 
+            0x0000000001000000, 0x0000000101000000, 0x0000000001000001, 0x0000000101000001, 
+            0x0000010001000000, 0x0000010101000000, 0x0000010001000001, 0x0000010101000001, 
+            0x0000000001000100, 0x0000000101000100, 0x0000000001000101, 0x0000000101000101, 
+            0x0000010001000100, 0x0000010101000100, 0x0000010001000101, 0x0000010101000101, 
+            0x0001000001000000, 0x0001000101000000, 0x0001000001000001, 0x0001000101000001, 
+            0x0001010001000000, 0x0001010101000000, 0x0001010001000001, 0x0001010101000001, 
+            0x0001000001000100, 0x0001000101000100, 0x0001000001000101, 0x0001000101000101, 
+            0x0001010001000100, 0x0001010101000100, 0x0001010001000101, 0x0001010101000101, 
+            0x0000000001010000, 0x0000000101010000, 0x0000000001010001, 0x0000000101010001, 
+            0x0000010001010000, 0x0000010101010000, 0x0000010001010001, 0x0000010101010001, 
+            0x0000000001010100, 0x0000000101010100, 0x0000000001010101, 0x0000000101010101, 
+            0x0000010001010100, 0x0000010101010100, 0x0000010001010101, 0x0000010101010101, 
+            0x0001000001010000, 0x0001000101010000, 0x0001000001010001, 0x0001000101010001, 
+            0x0001010001010000, 0x0001010101010000, 0x0001010001010001, 0x0001010101010001, 
+            0x0001000001010100, 0x0001000101010100, 0x0001000001010101, 0x0001000101010101, 
+            0x0001010001010100, 0x0001010101010100, 0x0001010001010101, 0x0001010101010101, 
+            0x0100000001000000, 0x0100000101000000, 0x0100000001000001, 0x0100000101000001, 
+            0x0100010001000000, 0x0100010101000000, 0x0100010001000001, 0x0100010101000001, 
+            0x0100000001000100, 0x0100000101000100, 0x0100000001000101, 0x0100000101000101, 
+            0x0100010001000100, 0x0100010101000100, 0x0100010001000101, 0x0100010101000101, 
+            0x0101000001000000, 0x0101000101000000, 0x0101000001000001, 0x0101000101000001, 
+            0x0101010001000000, 0x0101010101000000, 0x0101010001000001, 0x0101010101000001, 
+            0x0101000001000100, 0x0101000101000100, 0x0101000001000101, 0x0101000101000101, 
+            0x0101010001000100, 0x0101010101000100, 0x0101010001000101, 0x0101010101000101, 
+            0x0100000001010000, 0x0100000101010000, 0x0100000001010001, 0x0100000101010001, 
+            0x0100010001010000, 0x0100010101010000, 0x0100010001010001, 0x0100010101010001, 
+            0x0100000001010100, 0x0100000101010100, 0x0100000001010101, 0x0100000101010101, 
+            0x0100010001010100, 0x0100010101010100, 0x0100010001010101, 0x0100010101010101, 
+            0x0101000001010000, 0x0101000101010000, 0x0101000001010001, 0x0101000101010001, 
+            0x0101010001010000, 0x0101010101010000, 0x0101010001010001, 0x0101010101010001, 
+            0x0101000001010100, 0x0101000101010100, 0x0101000001010101, 0x0101000101010101, 
+            0x0101010001010100, 0x0101010101010100, 0x0101010001010101, 0x0101010101010101
+        }
+    }
+};
+
+/**
+ * The final permutation IP_INV, compiled by des_perm_compile(). 
+ */
+static const des_perm STD_IP_INV = {
+    64, 64, 8, 0, 
+    //input bits of every PEXT/PDEP group
+    {
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000
+    }, 
+    //output bits of every PEXT/PDEP group
+    {
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000
+    }, 
+    {
+        //byte 0
+        {
+            0x0000000000000000, 0x0200000000000000, 0x0002000000000000, 0x0202000000000000, 
+            0x0000020000000000, 0x0200020000000000, 0x0002020000000000, 0x0202020000000000, 
+            0x0000000200000000, 0x0200000200000000, 0x0002000200000000, 0x0202000200000000, 
+            0x0000020200000000, 0x0200020200000000, 0x0002020200000000, 0x0202020200000000, 
+            0x0000000002000000, 0x0200000002000000, 0x0002000002000000, 0x0202000002000000, 
+            0x0000020002000000, 0x0200020002000000, 0x0002020002000000, 0x0202020002000000, 
+            0x0000000202000000, 0x0200000202000000, 0x0002000202000000, 0x0202000202000000, 
+            0x0000020202000000, 0x0200020202000000, 0x0002020202000000, 0x0202020202000000, 
+            0x0000000000020000, 0x0200000000020000, 0x0002000000020000, 0x0202000000020000, 
+            0x0000020000020000, 0x0200020000020000, 0x0002020000020000, 0x0202020000020000, 
+            0x0000000200020000, 0x0200000200020000, 0x0002000200020000, 0x0202000200020000, 
+            0x0000020200020000, 0x0200020200020000, 0x0002020200020000, 0x0202020200020000, 
+            0x0000000002020000, 0x0200000002020000, 0x0002000002020000, 0x0202000002020000, 
+            0x0000020002020000, 0x0200020002020000, 0x0002020002020000, 0x0202020002020000, 
+            0x0000000202020000, 0x0200000202020000, 0x0002000202020000, 0x0202000202020000, 
+            0x0000020202020000, 0x0200020202020000, 0x0002020202020000, 0x0202020202020000, 
+            0x0000000000000200, 0x0200000000000200, 0x0002000000000200, 0x0202000000000200, 
+            0x0000020000000200, 0x0200020000000200, 0x0002020000000200, 0x0202020000000200, 
+            0x0000000200000200, 0x0200000200000200, 0x0002000200000200, 0x0202000200000200, 
+            0x0000020200000200, 0x0200020200000200, 0x0002020200000200, 0x0202020200000200, 
+            0x0000000002000200, 0x0200000002000200, 0x0002000002000200, 0x0202000002000200, 
+            0x0000020002000200, 0x0200020002000200, 0x0002020002000200, 0x0202020002000200, 
+            0x0000000202000200, 0x0200000202000200, 0x0002000202000200, 0x0202000202000200, 
+            0x0000020202000200, 0x0200020202000200, 0x0002020202000200, 0x0202020202000200, 
+            0x0000000000020200, 0x0200000000020200, 0x0002000000020200, 0x0202000000020200, 
+            0x0000020000020200, 0x0200020000020200, 0x0002020000020200, 0x0202020000020200, 
+            0x0000000200020200, 0x0200000200020200, 0x0002000200020200, 0x0202000200020200, 
+            0x0000020200020200, 0x0200020200020200, 0x0002020200020200, 0x0202020200020200, 
+            0x0000000002020200, 0x0200000002020200, 0x0002000002020200, 0x0202000002020200, 
+            0x0000020002020200, 0x0200020002020200, 0x0002020002020200, 0x0202020002020200, 
+            0x0000000202020200, 0x0200000202020200, 0x0002000202020200, 0x0202000202020200, 
+            0x0000020202020200, 0x0200020202020200, 0x0002020202020200, 0x0202020202020200, 
+            0x0000000000000002, 0x0200000000000002, 0x0002000000000002, 0x0202000000000002, 
+            0x0000020000000002, 0x0200020000000002, 0x0002020000000002, 0x0202020000000002, 
+            0x0000000200000002, 0x0200000200000002, 0x0002000200000002, 0x0202000200000002, 
+            0x0000020200000002, 0x0200020200000002, 0x0002020200000002, 0x0202020200000002, 
+            0x0000000002000002, 0x0200000002000002, 0x0002000002000002, 0x0202000002000002, 
+            0x0000020002000002, 0x0200020002000002, 0x0002020002000002, 0x0202020002000002, 
+            0x0000000202000002, 0x0200000202000002, 0x0002000202000002, 0x0202000202000002, 
+            0x0000020202000002, 0x0200020202000002, 0x0002020202000002, 0x0202020202000002, 
+            0x0000000000020002, 0x0200000000020002, 0x0002000000020002, 0x0202000000020002, 
+            0x0000020000020002, 0x0200020000020002, 0x0002020000020002, 0x0202020000020002, 
+            0x0000000200020002, 0x0200000200020002, 0x0002000200020002, 0x0202000200020002, 
+            0x0000020200020002, 0x0200020200020002, 0x0002020200020002, 0x0202020200020002, 
+            0x0000000002020002, 0x0200000002020002, 0x0002000002020002, 0x0202000002020002, 
+            0x0000020002020002, 0x0200020002020002, 0x0002020002020002, 0x0202020002020002, 
+            0x0000000202020002, 0x0200000202020002, 0x0002000202020002, 0x0202000202020002, 
+            0x0000020202020002, 0x0200020202020002, 0x0002020202020002, 0x0202020202020002, 
+            0x0000000000000202, 0x0200000000000202, 0x0002000000000202, 0x0202000000000202, 
+            0x0000020000000202, 0x0200020000000202, 0x0002020000000202, 0x0202020000000202, 
+            0x0000000200000202, 0x0200000200000202, 0x0002000200000202, 0x0202000200000202, 
+            0x0000020200000202, 0x0200020200000202, 0x0002020200000202, 0x0202020200000202, 
+            0x0000000002000202, 0x0200000002000202, 0x0002000002000202, 0x0202000002000202, 
+            0x0000020002000202, 0x0200020002000202, 0x0002020002000202, 0x0202020002000202, 
+            0x0000000202000202, 0x0200000202000202, 0x0002000202000202, 0x0202000202000202, 
+            0x0000020202000202, 0x0200020202000202, 0x0002020202000202, 0x0202020202000202, 
+            0x0000000000020202, 0x0200000000020202, 0x0002000000020202, 0x0202000000020202, 
+            0x0000020000020202, 0x0200020000020202, 0x0002020000020202, 0x0202020000020202, 
+            0x0000000200020202, 0x0200000200020202, 0x0002000200020202, 0x0202000200020202, 
+            0x0000020200020202, 0x0200020200020202, 0x0002020200020202, 0x0202020200020202, 
+            0x0000000002020202, 0x0200000002020202, 0x0002000002020202, 0x0202000002020202, 
+            0x0000020002020202, 0x0200020002020202, 0x0002020002020202, 0x0202020002020202, 
+            0x0000000202020202, 0x0200000202020202, 0x0002000202020202, 0x0202000202020202, 
+            0x0000020202020202, 0x0200020202020202, 0x0002020202020202, 0x0202020202020202
+        }, 
+        //byte 1
+        {
+            0x0000000000000000, 0x0800000000000000, 0x0008000000000000, 0x0808000000000000, 
+            0x0000080000000000, 0x0800080000000000, 0x0008080000000000, 0x0808080000000000, 
+            0x0000000800000000, 0x0800000800000000, 0x0008000800000000, 0x0808000800000000, 
+            0x0000080800000000, 0x0800080800000000, 0x0008080800000000, 0x0808080800000000, 
+            0x0000000008000000, 0x0800000008000000, 0x0008000008000000, 0x0808000008000000, 
+            0x0000080008000000, 0x0800080008000000, 0x0008080008000000, 0x0808080008000000, 
+            0x0000000808000000, 0x0800000808000000, 0x0008000808000000, 0x0808000808000000, 
+            0x0000080808000000, 0x0800080808000000, 0x0008080808000000, 0x0808080808000000, 
+            0x0000000000080000, 0x0800000000080000, 0x0008000000080000, 0x0808000000080000, 
+            0x0000080000080000, 0x0800080000080000, 0x0008080000080000, 0x0808080000080000, 
+            0x0000000800080000, 0x0800000800080000, 0x0008000800080000, 0x0808000800080000, 
+            0x0000080800080000, 0x0800080800080000, 0x0008080800080000, 0x0808080800080000, 
+            0x0000000008080000, 0x0800000008080000, 0x0008000008080000, 0x0808000008080000, 
+            0x0000080008080000, 0x0800080008080000, 0x0008080008080000, 0x0808080008080000, 
+            0x0000000808080000, 0x0800000808080000, 0x0008000808080000, 0x0808000808080000, 
+            0x0000080808080000, 0x0800080808080000, 0x0008080808080000, 0x0808080808080000, 
+            0x0000000000000800, 0x0800000000000800, 0x0008000000000800, 0x0808000000000800, 
+            0x0000080000000800, 0x0800080000000800, 0x0008080000000800, 0x0808080000000800, 
+            0x0000000800000800, 0x0800000800000800, 0x0008000800000800, 0x0808000800000800, 
+            0x0000080800000800, 0x0800080800000800, 0x0008080800000800, 0x0808080800000800, 
+            0x0000000008000800, 0x0800000008000800, 0x0008000008000800, 0x0808000008000800, 
+            0x0000080008000800, 0x0800080008000800, 0x0008080008000800, 0x0808080008000800, 
+            0x0000000808000800, 0x0800000808000800, 0x0008000808000800, 0x0808000808000800, 
+            0x0000080808000800, 0x0800080808000800, 0x0008080808000800, 0x0808080808000800, 
+            0x0000000000080800, 0x0800000000080800, 0x0008000000080800, 0x0808000000080800, 
+            0x0000080000080800, 0x0800080000080800, 0x0008080000080800, 0x0808080000080800, 
+            0x0000000800080800, 0x0800000800080800, 0x0008000800080800, 0x0808000800080800, 
+            0x0000080800080800, 0x0800080800080800, 0x0008080800080800, 0x0808080800080800, 
+            0x0000000008080800, 0x0800000008080800, 0x0008000008080800, 0x0808000008080800, 
+            0x0000080008080800, 0x0800080008080800, 0x0008080008080800, 0x0808080008080800, 
+            0x0000000808080800, 0x0800000808080800, 0x0008000808080800, 0x0808000808080800, 
+            0x0000080808080800, 0x0800080808080800, 0x0008080808080800, 0x0808080808080800, 
+            0x0000000000000008, 0x0800000000000008, 0x0008000000000008, 0x0808000000000008, 
+            0x0000080000000008, 0x0800080000000008, 0x0008080000000008, 0x0808080000000008, 
+            0x0000000800000008, 0x0800000800000008, 0x0008000800000008, 0x0808000800000008, 
+            0x0000080800000008, 0x0800080800000008, 0x0008080800000008, 0x0808080800000008, 
+            0x0000000008000008, 0x0800000008000008, 0x0008000008000008, 0x0808000008000008, 
+            0x0000080008000008, 0x0800080008000008, 0x0008080008000008, 0x0808080008000008, 
+            0x0000000808000008, 0x0800000808000008, 0x0008000808000008, 0x0808000808000008, 
+            0x0000080808000008, 0x0800080808000008, 0x0008080808000008, 0x0808080808000008, 
+            0x0000000000080008, 0x0800000000080008, 0x0008000000080008, 0x0808000000080008, 
+            0x0000080000080008, 0x0800080000080008, 0x0008080000080008, 0x0808080000080008, 
+            0x0000000800080008, 0x0800000800080008, 0x0008000800080008, 0x0808000800080008, 
+            0x0000080800080008, 0x0800080800080008, 0x0008080800080008, 0x0808080800080008, 
+            0x0000000008080008, 0x0800000008080008, 0x0008000008080008, 0x0808000008080008, 
+            0x0000080008080008, 0x0800080008080008, 0x0008080008080008, 0x0808080008080008, 
+            0x0000000808080008, 0x0800000808080008, 0x0008000808080008, 0x0808000808080008, 
+            0x0000080808080008, 0x0800080808080008, 0x0008080808080008, 0x0808080808080008, 
+            0x0000000000000808, 0x0800000000000808, 0x0008000000000808, 0x0808000000000808, 
+            0x0000080000000808, 0x0800080000000808, 0x0008080000000808, 0x0808080000000808, 
+            0x0000000800000808, 0x0800000800000808, 0x0008000800000808, 0x0808000800000808, 
+            0x0000080800000808, 0x0800080800000808, 0x0008080800000808, 0x0808080800000808, 
+            0x0000000008000808, 0x0800000008000808, 0x0008000008000808, 0x0808000008000808, 
+            0x0000080008000808, 0x0800080008000808, 0x0008080008000808, 0x0808080008000808, 
+            0x0000000808000808, 0x0800000808000808, 0x0008000808000808, 0x0808000808000808, 
+            0x0000080808000808, 0x0800080808000808, 0x0008080808000808, 0x0808080808000808, 
+            0x0000000000080808, 0x0800000000080808, 0x0008000000080808, 0x0808000000080808, 
+            0x0000080000080808, 0x0800080000080808, 0x0008080000080808, 0x0808080000080808, 
+            0x0000000800080808, 0x0800000800080808, 0x0008000800080808, 0x0808000800080808, 
+            0x0000080800080808, 0x0800080800080808, 0x0008080800080808, 0x0808080800080808, 
+            0x0000000008080808, 0x0800000008080808, 0x0008000008080808, 0x0808000008080808, 
+            0x0000080008080808, 0x0800080008080808, 0x0008080008080808, 0x0808080008080808, 
+            0x0000000808080808, 0x0800000808080808, 0x0008000808080808, 0x0808000808080808, 
+            0x0000080808080808, 0x0800080808080808, 0x0008080808080808, 0x0808080808080808
+        }, 
+        //byte 2
+        {
+            0x0000000000000000, 0x2000000000000000, 0x0020000000000000, 0x2020000000000000, 
+            0x0000200000000000, 0x2000200000000000, 0x0020200000000000, 0x2020200000000000, 
+            0x0000002000000000, 0x2000002000000000, 0x0020002000000000, 0x2020002000000000, 
+            0x0000202000000000, 0x2000202000000000, 0x0020202000000000, 0x2020202000000000, 
+            0x0000000020000000, 0x2000000020000000, 0x0020000020000000, 0x2020000020000000, 
+            0x0000200020000000, 0x2000200020000000, 0x0020200020000000, 0x2020200020000000, 
+            0x0000002020000000, 0x2000002020000000, 0x0020002020000000, 0x2020002020000000, 
+            0x0000202020000000, 0x2000202020000000, 0x0020202020000000, 0x2020202020000000, 
+            0x0000000000200000, 0x2000000000200000, 0x0020000000200000, 0x2020000000200000, 
+            0x0000200000200000, 0x2000200000200000, 0x0020200000200000, 0x2020200000200000, 
+            0x0000002000200000, 0x2000002000200000, 0x0020002000200000, 0x2020002000200000, 
+            0x0000202000200000, 0x2000202000200000, 0x0020202000200000, 0x2020202000200000, 
+            0x0000000020200000, 0x2000000020200000, 0x0020000020200000, 0x2020000020200000, 
+            0x0000200020200000, 0x2000200020200000, 0x0020200020200000, 0x2020200020200000, 
+            0x0000002020200000, 0x2000002020200000, 0x0020002020200000, 0x2020002020200000, 
+            0x0000202020200000, 0x2000202020200000, 0x0020202020200000, 0x2020202020200000, 
+            0x0000000000002000, 0x2000000000002000, 0x0020000000002000, 0x2020000000002000, 
+            0x0000200000002000, 0x2000200000002000, 0x0020200000002000, 0x2020200000002000, 
+            0x0000002000002000, 0x2000002000002000, 0x0020002000002000, 0x2020002000002000, 
+            0x0000202000002000, 0x2000202000002000, 0x0020202000002000, 0x2020202000002000, 
+            0x0000000020002000, 0x2000000020002000, 0x0020000020002000, 0x2020000020002000, 
+            0x0000200020002000, 0x2000200020002000, 0x0020200020002000, 0x2020200020002000, 
+            0x0000002020002000, 0x2000002020002000, 0x0020002020002000, 0x2020002020002000, 
+            0x0000202020002000, 0x2000202020002000, 0x0020202020002000, 0x2020202020002000, 
+            0x0000000000202000, 0x2000000000202000, 0x0020000000202000, 0x2020000000202000, 
+            0x0000200000202000, 0x2000200000202000, 0x0020200000202000, 0x2020200000202000, 
+            0x0000002000202000, 0x2000002000202000, 0x0020002000202000, 0x2020002000202000, 
+            0x0000202000202000, 0x2000202000202000, 0x0020202000202000, 0x2020202000202000, 
+            0x0000000020202000, 0x2000000020202000, 0x0020000020202000, 0x2020000020202000, 
+            0x0000200020202000, 0x2000200020202000, 0x0020200020202000, 0x2020200020202000, 
+            0x0000002020202000, 0x2000002020202000, 0x0020002020202000, 0x2020002020202000, 
+            0x0000202020202000, 0x2000202020202000, 0x0020202020202000, 0x2020202020202000, 
+            0x0000000000000020, 0x2000000000000020, 0x0020000000000020, 0x2020000000000020, 
+            0x0000200000000020, 0x2000200000000020, 0x0020200000000020, 0x2020200000000020, 
+            0x0000002000000020, 0x2000002000000020, 0x0020002000000020, 0x2020002000000020, 
+            0x0000202000000020, 0x2000202000000020, 0x0020202000000020, 0x2020202000000020, 
+            0x0000000020000020, 0x2000000020000020, 0x0020000020000020, 0x2020000020000020, 
+            0x0000200020000020, 0x2000200020000020, 0x0020200020000020, 0x2020200020000020, 
+            0x0000002020000020, 0x2000002020000020, 0x0020002020000020, 0x2020002020000020, 
+            0x0000202020000020, 0x2000202020000020, 0x0020202020000020, 0x2020202020000020, 
+            0x0000000000200020, 0x2000000000200020, 0x0020000000200020, 0x2020000000200020, 
+            0x0000200000200020, 0x2000200000200020, 0x0020200000200020, 0x2020200000200020, 
+            0x0000002000200020, 0x2000002000200020, 0x0020002000200020, 0x2020002000200020, 
+            0x0000202000200020, 0x2000202000200020, 0x0020202000200020, 0x2020202000200020, 
+            0x0000000020200020, 0x2000000020200020, 0x0020000020200020, 0x2020000020200020, 
+            0x0000200020200020, 0x2000200020200020, 0x0020200020200020, 0x2020200020200020, 
+            0x0000002020200020, 0x2000002020200020, 0x0020002020200020, 0x2020002020200020, 
+            0x0000202020200020, 0x2000202020200020, 0x0020202020200020, 0x2020202020200020, 
+            0x0000000000002020, 0x2000000000002020, 0x0020000000002020, 0x2020000000002020, 
+            0x0000200000002020, 0x2000200000002020, 0x0020200000002020, 0x2020200000002020, 
+            0x0000002000002020, 0x2000002000002020, 0x0020002000002020, 0x2020002000002020, 
+            0x0000202000002020, 0x2000202000002020, 0x0020202000002020, 0x2020202000002020, 
+            0x0000000020002020, 0x2000000020002020, 0x0020000020002020, 0x2020000020002020, 
+            0x0000200020002020, 0x2000200020002020, 0x0020200020002020, 0x2020200020002020, 
+            0x0000002020002020, 0x2000002020002020, 0x0020002020002020, 0x2020002020002020, 
+            0x0000202020002020, 0x2000202020002020, 0x0020202020002020, 0x2020202020002020, 
+            0x0000000000202020, 0x2000000000202020, 0x0020000000202020, 0x2020000000202020, 
+            0x0000200000202020, 0x2000200000202020, 0x0020200000202020, 0x2020200000202020, 
+            0x0000002000202020, 0x2000002000202020, 0x0020002000202020, 0x2020002000202020, 
+            0x0000202000202020, 0x2000202000202020, 0x0020202000202020, 0x2020202000202020, 
+            0x0000000020202020, 0x2000000020202020, 0x0020000020202020, 0x2020000020202020, 
+            0x0000200020202020, 0x2000200020202020, 0x0020200020202020, 0x2020200020202020, 
+            0x0000002020202020, 0x2000002020202020, 0x0020002020202020, 0x2020002020202020, 
+            0x0000202020202020, 0x2000202020202020, 0x0020202020202020, 0x2020202020202020
+        }, 
+        //byte 3
+        {
+            0x0000000000000000, 0x8000000000000000, 0x0080000000000000, 0x8080000000000000, 
+            0x0000800000000000, 0x8000800000000000, 0x0080800000000000, 0x8080800000000000, 
+            0x0000008000000000, 0x8000008000000000, 0x0080008000000000, 0x8080008000000000, 
+            0x0000808000000000, 0x8000808000000000, 0x0080808000000000, 0x8080808000000000, 
+            0x0000000080000000, 0x8000000080000000, 0x0080000080000000, 0x8080000080000000, 
+            0x0000800080000000, 0x8000800080000000, 0x0080800080000000, 0x8080800080000000, 
+            0x0000008080000000, 0x8000008080000000, 0x0080008080000000, 0x8080008080000000, 
+            0x0000808080000000, 0x8000808080000000, 0x0080808080000000, 0x8080808080000000, 
+            0x0000000000800000, 0x8000000000800000, 0x0080000000800000, 0x8080000000800000, 
+            0x0000800000800000, 0x8000800000800000, 0x0080800000800000, 0x8080800000800000, 
+            0x0000008000800000, 0x8000008000800000, 0x0080008000800000, 0x8080008000800000, 
+            0x0000808000800000, 0x8000808000800000, 0x0080808000800000, 0x8080808000800000, 
+            0x0000000080800000, 0x8000000080800000, 0x0080000080800000, 0x8080000080800000, 
+            0x0000800080800000, 0x8000800080800000, 0x0080800080800000, 0x8080800080800000, 
+            0x0000008080800000, 0x8000008080800000, 0x0080008080800000, 0x8080008080800000, 
+            0x0000808080800000, 0x8000808080800000, 0x0080808080800000, 0x8080808080800000, 
+            0x0000000000008000, 0x8000000000008000, 0x0080000000008000, 0x8080000000008000, 
+            0x0000800000008000, 0x8000800000008000, 0x0080800000008000, 0x8080800000008000, 
+            0x0000008000008000, 0x8000008000008000, 0x0080008000008000, 0x8080008000008000, 
+            0x0000808000008000, 0x8000808000008000, 0x0080808000008000, 0x8080808000008000, 
+            0x0000000080008000, 0x8000000080008000, 0x0080000080008000, 0x8080000080008000, 
+            0x0000800080008000, 0x8000800080008000, 0x0080800080008000, 0x8080800080008000, 
+            0x0000008080008000, 0x8000008080008000, 0x0080008080008000, 0x8080008080008000, 
+            0x0000808080008000, 0x8000808080008000, 0x0080808080008000, 0x8080808080008000, 
+            0x0000000000808000, 0x8000000000808000, 0x0080000000808000, 0x8080000000808000, 
+            0x0000800000808000, 0x8000800000808000, 0x0080800000808000, 0x8080800000808000, 
+            0x0000008000808000, 0x8000008000808000, 0x0080008000808000, 0x8080008000808000, 
+            0x0000808000808000, 0x8000808000808000, 0x0080808000808000, 0x8080808000808000, 
+            0x0000000080808000, 0x8000000080808000, 0x0080000080808000, 0x8080000080808000, 
+            0x0000800080808000, 0x8000800080808000, 0x0080800080808000, 0x8080800080808000, 
+            0x0000008080808000, 0x8000008080808000, 0x0080008080808000, 0x8080008080808000, 
+            0x0000808080808000, 0x8000808080808000, 0x0080808080808000, 0x8080808080808000, 
+            0x0000000000000080, 0x8000000000000080, 0x0080000000000080, 0x8080000000000080, 
+            0x0000800000000080, 0x8000800000000080, 0x0080800000000080, 0x8080800000000080, 
+            0x0000008000000080, 0x8000008000000080, 0x0080008000000080, 0x8080008000000080, 
+            0x0000808000000080, 0x8000808000000080, 0x0080808000000080, 0x8080808000000080, 
+            0x0000000080000080, 0x8000000080000080, 0x0080000080000080, 0x8080000080000080, 
+            0x0000800080000080, 0x8000800080000080, 0x0080800080000080, 0x8080800080000080, 
+            0x0000008080000080, 0x8000008080000080, 0x0080008080000080, 0x8080008080000080, 
+            0x0000808080000080, 0x8000808080000080, 0x0080808080000080, 0x8080808080000080, 
+            0x0000000000800080, 0x8000000000800080, 0x0080000000800080, 0x8080000000800080, 
+            0x0000800000800080, 0x8000800000800080, 0x0080800000800080, 0x8080800000800080, 
+            0x0000008000800080, 0x8000008000800080, 0x0080008000800080, 0x8080008000800080, 
+            0x0000808000800080, 0x8000808000800080, 0x0080808000800080, 0x8080808000800080, 
+            0x0000000080800080, 0x8000000080800080, 0x0080000080800080, 0x8080000080800080, 
+            0x0000800080800080, 0x8000800080800080, 0x0080800080800080, 0x8080800080800080, 
+            0x0000008080800080, 0x8000008080800080, 0x0080008080800080, 0x8080008080800080, 
+            0x0000808080800080, 0x8000808080800080, 0x0080808080800080, 0x8080808080800080, 
+            0x0000000000008080, 0x8000000000008080, 0x0080000000008080, 0x8080000000008080, 
+            0x0000800000008080, 0x8000800000008080, 0x0080800000008080, 0x8080800000008080, 
+            0x0000008000008080, 0x8000008000008080, 0x0080008000008080, 0x8080008000008080, 
+            0x0000808000008080, 0x8000808000008080, 0x0080808000008080, 0x8080808000008080, 
+            0x0000000080008080, 0x8000000080008080, 0x0080000080008080, 0x8080000080008080, 
+            0x0000800080008080, 0x8000800080008080, 0x0080800080008080, 0x8080800080008080, 
+            0x0000008080008080, 0x8000008080008080, 0x0080008080008080, 0x8080008080008080, 
+            0x0000808080008080, 0x8000808080008080, 0x0080808080008080, 0x8080808080008080, 
+            0x0000000000808080, 0x8000000000808080, 0x0080000000808080, 0x8080000000808080, 
+            0x0000800000808080, 0x8000800000808080, 0x0080800000808080, 0x8080800000808080, 
+            0x0000008000808080, 0x8000008000808080, 0x0080008000808080, 0x8080008000808080, 
+            0x0000808000808080, 0x8000808000808080, 0x0080808000808080, 0x8080808000808080, 
+            0x0000000080808080, 0x8000000080808080, 0x0080000080808080, 0x8080000080808080, 
+            0x0000800080808080, 0x8000800080808080, 0x0080800080808080, 0x8080800080808080, 
+            0x0000008080808080, 0x8000008080808080, 0x0080008080808080, 0x8080008080808080, 
+            0x0000808080808080, 0x8000808080808080, 0x0080808080808080, 0x8080808080808080
+        }, 
+        //byte 4
+        {
+            0x0000000000000000, 0x0100000000000000, 0x0001000000000000, 0x0101000000000000, 
+            0x0000010000000000, 0x0100010000000000, 0x0001010000000000, 0x0101010000000000, 
+            0x0000000100000000, 0x0100000100000000, 0x0001000100000000, 0x0101000100000000, 
+            0x0000010100000000, 0x0100010100000000, 0x0001010100000000, 0x0101010100000000, 
+            0x0000000001000000, 0x0100000001000000, 0x0001000001000000, 0x0101000001000000, 
+            0x0000010001000000, 0x0100010001000000, 0x0001010001000000, 0x0101010001000000, 
+            0x0000000101000000, 0x0100000101000000, 0x0001000101000000, 0x0101000101000000, 
+            0x0000010101000000, 0x0100010101000000, 0x0001010101000000, 0x0101010101000000, 
+            0x0000000000010000, 0x0100000000010000, 0x0001000000010000, 0x0101000000010000, 
+            0x0000010000010000, 0x0100010000010000, 0x0001010000010000, 0x0101010000010000, 
+            0x0000000100010000, 0x0100000100010000, 0x0001000100010000, 0x0101000100010000, 
+            0x0000010100010000, 0x0100010100010000, 0x0001010100010000, 0x0101010100010000, 
+            0x0000000001010000, 0x0100000001010000, 0x0001000001010000, 0x0101000001010000, 
+            0x0000010001010000, 0x0100010001010000, 0x0001010001010000, 0x0101010001010000, 
+            0x0000000101010000, 0x0100000101010000, 0x0001000101010000, 0x0101000101010000, 
+            0x0000010101010000, 0x0100010101010000, 0x0001010101010000, 0x0101010101010000, 
+            0x0000000000000100, 0x0100000000000100, 0x0001000000000100, 0x0101000000000100, 
+            0x0000010000000100, 0x0100010000000100, 0x0001010000000100, 0x0101010000000100, 
+            0x0000000100000100, 0x0100000100000100, 0x0001000100000100, 0x0101000100000100, 
+            0x0000010100000100, 0x0100010100000100, 0x0001010100000100, 0x0101010100000100, 
+            0x0000000001000100, 0x0100000001000100, 0x0001000001000100, 0x0101000001000100, 
+            0x0000010001000100, 0x0100010001000100, 0x0001010001000100, 0x0101010001000100, 
+            0x0000000101000100, 0x0100000101000100, 0x0001000101000100, 0x0101000101000100, 
+            0x0000010101000100, 0x0100010101000100, 0x0001010101000100, 0x0101010101000100, 
+            0x0000000000010100, 0x0100000000010100, 0x0001000000010100, 0x0101000000010100, 
+            0x0000010000010100, 0x0100010000010100, 0x0001010000010100, 0x0101010000010100, 
+            0x0000000100010100, 0x0100000100010100, 0x0001000100010100, 0x0101000100010100, 
+            0x0000010100010100, 0x0100010100010100, 0x0001010100010100, 0x0101010100010100, 
+            0x0000000001010100, 0x0100000001010100, 0x0001000001010100, 0x0101000001010100, 
+            0x0000010001010100, 0x0100010001010100, 0x0001010001010100, 0x0101010001010100, 
+            0x0000000101010100, 0x0100000101010100, 0x0001000101010100, 0x0101000101010100, 
+            0x0000010101010100, 0x0100010101010100, 0x0001010101010100, 0x0101010101010100, 
+            0x0000000000000001, 0x0100000000000001, 0x0001000000000001, 0x0101000000000001, 
+            0x0000010000000001, 0x0100010000000001, 0x0001010000000001, 0x0101010000000001, 
+            0x0000000100000001, 0x0100000100000001, 0x0001000100000001, 0x0101000100000001, 
+            0x0000010100000001, 0x0100010100000001, 0x0001010100000001, 0x0101010100000001, 
+            0x0000000001000001, 0x0100000001000001, 0x0001000001000001, 0x0101000001000001, 
+            0x0000010001000001, 0x0100010001000001, 0x0001010001000001, 0x0101010001000001, 
+            0x0000000101000001, 0x0100000101000001, 0x0001000101000001, 0x0101000101000001, 
+            0x0000010101000001, 0x0100010101000001, 0x0001010101000001, 0x0101010101000001, 
+            0x0000000000010001, 0x0100000000010001, 0x0001000000010001, 0x0101000000010001, 
+            0x0000010000010001, 0x0100010000010001, 0x0001010000010001, 0x0101010000010001, 
+            0x0000000100010001, 0x0100000100010001, 0x0001000100010001, 0x0101000100010001, 
+            0x0000010100010001, 0x0100010100010001, 0x0001010100010001, 0x0101010100010001, 
+            0x0000000001010001, 0x0100000001010001, 0x0001000001010001, 0x0101000001010001, 
+            0x0000010001010001, 0x0100010001010001, 0x0001010001010001, 0x0101010001010001, 
+            0x0000000101010001, 0x0100000101010001, 0x0001000101010001, 0x0101000101010001, 
+            0x0000010101010001, 0x0100010101010001, 0x0001010101010001, 0x0101010101010001, 
+            0x0000000000000101, 0x0100000000000101, 0x0001000000000101, 0x0101000000000101, 
+            0x0000010000000101, 0x0100010000000101, 0x0001010000000101, 0x0101010000000101, 
+            0x0000000100000101, 0x0100000100000101, 0x0001000100000101, 0x0101000100000101, 
+            0x0000010100000101, 0x0100010100000101, 0x0001010100000101, 0x0101010100000101, 
+            0x0000000001000101, 0x0100000001000101, 0x0001000001000101, 0x0101000001000101, 
+            0x0000010001000101, 0x0100010001000101, 0x0001010001000101, 0x0101010001000101, 
+            0x0000000101000101, 0x0100000101000101, 0x0001000101000101, 0x0101000101000101, 
+            0x0000010101000101, 0x0100010101000101, 0x0001010101000101, 0x0101010101000101, 
+            0x0000000000010101, 0x0100000000010101, 0x0001000000010101, 0x0101000000010101, 
+            0x0000010000010101, 0x0100010000010101, 0x0001010000010101, 0x0101010000010101, 
+            0x0000000100010101, 0x0100000100010101, 0x0001000100010101, 0x0101000100010101, 
+            0x0000010100010101, 0x0100010100010101, 0x0001010100010101, 0x0101010100010101, 
+            0x0000000001010101, 0x0100000001010101, 0x0001000001010101, 0x0101000001010101, 
+            0x0000010001010101, 0x0100010001010101, 0x0001010001010101, 0x0101010001010101, 
+            0x0000000101010101, 0x0100000101010101, 0x0001000101010101, 0x0101000101010101, 
+            0x0000010101010101, 0x0100010101010101, 0x0001010101010101, 0x0101010101010101
+        }, 
+        //byte 5
+        {
+            0x0000000000000000, 0x0400000000000000, 0x0004000000000000, 0x0404000000000000, 
+            0x0000040000000000, 0x0400040000000000, 0x0004040000000000, 0x0404040000000000, 
+            0x0000000400000000, 0x0400000400000000, 0x0004000400000000, 0x0404000400000000, 
+            0x0000040400000000, 0x0400040400000000, 0x0004040400000000, 0x0404040400000000, 
+            0x0000000004000000, 0x0400000004000000, 0x0004000004000000, 0x0404000004000000, 
+            0x0000040004000000, 0x0400040004000000, 0x0004040004000000, 0x0404040004000000, 
+            0x0000000404000000, 0x0400000404000000, 0x0004000404000000, 0x0404000404000000, 
+            0x0000040404000000, 0x0400040404000000, 0x0004040404000000, 0x0404040404000000, 
+            0x0000000000040000, 0x0400000000040000, 0x0004000000040000, 0x0404000000040000, 
+            0x0000040000040000, 0x0400040000040000, 0x0004040000040000, 0x0404040000040000, 
+            0x0000000400040000, 0x0400000400040000, 0x0004000400040000, 0x0404000400040000, 
+            0x0000040400040000, 0x0400040400040000, 0x0004040400040000, 0x0404040400040000, 
+            0x0000000004040000, 0x0400000004040000, 0x0004000004040000, 0x0404000004040000, 
+            0x0000040004040000, 0x0400040004040000, 0x0004040004040000, 0x0404040004040000, 
+            0x0000000404040000, 0x0400000404040000, 0x0004000404040000, 0x0404000404040000, 
+            0x0000040404040000, 0x0400040404040000, 0x0004040404040000, 0x0404040404040000, 
+            0x0000000000000400, 0x0400000000000400, 0x0004000000000400, 0x0404000000000400, 
+            0x0000040000000400, 0x0400040000000400, 0x0004040000000400, 0x0404040000000400, 
+            0x0000000400000400, 0x0400000400000400, 0x0004000400000400, 0x0404000400000400, 
+            0x0000040400000400, 0x0400040400000400, 0x0004040400000400, 0x0404040400000400, 
+            0x0000000004000400, 0x0400000004000400, 0x0004000004000400, 0x0404000004000400, 
+            0x0000040004000400, 0x0400040004000400, 0x0004040004000400, 0x0404040004000400, 
+            0x0000000404000400, 0x0400000404000400, 0x0004000404000400, 0x0404000404000400, 
+            0x0000040404000400, 0x0400040404000400, 0x0004040404000400, 0x0404040404000400, 
+            0x0000000000040400, 0x0400000000040400, 0x0004000000040400, 0x0404000000040400, 
+            0x0000040000040400, 0x0400040000040400, 0x0004040000040400, 0x0404040000040400, 
+            0x0000000400040400, 0x0400000400040400, 0x0004000400040400, 0x0404000400040400, 
+            0x0000040400040400, 0x0400040400040400, 0x0004040400040400, 0x0404040400040400, 
+            0x0000000004040400, 0x0400000004040400, 0x0004000004040400, 0x0404000004040400, 
+            0x0000040004040400, 0x0400040004040400, 0x0004040004040400, 0x0404040004040400, 
+            0x0000000404040400, 0x0400000404040400, 0x0004000404040400, 0x0404000404040400, 
+            0x0000040404040400, 0x0400040404040400, 0x0004040404040400, 0x0404040404040400, 
+            0x0000000000000004, 0x0400000000000004, 0x0004000000000004, 0x0404000000000004, 
+            0x0000040000000004, 0x0400040000000004, 0x0004040000000004, 0x0404040000000004, 
+            0x0000000400000004, 0x0400000400000004, 0x0004000400000004, 0x0404000400000004, 
+            0x0000040400000004, 0x0400040400000004, 0x0004040400000004, 0x0404040400000004, 
+            0x0000000004000004, 0x0400000004000004, 0x0004000004000004, 0x0404000004000004, 
+            0x0000040004000004, 0x0400040004000004, 0x0004040004000004, 0x0404040004000004, 
+            0x0000000404000004, 0x0400000404000004, 0x0004000404000004, 0x0404000404000004, 
+            0x0000040404000004, 0x0400040404000004, 0x0004040404000004, 0x0404040404000004, 
+            0x0000000000040004, 0x0400000000040004, 0x0004000000040004, 0x0404000000040004, 
+            0x0000040000040004, 0x0400040000040004, 0x0004040000040004, 0x0404040000040004, 
+            0x0000000400040004, 0x0400000400040004, 0x0004000400040004, 0x0404000400040004, 
+            0x0000040400040004, 0x0400040400040004, 0x0004040400040004, 0x0404040400040004, 
+            0x0000000004040004, 0x0400000004040004, 0x0004000004040004, 0x0404000004040004, 
+            0x0000040004040004, 0x0400040004040004, 0x0004040004040004, 0x0404040004040004, 
+            0x0000000404040004, 0x0400000404040004, 0x0004000404040004, 0x0404000404040004, 
+            0x0000040404040004, 0x0400040404040004, 0x0004040404040004, 0x0404040404040004, 
+            0x0000000000000404, 0x0400000000000404, 0x0004000000000404, 0x0404000000000404, 
+            0x0000040000000404, 0x0400040000000404, 0x0004040000000404, 0x0404040000000404, 
+            0x0000000400000404, 0x0400000400000404, 0x0004000400000404, 0x0404000400000404, 
+            0x0000040400000404, 0x0400040400000404, 0x0004040400000404, 0x0404040400000404, 
+            0x0000000004000404, 0x0400000004000404, 0x0004000004000404, 0x0404000004000404, 
+            0x0000040004000404, 0x0400040004000404, 0x0004040004000404, 0x0404040004000404, 
+            0x0000000404000404, 0x0400000404000404, 0x0004000404000404, 0x0404000404000404, 
+            0x0000040404000404, 0x0400040404000404, 0x0004040404000404, 0x0404040404000404, 
+            0x0000000000040404, 0x0400000000040404, 0x0004000000040404, 0x0404000000040404, 
+            0x0000040000040404, 0x0400040000040404, 0x0004040000040404, 0x0404040000040404, 
+            0x0000000400040404, 0x0400000400040404, 0x0004000400040404, 0x0404000400040404, 
+            0x0000040400040404, 0x0400040400040404, 0x0004040400040404, 0x0404040400040404, 
+            0x0000000004040404, 0x0400000004040404, 0x0004000004040404, 0x0404000004040404, 
+            0x0000040004040404, 0x0400040004040404, 0x0004040004040404, 0x0404040004040404, 
+            0x0000000404040404, 0x0400000404040404, 0x0004000404040404, 0x0404000404040404, 
+            0x0000040404040404, 0x0400040404040404, 0x0004040404040404, 0x0404040404040404
+        }, 
+        //byte 6
+        {
+            0x0000000000000000, 0x1000000000000000, 0x0010000000000000, 0x1010000000000000, 
+            0x0000100000000000, 0x1000100000000000, 0x0010100000000000, 0x1010100000000000, 
+            0x0000001000000000, 0x1000001000000000, 0x0010001000000000, 0x1010001000000000, 
+            0x0000101000000000, 0x1000101000000000, 0x0010101000000000, 0x1010101000000000, 
+            0x0000000010000000, 0x1000000010000000, 0x0010000010000000, 0x1010000010000000, 
+            0x0000100010000000, 0x1000100010000000, 0x0010100010000000, 0x1010100010000000, 
+            0x0000001010000000, 0x1000001010000000, 0x0010001010000000, 0x1010001010000000, 
+            0x0000101010000000, 0x1000101010000000, 0x0010101010000000, 0x1010101010000000, 
+            0x0000000000100000, 0x1000000000100000, 0x0010000000100000, 0x1010000000100000, 
+            0x0000100000100000, 0x1000100000100000, 0x0010100000100000, 0x1010100000100000, 
+            0x0000001000100000, 0x1000001000100000, 0x0010001000100000, 0x1010001000100000, 
+            0x0000101000100000, 0x1000101000100000, 0x0010101000100000, 0x1010101000100000, 
+            0x0000000010100000, 0x1000000010100000, 0x0010000010100000, 0x1010000010100000, 
+            0x0000100010100000, 0x1000100010100000, 0x0010100010100000, 0x1010100010100000, 
+            0x0000001010100000, 0x1000001010100000, 0x0010001010100000, 0x1010001010100000, 
+            0x0000101010100000, 0x1000101010100000, 0x0010101010100000, 0x1010101010100000, 
+            0x0000000000001000, 0x1000000000001000, 0x0010000000001000, 0x1010000000001000, 
+            0x0000100000001000, 0x1000100000001000, 0x0010100000001000, 0x1010100000001000, 
+            0x0000001000001000, 0x1000001000001000, 0x0010001000001000, 0x1010001000001000, 
+            0x0000101000001000, 0x1000101000001000, 0x0010101000001000, 0x1010101000001000, 
+            0x0000000010001000, 0x1000000010001000, 0x0010000010001000, 0x1010000010001000, 
+            0x0000100010001000, 0x1000100010001000, 0x0010100010001000, 0x1010100010001000, 
+            0x0000001010001000, 0x1000001010001000, 0x0010001010001000, 0x1010001010001000, 
+            0x0000101010001000, 0x1000101010001000, 0x0010101010001000, 0x1010101010001000, 
+            0x0000000000101000, 0x1000000000101000, 0x0010000000101000, 0x1010000000101000, 
+            0x0000100000101000, 0x1000100000101000, 0x0010100000101000, 0x1010100000101000, 
+            0x0000001000101000, 0x1000001000101000, 0x0010001000101000, 0x1010001000101000, 
+            0x0000101000101000, 0x1000101000101000, 0x0010101000101000, 0x1010101000101000, 
+            0x0000000010101000, 0x1000000010101000, 0x0010000010101000, 0x1010000010101000, 
+            0x0000100010101000, 0x1000100010101000, 0x0010100010101000, 0x1010100010101000, 
+            0x0000001010101000, 0x1000001010101000, 0x0010001010101000, 0x1010001010101000, 
+            0x0000101010101000, 0x1000101010101000, 0x0010101010101000, 0x1010101010101000, 
+            0x0000000000000010, 0x1000000000000010, 0x0010000000000010, 0x1010000000000010, 
+            0x0000100000000010, 0x1000100000000010, 0x0010100000000010, 0x1010100000000010, 
+            0x0000001000000010, 0x1000001000000010, 0x0010001000000010, 0x1010001000000010, 
+            0x0000101000000010, 0x1000101000000010, 0x0010101000000010, 0x1010101000000010, 
+            0x0000000010000010, 0x1000000010000010, 0x0010000010000010, 0x1010000010000010, 
+            0x0000100010000010, 0x1000100010000010, 0x0010100010000010, 0x1010100010000010, 
+            0x0000001010000010, 0x1000001010000010, 0x0010001010000010, 0x1010001010000010, 
+            0x0000101010000010, 0x1000101010000010, 0x0010101010000010, 0x1010101010000010, 
+            0x0000000000100010, 0x1000000000100010, 0x0010000000100010, 0x1010000000100010, 
+            0x0000100000100010, 0x1000100000100010, 0x0010100000100010, 0x1010100000100010, 
+            0x0000001000100010, 0x1000001000100010, 0x0010001000100010, 0x1010001000100010, 
+            0x0000101000100010, 0x1000101000100010, 0x0010101000100010, 0x1010101000100010, 
+            0x0000000010100010, 0x1000000010100010, 0x0010000010100010, 0x1010000010100010, 
+            0x0000100010100010, 0x1000100010100010, 0x0010100010100010, 0x1010100010100010, 
+            0x0000001010100010, 0x1000001010100010, 0x0010001010100010, 0x1010001010100010, 
+            0x0000101010100010, 0x1000101010100010, 0x0010101010100010, 0x1010101010100010, 
+            0x0000000000001010, 0x1000000000001010, 0x0010000000001010, 0x1010000000001010, 
+            0x0000100000001010, 0x1000100000001010, 0x0010100000001010, 0x1010100000001010, 
+            0x0000001000001010, 0x1000001000001010, 0x0010001000001010, 0x1010001000001010, 
+            0x0000101000001010, 0x1000101000001010, 0x0010101000001010, 0x1010101000001010, 
+            0x0000000010001010, 0x1000000010001010, 0x0010000010001010, 0x1010000010001010, 
+            0x0000100010001010, 0x1000100010001010, 0x0010100010001010, 0x1010100010001010, 
+            0x0000001010001010, 0x1000001010001010, 0x0010001010001010, 0x1010001010001010, 
+            0x0000101010001010, 0x1000101010001010, 0x0010101010001010, 0x1010101010001010, 
+            0x0000000000101010, 0x1000000000101010, 0x0010000000101010, 0x1010000000101010, 
+            0x0000100000101010, 0x1000100000101010, 0x0010100000101010, 0x1010100000101010, 
+            0x0000001000101010, 0x1000001000101010, 0x0010001000101010, 0x1010001000101010, 
+            0x0000101000101010, 0x1000101000101010, 0x0010101000101010, 0x1010101000101010, 
+            0x0000000010101010, 0x1000000010101010, 0x0010000010101010, 0x1010000010101010, 
+            0x0000100010101010, 0x1000100010101010, 0x0010100010101010, 0x1010100010101010, 
+            0x0000001010101010, 0x1000001010101010, 0x0010001010101010, 0x1010001010101010, 
+            0x0000101010101010, 0x1000101010101010, 0x0010101010101010, 0x1010101010101010
+        }, 
+        //byte 7
+        {
+            0x0000000000000000, 0x4000000000000000, 0x0040000000000000, 0x4040000000000000, 
+            0x0000400000000000, 0x4000400000000000, 0x0040400000000000, 0x4040400000000000, 
+            0x0000004000000000, 0x4000004000000000, 0x0040004000000000, 0x4040004000000000, 
+            0x0000404000000000, 0x4000404000000000, 0x0040404000000000, 0x4040404000000000, 
+            0x0000000040000000, 0x4000000040000000, 0x0040000040000000, 0x4040000040000000, 
+            0x0000400040000000, 0x4000400040000000, 0x0040400040000000, 0x4040400040000000, 
+            0x0000004040000000, 0x4000004040000000, 0x0040004040000000, 0x4040004040000000, 
+            0x0000404040000000, 0x4000404040000000, 0x0040404040000000, 0x4040404040000000, 
+            0x0000000000400000, 0x4000000000400000, 0x0040000000400000, 0x4040000000400000, 
+            0x0000400000400000, 0x4000400000400000, 0x0040400000400000, 0x4040400000400000, 
+            0x0000004000400000, 0x4000004000400000, 0x0040004000400000, 0x4040004000400000, 
+            0x0000404000400000, 0x4000404000400000, 0x0040404000400000, 0x4040404000400000, 
+            0x0000000040400000, 0x4000000040400000, 0x0040000040400000, 0x4040000040400000, 
+            0x0000400040400000, 0x4000400040400000, 0x0040400040400000, 0x4040400040400000, 
+            0x0000004040400000, 0x4000004040400000, 0x0040004040400000, 0x4040004040400000, 
+            0x0000404040400000, 0x4000404040400000, 0x0040404040400000, 0x4040404040400000, 
+            0x0000000000004000, 0x4000000000004000, 0x0040000000004000, 0x4040000000004000, 
+            0x0000400000004000, 0x4000400000004000, 0x0040400000004000, 0x4040400000004000, 
+            0x0000004000004000, 0x4000004000004000, 0x0040004000004000, 0x4040004000004000, 
+            0x0000404000004000, 0x4000404000004000, 0x0040404000004000, 0x4040404000004000, 
+            0x0000000040004000, 0x4000000040004000, 0x0040000040004000, 0x4040000040004000, 
+            0x0000400040004000, 0x4000400040004000, 0x0040400040004000, 0x4040400040004000, 
+            0x0000004040004000, 0x4000004040004000, 0x0040004040004000, 0x4040004040004000, 
+            0x0000404040004000, 0x4000404040004000, 0x0040404040004000, 0x4040404040004000, 
+            0x0000000000404000, 0x4000000000404000, 0x0040000000404000, 0x4040000000404000, 
+            0x0000400000404000, 0x4000400000404000, 0x0040400000404000, 0x4040400000404000, 
+            0x0000004000404000, 0x4000004000404000, 0x0040004000404000, 0x4040004000404000, 
+            0x0000404000404000, 0x4000404000404000, 0x0040404000404000, 0x4040404000404000, 
+            0x0000000040404000, 0x4000000040404000, 0x0040000040404000, 0x4040000040404000, 
+            0x0000400040404000, 0x4000400040404000, 0x0040400040404000, 0x4040400040404000, 
+            0x0000004040404000, 0x4000004040404000, 0x0040004040404000, 0x4040004040404000, 
+            0x0000404040404000, 0x4000404040404000, 0x0040404040404000, 0x4040404040404000, 
+            0x0000000000000040, 0x4000000000000040, 0x0040000000000040, 0x4040000000000040, 
+            0x0000400000000040, 0x4000400000000040, 0x0040400000000040, 0x4040400000000040, 
+            0x0000004000000040, 0x4000004000000040, 0x0040004000000040, 0x4040004000000040, 
+            0x0000404000000040, 0x4000404000000040, 0x0040404000000040, 0x4040404000000040, 
+            0x0000000040000040, 0x4000000040000040, 0x0040000040000040, 0x4040000040000040, 
+            0x0000400040000040, 0x4000400040000040, 0x0040400040000040, 0x4040400040000040, 
+            0x0000004040000040, 0x4000004040000040, 0x0040004040000040, 0x4040004040000040, 
+            0x0000404040000040, 0x4000404040000040, 0x0040404040000040, 0x4040404040000040, 
+            0x0000000000400040, 0x4000000000400040, 0x0040000000400040, 0x4040000000400040, 
+            0x0000400000400040, 0x4000400000400040, 0x0040400000400040, 0x4040400000400040, 
+            0x0000004000400040, 0x4000004000400040, 0x0040004000400040, 0x4040004000400040, 
+            0x0000404000400040, 0x4000404000400040, 0x0040404000400040, 0x4040404000400040, 
+            0x0000000040400040, 0x4000000040400040, 0x0040000040400040, 0x4040000040400040, 
+            0x0000400040400040, 0x4000400040400040, 0x0040400040400040, 0x4040400040400040, 
+            0x0000004040400040, 0x4000004040400040, 0x0040004040400040, 0x4040004040400040, 
+            0x0000404040400040, 0x4000404040400040, 0x0040404040400040, 0x4040404040400040, 
+            0x0000000000004040, 0x4000000000004040, 0x0040000000004040, 0x4040000000004040, 
+            0x0000400000004040, 0x4000400000004040, 0x0040400000004040, 0x4040400000004040, 
+            0x0000004000004040, 0x4000004000004040, 0x0040004000004040, 0x4040004000004040, 
+            0x0000404000004040, 0x4000404000004040, 0x0040404000004040, 0x4040404000004040, 
+            0x0000000040004040, 0x4000000040004040, 0x0040000040004040, 0x4040000040004040, 
+            0x0000400040004040, 0x4000400040004040, 0x0040400040004040, 0x4040400040004040, 
+            0x0000004040004040, 0x4000004040004040, 0x0040004040004040, 0x4040004040004040, 
+            0x0000404040004040, 0x4000404040004040, 0x0040404040004040, 0x4040404040004040, 
+            0x0000000000404040, 0x4000000000404040, 0x0040000000404040, 0x4040000000404040, 
+            0x0000400000404040, 0x4000400000404040, 0x0040400000404040, 0x4040400000404040, 
+            0x0000004000404040, 0x4000004000404040, 0x0040004000404040, 0x4040004000404040, 
+            0x0000404000404040, 0x4000404000404040, 0x0040404000404040, 0x4040404000404040, 
+            0x0000000040404040, 0x4000000040404040, 0x0040000040404040, 0x4040000040404040, 
+            0x0000400040404040, 0x4000400040404040, 0x0040400040404040, 0x4040400040404040, 
+            0x0000004040404040, 0x4000004040404040, 0x0040004040404040, 0x4040004040404040, 
+            0x0000404040404040, 0x4000404040404040, 0x0040404040404040, 0x4040404040404040
+        }
+    }
+};
+
+/**
+ * The permuted choice PC1, compiled by des_perm_compile(). 
+ */
+static const des_perm STD_PC1 = {
+    64, 56, 8, 0, 
+    //input bits of every PEXT/PDEP group
+    {
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000
+    }, 
+    //output bits of every PEXT/PDEP group
+    {
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000
+    }, 
+    {
+        //byte 0
+        {
+            0x0000000000000000, 0x0000000000000000, 0x0000000008000000, 0x0000000008000000, 
+            0x0000000000080000, 0x0000000000080000, 0x0000000008080000, 0x0000000008080000, 
+            0x0000000000000800, 0x0000000000000800, 0x0000000008000800, 0x0000000008000800, 
+            0x0000000000080800, 0x0000000000080800, 0x0000000008080800, 0x0000000008080800, 
+            0x0000000080000000, 0x0000000080000000, 0x0000000088000000, 0x0000000088000000, 
+            0x0000000080080000, 0x0000000080080000, 0x0000000088080000, 0x0000000088080000, 
+            0x0000000080000800, 0x0000000080000800, 0x0000000088000800, 0x0000000088000800, 
+            0x0000000080080800, 0x0000000080080800, 0x0000000088080800, 0x0000000088080800, 
+            0x0000008000000000, 0x0000008000000000, 0x0000008008000000, 0x0000008008000000, 
+            0x0000008000080000, 0x0000008000080000, 0x0000008008080000, 0x0000008008080000, 
+            0x0000008000000800, 0x0000008000000800, 0x0000008008000800, 0x0000008008000800, 
+            0x0000008000080800, 0x0000008000080800, 0x0000008008080800, 0x0000008008080800, 
+            0x0000008080000000, 0x0000008080000000, 0x0000008088000000, 0x0000008088000000, 
+            0x0000008080080000, 0x0000008080080000, 0x0000008088080000, 0x0000008088080000, 
+            0x0000008080000800, 0x0000008080000800, 0x0000008088000800, 0x0000008088000800, 
+            0x0000008080080800, 0x0000008080080800, 0x0000008088080800, 0x0000008088080800, 
+            0x0000800000000000, 0x0000800000000000, 0x0000800008000000, 0x0000800008000000, 
+            0x0000800000080000, 0x0000800000080000, 0x0000800008080000, 0x0000800008080000, 
+            0x0000800000000800, 0x0000800000000800, 0x0000800008000800, 0x0000800008000800, 
+            0x0000800000080800, 0x0000800000080800, 0x0000800008080800, 0x0000800008080800, 
+            0x0000800080000000, 0x0000800080000000, 0x0000800088000000, 0x0000800088000000, 
+            0x0000800080080000, 0x0000800080080000, 0x0000800088080000, 0x0000800088080000, 
+            0x0000800080000800, 0x0000800080000800, 0x0000800088000800, 0x0000800088000800, 
+            0x0000800080080800, 0x0000800080080800, 0x0000800088080800, 0x0000800088080800, 
+            0x0000808000000000, 0x0000808000000000, 0x0000808008000000, 0x0000808008000000, 
+            0x0000808000080000, 0x0000808000080000, 0x0000808008080000, 0x0000808008080000, 
+            0x0000808000000800, 0x0000808000000800, 0x0000808008000800, 0x0000808008000800, 
+            0x0000808000080800, 0x0000808000080800, 0x0000808008080800, 0x0000808008080800, 
+            0x0000808080000000, 0x0000808080000000, 0x0000808088000000, 0x0000808088000000, 
+            0x0000808080080000, 0x0000808080080000, 0x0000808088080000, 0x0000808088080000, 
+            0x0000808080000800, 0x0000808080000800, 0x0000808088000800, 0x0000808088000800, 
+            0x0000808080080800, 0x0000808080080800, 0x0000808088080800, 0x0000808088080800, 
+            0x0080000000000000, 0x0080000000000000, 0x0080000008000000, 0x0080000008000000, 
+            0x0080000000080000, 0x0080000000080000, 0x0080000008080000, 0x0080000008080000, 
+            0x0080000000000800, 0x0080000000000800, 0x0080000008000800, 0x0080000008000800, 
+            0x0080000000080800, 0x0080000000080800, 0x0080000008080800, 0x0080000008080800, 
+            0x0080000080000000, 0x0080000080000000, 0x0080000088000000, 0x0080000088000000, 
+            0x0080000080080000, 0x0080000080080000, 0x0080000088080000, 0x0080000088080000, 
+            0x0080000080000800, 0x0080000080000800, 0x0080000088000800, 0x0080000088000800, 
+            0x0080000080080800, 0x0080000080080800, 0x0080000088080800, 0x0080000088080800, 
+            0x0080008000000000, 0x0080008000000000, 0x0080008008000000, 0x0080008008000000, 
+            0x0080008000080000, 0x0080008000080000, 0x0080008008080000, 0x0080008008080000, 
+            0x0080008000000800, 0x0080008000000800, 0x0080008008000800, 0x0080008008000800, 
+            0x0080008000080800, 0x0080008000080800, 0x0080008008080800, 0x0080008008080800, 
+            0x0080008080000000, 0x0080008080000000, 0x0080008088000000, 0x0080008088000000, 
+            0x0080008080080000, 0x0080008080080000, 0x0080008088080000, 0x0080008088080000, 
+            0x0080008080000800, 0x0080008080000800, 0x0080008088000800, 0x0080008088000800, 
+            0x0080008080080800, 0x0080008080080800, 0x0080008088080800, 0x0080008088080800, 
+            0x0080800000000000, 0x0080800000000000, 0x0080800008000000, 0x0080800008000000, 
+            0x0080800000080000, 0x0080800000080000, 0x0080800008080000, 0x0080800008080000, 
+            0x0080800000000800, 0x0080800000000800, 0x0080800008000800, 0x0080800008000800, 
+            0x0080800000080800, 0x0080800000080800, 0x0080800008080800, 0x0080800008080800, 
+            0x0080800080000000, 0x0080800080000000, 0x0080800088000000, 0x0080800088000000, 
+            0x0080800080080000, 0x0080800080080000, 0x0080800088080000, 0x0080800088080000, 
+            0x0080800080000800, 0x0080800080000800, 0x0080800088000800, 0x0080800088000800, 
+            0x0080800080080800, 0x0080800080080800, 0x0080800088080800, 0x0080800088080800, 
+            0x0080808000000000, 0x0080808000000000, 0x0080808008000000, 0x0080808008000000, 
+            0x0080808000080000, 0x0080808000080000, 0x0080808008080000, 0x0080808008080000, 
+            0x0080808000000800, 0x0080808000000800, 0x0080808008000800, 0x0080808008000800, 
+            0x0080808000080800, 0x0080808000080800, 0x0080808008080800, 0x0080808008080800, 
+            0x0080808080000000, 0x0080808080000000, 0x0080808088000000, 0x0080808088000000, 
+            0x0080808080080000, 0x0080808080080000, 0x0080808088080000, 0x0080808088080000, 
+            0x0080808080000800, 0x0080808080000800, 0x0080808088000800, 0x0080808088000800, 
+            0x0080808080080800, 0x0080808080080800, 0x0080808088080800, 0x0080808088080800
+        }, 
+        //byte 1
+        {
+            0x0000000000000000, 0x0000000000000000, 0x0000000004000000, 0x0000000004000000, 
+            0x0000000000040000, 0x0000000000040000, 0x0000000004040000, 0x0000000004040000, 
+            0x0000000000000400, 0x0000000000000400, 0x0000000004000400, 0x0000000004000400, 
+            0x0000000000040400, 0x0000000000040400, 0x0000000004040400, 0x0000000004040400, 
+            0x0000000040000000, 0x0000000040000000, 0x0000000044000000, 0x0000000044000000, 
+            0x0000000040040000, 0x0000000040040000, 0x0000000044040000, 0x0000000044040000, 
+            0x0000000040000400, 0x0000000040000400, 0x0000000044000400, 0x0000000044000400, 
+            0x0000000040040400, 0x0000000040040400, 0x0000000044040400, 0x0000000044040400, 
+            0x0000004000000000, 0x0000004000000000, 0x0000004004000000, 0x0000004004000000, 
+            0x0000004000040000, 0x0000004000040000, 0x0000004004040000, 0x0000004004040000, 
+            0x0000004000000400, 0x0000004000000400, 0x0000004004000400, 0x0000004004000400, 
+            0x0000004000040400, 0x0000004000040400, 0x0000004004040400, 0x0000004004040400, 
+            0x0000004040000000, 0x0000004040000000, 0x0000004044000000, 0x0000004044000000, 
+            0x0000004040040000, 0x0000004040040000, 0x0000004044040000, 0x0000004044040000, 
+            0x0000004040000400, 0x0000004040000400, 0x0000004044000400, 0x0000004044000400, 
+            0x0000004040040400, 0x0000004040040400, 0x0000004044040400, 0x0000004044040400, 
+            0x0000400000000000, 0x0000400000000000, 0x0000400004000000, 0x0000400004000000, 
+            0x0000400000040000, 0x0000400000040000, 0x0000400004040000, 0x0000400004040000, 
+            0x0000400000000400, 0x0000400000000400, 0x0000400004000400, 0x0000400004000400, 
+            0x0000400000040400, 0x0000400000040400, 0x0000400004040400, 0x0000400004040400, 
+            0x0000400040000000, 0x0000400040000000, 0x0000400044000000, 0x0000400044000000, 
+            0x0000400040040000, 0x0000400040040000, 0x0000400044040000, 0x0000400044040000, 
+            0x0000400040000400, 0x0000400040000400, 0x0000400044000400, 0x0000400044000400, 
+            0x0000400040040400, 0x0000400040040400, 0x0000400044040400, 0x0000400044040400, 
+            0x0000404000000000, 0x0000404000000000, 0x0000404004000000, 0x0000404004000000, 
+            0x0000404000040000, 0x0000404000040000, 0x0000404004040000, 0x0000404004040000, 
+            0x0000404000000400, 0x0000404000000400, 0x0000404004000400, 0x0000404004000400, 
+            0x0000404000040400, 0x0000404000040400, 0x0000404004040400, 0x0000404004040400, 
+            0x0000404040000000, 0x0000404040000000, 0x0000404044000000, 0x0000404044000000, 
+            0x0000404040040000, 0x0000404040040000, 0x0000404044040000, 0x0000404044040000, 
+            0x0000404040000400, 0x0000404040000400, 0x0000404044000400, 0x0000404044000400, 
+            0x0000404040040400, 0x0000404040040400, 0x0000404044040400, 0x0000404044040400, 
+            0x0040000000000000, 0x0040000000000000, 0x0040000004000000, 0x0040000004000000, 
+            0x0040000000040000, 0x0040000000040000, 0x0040000004040000, 0x0040000004040000, 
+            0x0040000000000400, 0x0040000000000400, 0x0040000004000400, 0x0040000004000400, 
+            0x0040000000040400, 0x0040000000040400, 0x0040000004040400, 0x0040000004040400, 
+            0x0040000040000000, 0x0040000040000000, 0x0040000044000000, 0x0040000044000000, 
+            0x0040000040040000, 0x0040000040040000, 0x0040000044040000, 0x0040000044040000, 
+            0x0040000040000400, 0x0040000040000400, 0x0040000044000400, 0x0040000044000400, 
+            0x0040000040040400, 0x0040000040040400, 0x0040000044040400, 0x0040000044040400, 
+            0x0040004000000000, 0x0040004000000000, 0x0040004004000000, 0x0040004004000000, 
+            0x0040004000040000, 0x0040004000040000, 0x0040004004040000, 0x0040004004040000, 
+            0x0040004000000400, 0x0040004000000400, 0x0040004004000400, 0x0040004004000400, 
+            0x0040004000040400, 0x0040004000040400, 0x0040004004040400, 0x0040004004040400, 
+            0x0040004040000000, 0x0040004040000000, 0x0040004044000000, 0x0040004044000000, 
+            0x0040004040040000, 0x0040004040040000, 0x0040004044040000, 0x0040004044040000, 
+            0x0040004040000400, 0x0040004040000400, 0x0040004044000400, 0x0040004044000400, 
+            0x0040004040040400, 0x0040004040040400, 0x0040004044040400, 0x0040004044040400, 
+            0x0040400000000000, 0x0040400000000000, 0x0040400004000000, 0x0040400004000000, 
+            0x0040400000040000, 0x0040400000040000, 0x0040400004040000, 0x0040400004040000, 
+            0x0040400000000400, 0x0040400000000400, 0x0040400004000400, 0x0040400004000400, 
+            0x0040400000040400, 0x0040400000040400, 0x0040400004040400, 0x0040400004040400, 
+            0x0040400040000000, 0x0040400040000000, 0x0040400044000000, 0x0040400044000000, 
+            0x0040400040040000, 0x0040400040040000, 0x0040400044040000, 0x0040400044040000, 
+            0x0040400040000400, 0x0040400040000400, 0x0040400044000400, 0x0040400044000400, 
+            0x0040400040040400, 0x0040400040040400, 0x0040400044040400, 0x0040400044040400, 
+            0x0040404000000000, 0x0040404000000000, 0x0040404004000000, 0x0040404004000000, 
+            0x0040404000040000, 0x0040404000040000, 0x0040404004040000, 0x0040404004040000, 
+            0x0040404000000400, 0x0040404000000400, 0x0040404004000400, 0x0040404004000400, 
+            0x0040404000040400, 0x0040404000040400, 0x0040404004040400, 0x0040404004040400, 
+            0x0040404040000000, 0x0040404040000000, 0x0040404044000000, 0x0040404044000000, 
+            0x0040404040040000, 0x0040404040040000, 0x0040404044040000, 0x0040404044040000, 
+            0x0040404040000400, 0x0040404040000400, 0x0040404044000400, 0x0040404044000400, 
+            0x0040404040040400, 0x0040404040040400, 0x0040404044040400, 0x0040404044040400
+        }, 
+        //byte 2
+        {
+            0x0000000000000000, 0x0000000000000000, 0x0000000002000000, 0x0000000002000000, 
+            0x0000000000020000, 0x0000000000020000, 0x0000000002020000, 0x0000000002020000, 
+            0x0000000000000200, 0x0000000000000200, 0x0000000002000200, 0x0000000002000200, 
+            0x0000000000020200, 0x0000000000020200, 0x0000000002020200, 0x0000000002020200, 
+            0x0000000020000000, 0x0000000020000000, 0x0000000022000000, 0x0000000022000000, 
+            0x0000000020020000, 0x0000000020020000, 0x0000000022020000, 0x0000000022020000, 
+            0x0000000020000200, 0x0000000020000200, 0x0000000022000200, 0x0000000022000200, 
+            0x0000000020020200, 0x0000000020020200, 0x0000000022020200, 0x0000000022020200, 
+            0x0000002000000000, 0x0000002000000000, 0x0000002002000000, 0x0000002002000000, 
+            0x0000002000020000, 0x0000002000020000, 0x0000002002020000, 0x0000002002020000, 
+            0x0000002000000200, 0x0000002000000200, 0x0000002002000200, 0x0000002002000200, 
+            0x0000002000020200, 0x0000002000020200, 0x0000002002020200, 0x0000002002020200, 
+            0x0000002020000000, 0x0000002020000000, 0x0000002022000000, 0x0000002022000000, 
+            0x0000002020020000, 0x0000002020020000, 0x0000002022020000, 0x0000002022020000, 
+            0x0000002020000200, 0x0000002020000200, 0x0000002022000200, 0x0000002022000200, 
+            0x0000002020020200, 0x0000002020020200, 0x0000002022020200, 0x0000002022020200, 
+            0x0000200000000000, 0x0000200000000000, 0x0000200002000000, 0x0000200002000000, 
+            0x0000200000020000, 0x0000200000020000, 0x0000200002020000, 0x0000200002020000, 
+            0x0000200000000200, 0x0000200000000200, 0x0000200002000200, 0x0000200002000200, 
+            0x0000200000020200, 0x0000200000020200, 0x0000200002020200, 0x0000200002020200, 
+            0x0000200020000000, 0x0000200020000000, 0x0000200022000000, 0x0000200022000000, 
+            0x0000200020020000, 0x0000200020020000, 0x0000200022020000, 0x0000200022020000, 
+            0x0000200020000200, 0x0000200020000200, 0x0000200022000200, 0x0000200022000200, 
+            0x0000200020020200, 0x0000200020020200, 0x0000200022020200, 0x0000200022020200, 
+            0x0000202000000000, 0x0000202000000000, 0x0000202002000000, 0x0000202002000000, 
+            0x0000202000020000, 0x0000202000020000, 0x0000202002020000, 0x0000202002020000, 
+            0x0000202000000200, 0x0000202000000200, 0x0000202002000200, 0x0000202002000200, 
+            0x0000202000020200, 0x0000202000020200, 0x0000202002020200, 0x0000202002020200, 
+            0x0000202020000000, 0x0000202020000000, 0x0000202022000000, 0x0000202022000000, 
+            0x0000202020020000, 0x0000202020020000, 0x0000202022020000, 0x0000202022020000, 
+            0x0000202020000200, 0x0000202020000200, 0x0000202022000200, 0x0000202022000200, 
+            0x0000202020020200, 0x0000202020020200, 0x0000202022020200, 0x0000202022020200, 
+            0x0020000000000000, 0x0020000000000000, 0x0020000002000000, 0x0020000002000000, 
+            0x0020000000020000, 0x0020000000020000, 0x0020000002020000, 0x0020000002020000, 
+            0x0020000000000200, 0x0020000000000200, 0x0020000002000200, 0x0020000002000200, 
+            0x0020000000020200, 0x0020000000020200, 0x0020000002020200, 0x0020000002020200, 
+            0x0020000020000000, 0x0020000020000000, 0x0020000022000000, 0x0020000022000000, 
+            0x0020000020020000, 0x0020000020020000, 0x0020000022020000, 0x0020000022020000, 
+            0x0020000020000200, 0x0020000020000200, 0x0020000022000200, 0x0020000022000200, 
+            0x0020000020020200, 0x0020000020020200, 0x0020000022020200, 0x0020000022020200, 
+            0x0020002000000000, 0x0020002000000000, 0x0020002002000000, 0x0020002002000000, 
+            0x0020002000020000, 0x0020002000020000, 0x0020002002020000, 0x0020002002020000, 
+            0x0020002000000200, 0x0020002000000200, 0x0020002002000200, 0x0020002002000200, 
+            0x0020002000020200, 0x0020002000020200, 0x0020002002020200, 0x0020002002020200, 
+            0x0020002020000000, 0x0020002020000000, 0x0020002022000000, 0x0020002022000000, 
+            0x0020002020020000, 0x0020002020020000, 0x0020002022020000, 0x0020002022020000, 
+            0x0020002020000200, 0x0020002020000200, 0x0020002022000200, 0x0020002022000200, 
+            0x0020002020020200, 0x0020002020020200, 0x0020002022020200, 0x0020002022020200, 
+            0x0020200000000000, 0x0020200000000000, 0x0020200002000000, 0x0020200002000000, 
+            0x0020200000020000, 0x0020200000020000, 0x0020200002020000, 0x0020200002020000, 
+            0x0020200000000200, 0x0020200000000200, 0x0020200002000200, 0x0020200002000200, 
+            0x0020200000020200, 0x0020200000020200, 0x0020200002020200, 0x0020200002020200, 
+            0x0020200020000000, 0x0020200020000000, 0x0020200022000000, 0x0020200022000000, 
+            0x0020200020020000, 0x0020200020020000, 0x0020200022020000, 0x0020200022020000, 
+            0x0020200020000200, 0x0020200020000200, 0x0020200022000200, 0x0020200022000200, 
+            0x0020200020020200, 0x0020200020020200, 0x0020200022020200, 0x0020200022020200, 
+            0x0020202000000000, 0x0020202000000000, 0x0020202002000000, 0x0020202002000000, 
+            0x0020202000020000, 0x0020202000020000, 0x0020202002020000, 0x0020202002020000, 
+            0x0020202000000200, 0x0020202000000200, 0x0020202002000200, 0x0020202002000200, 
+            0x0020202000020200, 0x0020202000020200, 0x0020202002020200, 0x0020202002020200, 
+            0x0020202020000000, 0x0020202020000000, 0x0020202022000000, 0x0020202022000000, 
+            0x0020202020020000, 0x0020202020020000, 0x0020202022020000, 0x0020202022020000, 
+            0x0020202020000200, 0x0020202020000200, 0x0020202022000200, 0x0020202022000200, 
+            0x0020202020020200, 0x0020202020020200, 0x0020202022020200, 0x0020202022020200
+        }, 
+        //byte 3
+        {
+            0x0000000000000000, 0x0000000000000000, 0x0000000001000000, 0x0000000001000000, 
+            0x0000000000010000, 0x0000000000010000, 0x0000000001010000, 0x0000000001010000, 
+            0x0000000000000100, 0x0000000000000100, 0x0000000001000100, 0x0000000001000100, 
+            0x0000000000010100, 0x0000000000010100, 0x0000000001010100, 0x0000000001010100, 
+            0x0000000010000000, 0x0000000010000000, 0x0000000011000000, 0x0000000011000000, 
+            0x0000000010010000, 0x0000000010010000, 0x0000000011010000, 0x0000000011010000, 
+            0x0000000010000100, 0x0000000010000100, 0x0000000011000100, 0x0000000011000100, 
+            0x0000000010010100, 0x0000000010010100, 0x0000000011010100, 0x0000000011010100, 
+            0x0000001000000000, 0x0000001000000000, 0x0000001001000000, 0x0000001001000000, 
+            0x0000001000010000, 0x0000001000010000, 0x0000001001010000, 0x0000001001010000, 
+            0x0000001000000100, 0x0000001000000100, 0x0000001001000100, 0x0000001001000100, 
+            0x0000001000010100, 0x0000001000010100, 0x0000001001010100, 0x0000001001010100, 
+            0x0000001010000000, 0x0000001010000000, 0x0000001011000000, 0x0000001011000000, 
+            0x0000001010010000, 0x0000001010010000, 0x0000001011010000, 0x0000001011010000, 
+            0x0000001010000100, 0x0000001010000100, 0x0000001011000100, 0x0000001011000100, 
+            0x0000001010010100, 0x0000001010010100, 0x0000001011010100, 0x0000001011010100, 
+            0x0000100000000000, 0x0000100000000000, 0x0000100001000000, 0x0000100001000000, 
+            0x0000100000010000, 0x0000100000010000, 0x0000100001010000, 0x0000100001010000, 
+            0x0000100000000100, 0x0000100000000100, 0x0000100001000100, 0x0000100001000100, 
+            0x0000100000010100, 0x0000100000010100, 0x0000100001010100, 0x0000100001010100, 
+            0x0000100010000000, 0x0000100010000000, 0x0000100011000000, 0x0000100011000000, 
+            0x0000100010010000, 0x0000100010010000, 0x0000100011010000, 0x0000100011010000, 
+            0x0000100010000100, 0x0000100010000100, 0x0000100011000100, 0x0000100011000100, 
+            0x0000100010010100, 0x0000100010010100, 0x0000100011010100, 0x0000100011010100, 
+            0x0000101000000000, 0x0000101000000000, 0x0000101001000000, 0x0000101001000000, 
+            0x0000101000010000, 0x0000101000010000, 0x0000101001010000, 0x0000101001010000, 
+            0x0000101000000100, 0x0000101000000100, 0x0000101001000100, 0x0000101001000100, 
+            0x0000101000010100, 0x0000101000010100, 0x0000101001010100, 0x0000101001010100, 
+            0x0000101010000000, 0x0000101010000000, 0x0000101011000000, 0x0000101011000000, 
+            0x0000101010010000, 0x0000101010010000, 0x0000101011010000, 0x0000101011010000, 
+            0x0000101010000100, 0x0000101010000100, 0x0000101011000100, 0x0000101011000100, 
+            0x0000101010010100, 0x0000101010010100, 0x0000101011010100, 0x0000101011010100, 
+            0x0010000000000000, 0x0010000000000000, 0x0010000001000000, 0x0010000001000000, 
+            0x0010000000010000, 0x0010000000010000, 0x0010000001010000, 0x0010000001010000, 
+            0x0010000000000100, 0x0010000000000100, 0x0010000001000100, 0x0010000001000100, 
+            0x0010000000010100, 0x0010000000010100, 0x0010000001010100, 0x0010000001010100, 
+            0x0010000010000000, 0x0010000010000000, 0x0010000011000000, 0x0010000011000000, 
+            0x0010000010010000, 0x0010000010010000, 0x0010000011010000, 0x0010000011010000, 
+            0x0010000010000100, 0x0010000010000100, 0x0010000011000100, 0x0010000011000100, 
+            0x0010000010010100, 0x0010000010010100, 0x0010000011010100, 0x0010000011010100, 
+            0x0010001000000000, 0x0010001000000000, 0x0010001001000000, 0x0010001001000000, 
+            0x0010001000010000, 0x0010001000010000, 0x0010001001010000, 0x0010001001010000, 
+            0x0010001000000100, 0x0010001000000100, 0x0010001001000100, 0x0010001001000100, 
+            0x0010001000010100, 0x0010001000010100, 0x0010001001010100, 0x0010001001010100, 
+            0x0010001010000000, 0x0010001010000000, 0x0010001011000000, 0x0010001011000000, 
+            0x0010001010010000, 0x0010001010010000, 0x0010001011010000, 0x0010001011010000, 
+            0x0010001010000100, 0x0010001010000100, 0x0010001011000100, 0x0010001011000100, 
+            0x0010001010010100, 0x0010001010010100, 0x0010001011010100, 0x0010001011010100, 
+            0x0010100000000000, 0x0010100000000000, 0x0010100001000000, 0x0010100001000000, 
+            0x0010100000010000, 0x0010100000010000, 0x0010100001010000, 0x0010100001010000, 
+            0x0010100000000100, 0x0010100000000100, 0x0010100001000100, 0x0010100001000100, 
+            0x0010100000010100, 0x0010100000010100, 0x0010100001010100, 0x0010100001010100, 
+            0x0010100010000000, 0x0010100010000000, 0x0010100011000000, 0x0010100011000000, 
+            0x0010100010010000, 0x0010100010010000, 0x0010100011010000, 0x0010100011010000, 
+            0x0010100010000100, 0x0010100010000100, 0x0010100011000100, 0x0010100011000100, 
+            0x0010100010010100, 0x0010100010010100, 0x0010100011010100, 0x0010100011010100, 
+            0x0010101000000000, 0x0010101000000000, 0x0010101001000000, 0x0010101001000000, 
+            0x0010101000010000, 0x0010101000010000, 0x0010101001010000, 0x0010101001010000, 
+            0x0010101000000100, 0x0010101000000100, 0x0010101001000100, 0x0010101001000100, 
+            0x0010101000010100, 0x0010101000010100, 0x0010101001010100, 0x0010101001010100, 
+            0x0010101010000000, 0x0010101010000000, 0x0010101011000000, 0x0010101011000000, 
+            0x0010101010010000, 0x0010101010010000, 0x0010101011010000, 0x0010101011010000, 
+            0x0010101010000100, 0x0010101010000100, 0x0010101011000100, 0x0010101011000100, 
+            0x0010101010010100, 0x0010101010010100, 0x0010101011010100, 0x0010101011010100
+        }, 
+        //byte 4
+        {
+            0x0000000000000000, 0x0000000000000000, 0x0000000000800000, 0x0000000000800000, 
+            0x0000000000008000, 0x0000000000008000, 0x0000000000808000, 0x0000000000808000, 
+            0x0000000000000080, 0x0000000000000080, 0x0000000000800080, 0x0000000000800080, 
+            0x0000000000008080, 0x0000000000008080, 0x0000000000808080, 0x0000000000808080, 
+            0x0000000000000008, 0x0000000000000008, 0x0000000000800008, 0x0000000000800008, 
+            0x0000000000008008, 0x0000000000008008, 0x0000000000808008, 0x0000000000808008, 
+            0x0000000000000088, 0x0000000000000088, 0x0000000000800088, 0x0000000000800088, 
+            0x0000000000008088, 0x0000000000008088, 0x0000000000808088, 0x0000000000808088, 
+            0x0000000800000000, 0x0000000800000000, 0x0000000800800000, 0x0000000800800000, 
+            0x0000000800008000, 0x0000000800008000, 0x0000000800808000, 0x0000000800808000, 
+            0x0000000800000080, 0x0000000800000080, 0x0000000800800080, 0x0000000800800080, 
+            0x0000000800008080, 0x0000000800008080, 0x0000000800808080, 0x0000000800808080, 
+            0x0000000800000008, 0x0000000800000008, 0x0000000800800008, 0x0000000800800008, 
+            0x0000000800008008, 0x0000000800008008, 0x0000000800808008, 0x0000000800808008, 
+            0x0000000800000088, 0x0000000800000088, 0x0000000800800088, 0x0000000800800088, 
+            0x0000000800008088, 0x0000000800008088, 0x0000000800808088, 0x0000000800808088, 
+            0x0000080000000000, 0x0000080000000000, 0x0000080000800000, 0x0000080000800000, 
+            0x0000080000008000, 0x0000080000008000, 0x0000080000808000, 0x0000080000808000, 
+            0x0000080000000080, 0x0000080000000080, 0x0000080000800080, 0x0000080000800080, 
+            0x0000080000008080, 0x0000080000008080, 0x0000080000808080, 0x0000080000808080, 
+            0x0000080000000008, 0x0000080000000008, 0x0000080000800008, 0x0000080000800008, 
+            0x0000080000008008, 0x0000080000008008, 0x0000080000808008, 0x0000080000808008, 
+            0x0000080000000088, 0x0000080000000088, 0x0000080000800088, 0x0000080000800088, 
+            0x0000080000008088, 0x0000080000008088, 0x0000080000808088, 0x0000080000808088, 
+            0x0000080800000000, 0x0000080800000000, 0x0000080800800000, 0x0000080800800000, 
+            0x0000080800008000, 0x0000080800008000, 0x0000080800808000, 0x0000080800808000, 
+            0x0000080800000080, 0x0000080800000080, 0x0000080800800080, 0x0000080800800080, 
+            0x0000080800008080, 0x0000080800008080, 0x0000080800808080, 0x0000080800808080, 
+            0x0000080800000008, 0x0000080800000008, 0x0000080800800008, 0x0000080800800008, 
+            0x0000080800008008, 0x0000080800008008, 0x0000080800808008, 0x0000080800808008, 
+            0x0000080800000088, 0x0000080800000088, 0x0000080800800088, 0x0000080800800088, 
+            0x0000080800008088, 0x0000080800008088, 0x0000080800808088, 0x0000080800808088, 
+            0x0008000000000000, 0x0008000000000000, 0x0008000000800000, 0x0008000000800000, 
+            0x0008000000008000, 0x0008000000008000, 0x0008000000808000, 0x0008000000808000, 
+            0x0008000000000080, 0x0008000000000080, 0x0008000000800080, 0x0008000000800080, 
+            0x0008000000008080, 0x0008000000008080, 0x0008000000808080, 0x0008000000808080, 
+            0x0008000000000008, 0x0008000000000008, 0x0008000000800008, 0x0008000000800008, 
+            0x0008000000008008, 0x0008000000008008, 0x0008000000808008, 0x0008000000808008, 
+            0x0008000000000088, 0x0008000000000088, 0x0008000000800088, 0x0008000000800088, 
+            0x0008000000008088, 0x0008000000008088, 0x0008000000808088, 0x0008000000808088, 
+            0x0008000800000000, 0x0008000800000000, 0x0008000800800000, 0x0008000800800000, 
+            0x0008000800008000, 0x0008000800008000, 0x0008000800808000, 0x0008000800808000, 
+            0x0008000800000080, 0x0008000800000080, 0x0008000800800080, 0x0008000800800080, 
+            0x0008000800008080, 0x0008000800008080, 0x0008000800808080, 0x0008000800808080, 
+            0x0008000800000008, 0x0008000800000008, 0x0008000800800008, 0x0008000800800008, 
+            0x0008000800008008, 0x0008000800008008, 0x0008000800808008, 0x0008000800808008, 
+            0x0008000800000088, 0x0008000800000088, 0x0008000800800088, 0x0008000800800088, 
+            0x0008000800008088, 0x0008000800008088, 0x0008000800808088, 0x0008000800808088, 
+            0x0008080000000000, 0x0008080000000000, 0x0008080000800000, 0x0008080000800000, 
+            0x0008080000008000, 0x0008080000008000, 0x0008080000808000, 0x0008080000808000, 
+            0x0008080000000080, 0x0008080000000080, 0x0008080000800080, 0x0008080000800080, 
+            0x0008080000008080, 0x0008080000008080, 0x0008080000808080, 0x0008080000808080, 
+            0x0008080000000008, 0x0008080000000008, 0x0008080000800008, 0x0008080000800008, 
+            0x0008080000008008, 0x0008080000008008, 0x0008080000808008, 0x0008080000808008, 
+            0x0008080000000088, 0x0008080000000088, 0x0008080000800088, 0x0008080000800088, 
+            0x0008080000008088, 0x0008080000008088, 0x0008080000808088, 0x0008080000808088, 
+            0x0008080800000000, 0x0008080800000000, 0x0008080800800000, 0x0008080800800000, 
+            0x0008080800008000, 0x0008080800008000, 0x0008080800808000, 0x0008080800808000, 
+            0x0008080800000080, 0x0008080800000080, 0x0008080800800080, 0x0008080800800080, 
+            0x0008080800008080, 0x0008080800008080, 0x0008080800808080, 0x0008080800808080, 
+            0x0008080800000008, 0x0008080800000008, 0x0008080800800008, 0x0008080800800008, 
+            0x0008080800008008, 0x0008080800008008, 0x0008080800808008, 0x0008080800808008, 
+            0x0008080800000088, 0x0008080800000088, 0x0008080800800088, 0x0008080800800088, 
+            0x0008080800008088, 0x0008080800008088, 0x0008080800808088, 0x0008080800808088
+        }, 
+        //byte 5
+        {
+            0x0000000000000000, 0x0000000000000000, 0x0000000000400000, 0x0000000000400000, 
+            0x0000000000004000, 0x0000000000004000, 0x0000000000404000, 0x0000000000404000, 
+            0x0000000000000040, 0x0000000000000040, 0x0000000000400040, 0x0000000000400040, 
+            0x0000000000004040, 0x0000000000004040, 0x0000000000404040, 0x0000000000404040, 
+            0x0000000000000004, 0x0000000000000004, 0x0000000000400004, 0x0000000000400004, 
+            0x0000000000004004, 0x0000000000004004, 0x0000000000404004, 0x0000000000404004, 
+            0x0000000000000044, 0x0000000000000044, 0x0000000000400044, 0x0000000000400044, 
+            0x0000000000004044, 0x0000000000004044, 0x0000000000404044, 0x0000000000404044, 
+            0x0000000400000000, 0x0000000400000000, 0x0000000400400000, 0x0000000400400000, 
+            0x0000000400004000, 0x0000000400004000, 0x0000000400404000, 0x0000000400404000, 
+            0x0000000400000040, 0x0000000400000040, 0x0000000400400040, 0x0000000400400040, 
+            0x0000000400004040, 0x0000000400004040, 0x0000000400404040, 0x0000000400404040, 
+            0x0000000400000004, 0x0000000400000004, 0x0000000400400004, 0x0000000400400004, 
+            0x0000000400004004, 0x0000000400004004, 0x0000000400404004, 0x0000000400404004, 
+            0x0000000400000044, 0x0000000400000044, 0x0000000400400044, 0x0000000400400044, 
+            0x0000000400004044, 0x0000000400004044, 0x0000000400404044, 0x0000000400404044, 
+            0x0000040000000000, 0x0000040000000000, 0x0000040000400000, 0x0000040000400000, 
+            0x0000040000004000, 0x0000040000004000, 0x0000040000404000, 0x0000040000404000, 
+            0x0000040000000040, 0x0000040000000040, 0x0000040000400040, 0x0000040000400040, 
+            0x0000040000004040, 0x0000040000004040, 0x0000040000404040, 0x0000040000404040, 
+            0x0000040000000004, 0x0000040000000004, 0x0000040000400004, 0x0000040000400004, 
+            0x0000040000004004, 0x0000040000004004, 0x0000040000404004, 0x0000040000404004, 
+            0x0000040000000044, 0x0000040000000044, 0x0000040000400044, 0x0000040000400044, 
+            0x0000040000004044, 0x0000040000004044, 0x0000040000404044, 0x0000040000404044, 
+            0x0000040400000000, 0x0000040400000000, 0x0000040400400000, 0x0000040400400000, 
+            0x0000040400004000, 0x0000040400004000, 0x0000040400404000, 0x0000040400404000, 
+            0x0000040400000040, 0x0000040400000040, 0x0000040400400040, 0x0000040400400040, 
+            0x0000040400004040, 0x0000040400004040, 0x0000040400404040, 0x0000040400404040, 
+            0x0000040400000004, 0x0000040400000004, 0x0000040400400004, 0x0000040400400004, 
+            0x0000040400004004, 0x0000040400004004, 0x0000040400404004, 0x0000040400404004, 
+            0x0000040400000044, 0x0000040400000044, 0x0000040400400044, 0x0000040400400044, 
+            0x0000040400004044, 0x0000040400004044, 0x0000040400404044, 0x0000040400404044, 
+            0x0004000000000000, 0x0004000000000000, 0x0004000000400000, 0x0004000000400000, 
+            0x0004000000004000, 0x0004000000004000, 0x0004000000404000, 0x0004000000404000, 
+            0x0004000000000040, 0x0004000000000040, 0x0004000000400040, 0x0004000000400040, 
+            0x0004000000004040, 0x0004000000004040, 0x0004000000404040, 0x0004000000404040, 
+            0x0004000000000004, 0x0004000000000004, 0x0004000000400004, 0x0004000000400004, 
+            0x0004000000004004, 0x0004000000004004, 0x0004000000404004, 0x0004000000404004, 
+            0x0004000000000044, 0x0004000000000044, 0x0004000000400044, 0x0004000000400044, 
+            0x0004000000004044, 0x0004000000004044, 0x0004000000404044, 0x0004000000404044, 
+            0x0004000400000000, 0x0004000400000000, 0x0004000400400000, 0x0004000400400000, 
+            0x0004000400004000, 0x0004000400004000, 0x0004000400404000, 0x0004000400404000, 
+            0x0004000400000040, 0x0004000400000040, 0x0004000400400040, 0x0004000400400040, 
+            0x0004000400004040, 0x0004000400004040, 0x0004000400404040, 0x0004000400404040, 
+            0x0004000400000004, 0x0004000400000004, 0x0004000400400004, 0x0004000400400004, 
+            0x0004000400004004, 0x0004000400004004, 0x0004000400404004, 0x0004000400404004, 
+            0x0004000400000044, 0x0004000400000044, 0x0004000400400044, 0x0004000400400044, 
+            0x0004000400004044, 0x0004000400004044, 0x0004000400404044, 0x0004000400404044, 
+            0x0004040000000000, 0x0004040000000000, 0x0004040000400000, 0x0004040000400000, 
+            0x0004040000004000, 0x0004040000004000, 0x0004040000404000, 0x0004040000404000, 
+            0x0004040000000040, 0x0004040000000040, 0x0004040000400040, 0x0004040000400040, 
+            0x0004040000004040, 0x0004040000004040, 0x0004040000404040, 0x0004040000404040, 
+            0x0004040000000004, 0x0004040000000004, 0x0004040000400004, 0x0004040000400004, 
+            0x0004040000004004, 0x0004040000004004, 0x0004040000404004, 0x0004040000404004, 
+            0x0004040000000044, 0x0004040000000044, 0x0004040000400044, 0x0004040000400044, 
+            0x0004040000004044, 0x0004040000004044, 0x0004040000404044, 0x0004040000404044, 
+            0x0004040400000000, 0x0004040400000000, 0x0004040400400000, 0x0004040400400000, 
+            0x0004040400004000, 0x0004040400004000, 0x0004040400404000, 0x0004040400404000, 
+            0x0004040400000040, 0x0004040400000040, 0x0004040400400040, 0x0004040400400040, 
+            0x0004040400004040, 0x0004040400004040, 0x0004040400404040, 0x0004040400404040, 
+            0x0004040400000004, 0x0004040400000004, 0x0004040400400004, 0x0004040400400004, 
+            0x0004040400004004, 0x0004040400004004, 0x0004040400404004, 0x0004040400404004, 
+            0x0004040400000044, 0x0004040400000044, 0x0004040400400044, 0x0004040400400044, 
+            0x0004040400004044, 0x0004040400004044, 0x0004040400404044, 0x0004040400404044
+        }, 
+        //byte 6
+        {
+            0x0000000000000000, 0x0000000000000000, 0x0000000000200000, 0x0000000000200000, 
+            0x0000000000002000, 0x0000000000002000, 0x0000000000202000, 0x0000000000202000, 
+            0x0000000000000020, 0x0000000000000020, 0x0000000000200020, 0x0000000000200020, 
+            0x0000000000002020, 0x0000000000002020, 0x0000000000202020, 0x0000000000202020, 
+            0x0000000000000002, 0x0000000000000002, 0x0000000000200002, 0x0000000000200002, 
+            0x0000000000002002, 0x0000000000002002, 0x0000000000202002, 0x0000000000202002, 
+            0x0000000000000022, 0x0000000000000022, 0x0000000000200022, 0x0000000000200022, 
+            0x0000000000002022, 0x0000000000002022, 0x0000000000202022, 0x0000000000202022, 
+            0x0000000200000000, 0x0000000200000000, 0x0000000200200000, 0x0000000200200000, 
+            0x0000000200002000, 0x0000000200002000, 0x0000000200202000, 0x0000000200202000, 
+            0x0000000200000020, 0x0000000200000020, 0x0000000200200020, 0x0000000200200020, 
+            0x0000000200002020, 0x0000000200002020, 0x0000000200202020, 0x0000000200202020, 
+            0x0000000200000002, 0x0000000200000002, 0x0000000200200002, 0x0000000200200002, 
+            0x0000000200002002, 0x0000000200002002, 0x0000000200202002, 0x0000000200202002, 
+            0x0000000200000022, 0x0000000200000022, 0x0000000200200022, 0x0000000200200022, 
+            0x0000000200002022, 0x0000000200002022, 0x0000000200202022, 0x0000000200202022, 
+            0x0000020000000000, 0x0000020000000000, 0x0000020000200000, 0x0000020000200000, 
+            0x0000020000002000, 0x0000020000002000, 0x0000020000202000, 0x0000020000202000, 
+            0x0000020000000020, 0x0000020000000020, 0x0000020000200020, 0x0000020000200020, 
+            0x0000020000002020, 0x0000020000002020, 0x0000020000202020, 0x0000020000202020, 
+            0x0000020000000002, 0x0000020000000002, 0x0000020000200002, 0x0000020000200002, 
+            0x0000020000002002, 0x0000020000002002, 0x0000020000202002, 0x0000020000202002, 
+            0x0000020000000022, 0x0000020000000022, 0x0000020000200022, 0x0000020000200022, 
+            0x0000020000002022, 0x0000020000002022, 0x0000020000202022, 0x0000020000202022, 
+            0x0000020200000000, 0x0000020200000000, 0x0000020200200000, 0x0000020200200000, 
+            0x0000020200002000, 0x0000020200002000, 0x0000020200202000, 0x0000020200202000, 
+            0x0000020200000020, 0x0000020200000020, 0x0000020200200020, 0x0000020200200020, 
+            0x0000020200002020, 0x0000020200002020, 0x0000020200202020, 0x0000020200202020, 
+            0x0000020200000002, 0x0000020200000002, 0x0000020200200002, 0x0000020200200002, 
+            0x0000020200002002, 0x0000020200002002, 0x0000020200202002, 0x0000020200202002, 
+            0x0000020200000022, 0x0000020200000022, 0x0000020200200022, 0x0000020200200022, 
+            0x0000020200002022, 0x0000020200002022, 0x0000020200202022, 0x0000020200202022, 
+            0x0002000000000000, 0x0002000000000000, 0x0002000000200000, 0x0002000000200000, 
+            0x0002000000002000, 0x0002000000002000, 0x0002000000202000, 0x0002000000202000, 
+            0x0002000000000020, 0x0002000000000020, 0x0002000000200020, 0x0002000000200020, 
+            0x0002000000002020, 0x0002000000002020, 0x0002000000202020, 0x0002000000202020, 
+            0x0002000000000002, 0x0002000000000002, 0x0002000000200002, 0x0002000000200002, 
+            0x0002000000002002, 0x0002000000002002, 0x0002000000202002, 0x0002000000202002, 
+            0x0002000000000022, 0x0002000000000022, 0x0002000000200022, 0x0002000000200022, 
+            0x0002000000002022, 0x0002000000002022, 0x0002000000202022, 0x0002000000202022, 
+            0x0002000200000000, 0x0002000200000000, 0x0002000200200000, 0x0002000200200000, 
+            0x0002000200002000, 0x0002000200002000, 0x0002000200202000, 0x0002000200202000, 
+            0x0002000200000020, 0x0002000200000020, 0x0002000200200020, 0x0002000200200020, 
+            0x0002000200002020, 0x0002000200002020, 0x0002000200202020, 0x0002000200202020, 
+            0x0002000200000002, 0x0002000200000002, 0x0002000200200002, 0x0002000200200002, 
+            0x0002000200002002, 0x0002000200002002, 0x0002000200202002, 0x0002000200202002, 
+            0x0002000200000022, 0x0002000200000022, 0x0002000200200022, 0x0002000200200022, 
+            0x0002000200002022, 0x0002000200002022, 0x0002000200202022, 0x0002000200202022, 
+            0x0002020000000000, 0x0002020000000000, 0x0002020000200000, 0x0002020000200000, 
+            0x0002020000002000, 0x0002020000002000, 0x0002020000202000, 0x0002020000202000, 
+            0x0002020000000020, 0x0002020000000020, 0x0002020000200020, 0x0002020000200020, 
+            0x0002020000002020, 0x0002020000002020, 0x0002020000202020, 0x0002020000202020, 
+            0x0002020000000002, 0x0002020000000002, 0x0002020000200002, 0x0002020000200002, 
+            0x0002020000002002, 0x0002020000002002, 0x0002020000202002, 0x0002020000202002, 
+            0x0002020000000022, 0x0002020000000022, 0x0002020000200022, 0x0002020000200022, 
+            0x0002020000002022, 0x0002020000002022, 0x0002020000202022, 0x0002020000202022, 
+            0x0002020200000000, 0x0002020200000000, 0x0002020200200000, 0x0002020200200000, 
+            0x0002020200002000, 0x0002020200002000, 0x0002020200202000, 0x0002020200202000, 
+            0x0002020200000020, 0x0002020200000020, 0x0002020200200020, 0x0002020200200020, 
+            0x0002020200002020, 0x0002020200002020, 0x0002020200202020, 0x0002020200202020, 
+            0x0002020200000002, 0x0002020200000002, 0x0002020200200002, 0x0002020200200002, 
+            0x0002020200002002, 0x0002020200002002, 0x0002020200202002, 0x0002020200202002, 
+            0x0002020200000022, 0x0002020200000022, 0x0002020200200022, 0x0002020200200022, 
+            0x0002020200002022, 0x0002020200002022, 0x0002020200202022, 0x0002020200202022
+        }, 
+        //byte 7
+        {
+            0x0000000000000000, 0x0000000000000000, 0x0000000000100000, 0x0000000000100000, 
+            0x0000000000001000, 0x0000000000001000, 0x0000000000101000, 0x0000000000101000, 
+            0x0000000000000010, 0x0000000000000010, 0x0000000000100010, 0x0000000000100010, 
+            0x0000000000001010, 0x0000000000001010, 0x0000000000101010, 0x0000000000101010, 
+            0x0000000000000001, 0x0000000000000001, 0x0000000000100001, 0x0000000000100001, 
+            0x0000000000001001, 0x0000000000001001, 0x0000000000101001, 0x0000000000101001, 
+            0x0000000000000011, 0x0000000000000011, 0x0000000000100011, 0x0000000000100011, 
+            0x0000000000001011, 0x0000000000001011, 0x0000000000101011, 0x0000000000101011, 
+            0x0000000100000000, 0x0000000100000000, 0x0000000100100000, 0x0000000100100000, 
+            0x0000000100001000, 0x0000000100001000, 0x0000000100101000, 0x0000000100101000, 
+            0x0000000100000010, 0x0000000100000010, 0x0000000100100010, 0x0000000100100010, 
+            0x0000000100001010, 0x0000000100001010, 0x0000000100101010, 0x0000000100101010, 
+            0x0000000100000001, 0x0000000100000001, 0x0000000100100001, 0x0000000100100001, 
+            0x0000000100001001, 0x0000000100001001, 0x0000000100101001, 0x0000000100101001, 
+            0x0000000100000011, 0x0000000100000011, 0x0000000100100011, 0x0000000100100011, 
+            0x0000000100001011, 0x0000000100001011, 0x0000000100101011, 0x0000000100101011, 
+            0x0000010000000000, 0x0000010000000000, 0x0000010000100000, 0x0000010000100000, 
+            0x0000010000001000, 0x0000010000001000, 0x0000010000101000, 0x0000010000101000, 
+            0x0000010000000010, 0x0000010000000010, 0x0000010000100010, 0x0000010000100010, 
+            0x0000010000001010, 0x0000010000001010, 0x0000010000101010, 0x0000010000101010, 
+            0x0000010000000001, 0x0000010000000001, 0x0000010000100001, 0x0000010000100001, 
+            0x0000010000001001, 0x0000010000001001, 0x0000010000101001, 0x0000010000101001, 
+            0x0000010000000011, 0x0000010000000011, 0x0000010000100011, 0x0000010000100011, 
+            0x0000010000001011, 0x0000010000001011, 0x0000010000101011, 0x0000010000101011, 
+            0x0000010100000000, 0x0000010100000000, 0x0000010100100000, 0x0000010100100000, 
+            0x0000010100001000, 0x0000010100001000, 0x0000010100101000, 0x0000010100101000, 
+            0x0000010100000010, 0x0000010100000010, 0x0000010100100010, 0x0000010100100010, 
+            0x0000010100001010, 0x0000010100001010, 0x0000010100101010, 0x0000010100101010, 
+            0x0000010100000001, 0x0000010100000001, 0x0000010100100001, 0x0000010100100001, 
+            0x0000010100001001, 0x0000010100001001, 0x0000010100101001, 0x0000010100101001, 
+            0x0000010100000011, 0x0000010100000011, 0x0000010100100011, 0x0000010100100011, 
+            0x0000010100001011, 0x0000010100001011, 0x0000010100101011, 0x0000010100101011, 
+            0x0001000000000000, 0x0001000000000000, 0x0001000000100000, 0x0001000000100000, 
+            0x0001000000001000, 0x0001000000001000, 0x0001000000101000, 0x0001000000101000, 
+            0x0001000000000010, 0x0001000000000010, 0x0001000000100010, 0x0001000000100010, 
+            0x0001000000001010, 0x0001000000001010, 0x0001000000101010, 0x0001000000101010, 
+            0x0001000000000001, 0x0001000000000001, 0x0001000000100001, 0x0001000000100001, 
+            0x0001000000001001, 0x0001000000001001, 0x0001000000101001, 0x0001000000101001, 
+            0x0001000000000011, 0x0001000000000011, 0x0001000000100011, 0x0001000000100011, 
+            0x0001000000001011, 0x0001000000001011, 0x0001000000101011, 0x0001000000101011, 
+            0x0001000100000000, 0x0001000100000000, 0x0001000100100000, 0x0001000100100000, 
+            0x0001000100001000, 0x0001000100001000, 0x0001000100101000, 0x0001000100101000, 
+            0x0001000100000010, 0x0001000100000010, 0x0001000100100010, 0x0001000100100010, 
+            0x0001000100001010, 0x0001000100001010, 0x0001000100101010, 0x0001000100101010, 
+            0x0001000100000001, 0x0001000100000001, 0x0001000100100001, 0x0001000100100001, 
+            0x0001000100001001, 0x0001000100001001, 0x0001000100101001, 0x0001000100101001, 
+            0x0001000100000011, 0x0001000100000011, 0x0001000100100011, 0x0001000100100011, 
+            0x0001000100001011, 0x0001000100001011, 0x0001000100101011, 0x0001000100101011, 
+            0x0001010000000000, 0x0001010000000000, 0x0001010000100000, 0x0001010000100000, 
+            0x0001010000001000, 0x0001010000001000, 0x0001010000101000, 0x0001010000101000, 
+            0x0001010000000010, 0x0001010000000010, 0x0001010000100010, 0x0001010000100010, 
+            0x0001010000001010, 0x0001010000001010, 0x0001010000101010, 0x0001010000101010, 
+            0x0001010000000001, 0x0001010000000001, 0x0001010000100001, 0x0001010000100001, 
+            0x0001010000001001, 0x0001010000001001, 0x0001010000101001, 0x0001010000101001, 
+            0x0001010000000011, 0x0001010000000011, 0x0001010000100011, 0x0001010000100011, 
+            0x0001010000001011, 0x0001010000001011, 0x0001010000101011, 0x0001010000101011, 
+            0x0001010100000000, 0x0001010100000000, 0x0001010100100000, 0x0001010100100000, 
+            0x0001010100001000, 0x0001010100001000, 0x0001010100101000, 0x0001010100101000, 
+            0x0001010100000010, 0x0001010100000010, 0x0001010100100010, 0x0001010100100010, 
+            0x0001010100001010, 0x0001010100001010, 0x0001010100101010, 0x0001010100101010, 
+            0x0001010100000001, 0x0001010100000001, 0x0001010100100001, 0x0001010100100001, 
+            0x0001010100001001, 0x0001010100001001, 0x0001010100101001, 0x0001010100101001, 
+            0x0001010100000011, 0x0001010100000011, 0x0001010100100011, 0x0001010100100011, 
+            0x0001010100001011, 0x0001010100001011, 0x0001010100101011, 0x0001010100101011
+        }
+    }
+};
+
+/**
+ * The permuted choice PC2, compiled by des_perm_compile(). 
+ */
+static const des_perm STD_PC2 = {
+    56, 48, 7, 7, 
+    //input bits of every PEXT/PDEP group
+    {
+        0x0000048110008013, 0x0000220a62080228, 0x008c4030040109c0, 0x0020110000801400, 
+        0x0011080000024000, 0x0002000000500000, 0x0040000009000000, 0x0000000000000000
+    }, 
+    //output bits of every PEXT/PDEP group
+    {
+        0x0000d10000c40100, 0x000020a888388040, 0x00000c5404035408, 0x0000020220002820, 
+        0x0000000142000210, 0x0000000010000084, 0x0000000001000003, 0x0000000000000000
+    }, 
+    {
+        //byte 0
+        {
+            0x0000000000000000, 0x0000000000000100, 0x0000000000040000, 0x0000000000040100, 
+            0x0000000000000000, 0x0000000000000100, 0x0000000000040000, 0x0000000000040100, 
+            0x0000000000000040, 0x0000000000000140, 0x0000000000040040, 0x0000000000040140, 
+            0x0000000000000040, 0x0000000000000140, 0x0000000000040040, 0x0000000000040140, 
+            0x0000000000400000, 0x0000000000400100, 0x0000000000440000, 0x0000000000440100, 
+            0x0000000000400000, 0x0000000000400100, 0x0000000000440000, 0x0000000000440100, 
+            0x0000000000400040, 0x0000000000400140, 0x0000000000440040, 0x0000000000440140, 
+            0x0000000000400040, 0x0000000000400140, 0x0000000000440040, 0x0000000000440140, 
+            0x0000000000008000, 0x0000000000008100, 0x0000000000048000, 0x0000000000048100, 
+            0x0000000000008000, 0x0000000000008100, 0x0000000000048000, 0x0000000000048100, 
+            0x0000000000008040, 0x0000000000008140, 0x0000000000048040, 0x0000000000048140, 
+            0x0000000000008040, 0x0000000000008140, 0x0000000000048040, 0x0000000000048140, 
+            0x0000000000408000, 0x0000000000408100, 0x0000000000448000, 0x0000000000448100, 
+            0x0000000000408000, 0x0000000000408100, 0x0000000000448000, 0x0000000000448100, 
+            0x0000000000408040, 0x0000000000408140, 0x0000000000448040, 0x0000000000448140, 
+            0x0000000000408040, 0x0000000000408140, 0x0000000000448040, 0x0000000000448140, 
+            0x0000000000000008, 0x0000000000000108, 0x0000000000040008, 0x0000000000040108, 
+            0x0000000000000008, 0x0000000000000108, 0x0000000000040008, 0x0000000000040108, 
+            0x0000000000000048, 0x0000000000000148, 0x0000000000040048, 0x0000000000040148, 
+            0x0000000000000048, 0x0000000000000148, 0x0000000000040048, 0x0000000000040148, 
+            0x0000000000400008, 0x0000000000400108, 0x0000000000440008, 0x0000000000440108, 
+            0x0000000000400008, 0x0000000000400108, 0x0000000000440008, 0x0000000000440108, 
+            0x0000000000400048, 0x0000000000400148, 0x0000000000440048, 0x0000000000440148, 
+            0x0000000000400048, 0x0000000000400148, 0x0000000000440048, 0x0000000000440148, 
+            0x0000000000008008, 0x0000000000008108, 0x0000000000048008, 0x0000000000048108, 
+            0x0000000000008008, 0x0000000000008108, 0x0000000000048008, 0x0000000000048108, 
+            0x0000000000008048, 0x0000000000008148, 0x0000000000048048, 0x0000000000048148, 
+            0x0000000000008048, 0x0000000000008148, 0x0000000000048048, 0x0000000000048148, 
+            0x0000000000408008, 0x0000000000408108, 0x0000000000448008, 0x0000000000448108, 
+            0x0000000000408008, 0x0000000000408108, 0x0000000000448008, 0x0000000000448108, 
+            0x0000000000408048, 0x0000000000408148, 0x0000000000448048, 0x0000000000448148, 
+            0x0000000000408048, 0x0000000000408148, 0x0000000000448048, 0x0000000000448148, 
+            0x0000000000000400, 0x0000000000000500, 0x0000000000040400, 0x0000000000040500, 
+            0x0000000000000400, 0x0000000000000500, 0x0000000000040400, 0x0000000000040500, 
+            0x0000000000000440, 0x0000000000000540, 0x0000000000040440, 0x0000000000040540, 
+            0x0000000000000440, 0x0000000000000540, 0x0000000000040440, 0x0000000000040540, 
+            0x0000000000400400, 0x0000000000400500, 0x0000000000440400, 0x0000000000440500, 
+            0x0000000000400400, 0x0000000000400500, 0x0000000000440400, 0x0000000000440500, 
+            0x0000000000400440, 0x0000000000400540, 0x0000000000440440, 0x0000000000440540, 
+            0x0000000000400440, 0x0000000000400540, 0x0000000000440440, 0x0000000000440540, 
+            0x0000000000008400, 0x0000000000008500, 0x0000000000048400, 0x0000000000048500, 
+            0x0000000000008400, 0x0000000000008500, 0x0000000000048400, 0x0000000000048500, 
+            0x0000000000008440, 0x0000000000008540, 0x0000000000048440, 0x0000000000048540, 
+            0x0000000000008440, 0x0000000000008540, 0x0000000000048440, 0x0000000000048540, 
+            0x0000000000408400, 0x0000000000408500, 0x0000000000448400, 0x0000000000448500, 
+            0x0000000000408400, 0x0000000000408500, 0x0000000000448400, 0x0000000000448500, 
+            0x0000000000408440, 0x0000000000408540, 0x0000000000448440, 0x0000000000448540, 
+            0x0000000000408440, 0x0000000000408540, 0x0000000000448440, 0x0000000000448540, 
+            0x0000000000000408, 0x0000000000000508, 0x0000000000040408, 0x0000000000040508, 
+            0x0000000000000408, 0x0000000000000508, 0x0000000000040408, 0x0000000000040508, 
+            0x0000000000000448, 0x0000000000000548, 0x0000000000040448, 0x0000000000040548, 
+            0x0000000000000448, 0x0000000000000548, 0x0000000000040448, 0x0000000000040548, 
+            0x0000000000400408, 0x0000000000400508, 0x0000000000440408, 0x0000000000440508, 
+            0x0000000000400408, 0x0000000000400508, 0x0000000000440408, 0x0000000000440508, 
+            0x0000000000400448, 0x0000000000400548, 0x0000000000440448, 0x0000000000440548, 
+            0x0000000000400448, 0x0000000000400548, 0x0000000000440448, 0x0000000000440548, 
+            0x0000000000008408, 0x0000000000008508, 0x0000000000048408, 0x0000000000048508, 
+            0x0000000000008408, 0x0000000000008508, 0x0000000000048408, 0x0000000000048508, 
+            0x0000000000008448, 0x0000000000008548, 0x0000000000048448, 0x0000000000048548, 
+            0x0000000000008448, 0x0000000000008548, 0x0000000000048448, 0x0000000000048548, 
+            0x0000000000408408, 0x0000000000408508, 0x0000000000448408, 0x0000000000448508, 
+            0x0000000000408408, 0x0000000000408508, 0x0000000000448408, 0x0000000000448508, 
+            0x0000000000408448, 0x0000000000408548, 0x0000000000448448, 0x0000000000448548, 
+            0x0000000000408448, 0x0000000000408548, 0x0000000000448448, 0x0000000000448548
+        }, 
+        //byte 1
+        {
+            0x0000000000000000, 0x0000000000001000, 0x0000000000080000, 0x0000000000081000, 
+            0x0000000000000020, 0x0000000000001020, 0x0000000000080020, 0x0000000000081020, 
+            0x0000000000004000, 0x0000000000005000, 0x0000000000084000, 0x0000000000085000, 
+            0x0000000000004020, 0x0000000000005020, 0x0000000000084020, 0x0000000000085020, 
+            0x0000000000000800, 0x0000000000001800, 0x0000000000080800, 0x0000000000081800, 
+            0x0000000000000820, 0x0000000000001820, 0x0000000000080820, 0x0000000000081820, 
+            0x0000000000004800, 0x0000000000005800, 0x0000000000084800, 0x0000000000085800, 
+            0x0000000000004820, 0x0000000000005820, 0x0000000000084820, 0x0000000000085820, 
+            0x0000000000000000, 0x0000000000001000, 0x0000000000080000, 0x0000000000081000, 
+            0x0000000000000020, 0x0000000000001020, 0x0000000000080020, 0x0000000000081020, 
+            0x0000000000004000, 0x0000000000005000, 0x0000000000084000, 0x0000000000085000, 
+            0x0000000000004020, 0x0000000000005020, 0x0000000000084020, 0x0000000000085020, 
+            0x0000000000000800, 0x0000000000001800, 0x0000000000080800, 0x0000000000081800, 
+            0x0000000000000820, 0x0000000000001820, 0x0000000000080820, 0x0000000000081820, 
+            0x0000000000004800, 0x0000000000005800, 0x0000000000084800, 0x0000000000085800, 
+            0x0000000000004820, 0x0000000000005820, 0x0000000000084820, 0x0000000000085820, 
+            0x0000000000000010, 0x0000000000001010, 0x0000000000080010, 0x0000000000081010, 
+            0x0000000000000030, 0x0000000000001030, 0x0000000000080030, 0x0000000000081030, 
+            0x0000000000004010, 0x0000000000005010, 0x0000000000084010, 0x0000000000085010, 
+            0x0000000000004030, 0x0000000000005030, 0x0000000000084030, 0x0000000000085030, 
+            0x0000000000000810, 0x0000000000001810, 0x0000000000080810, 0x0000000000081810, 
+            0x0000000000000830, 0x0000000000001830, 0x0000000000080830, 0x0000000000081830, 
+            0x0000000000004810, 0x0000000000005810, 0x0000000000084810, 0x0000000000085810, 
+            0x0000000000004830, 0x0000000000005830, 0x0000000000084830, 0x0000000000085830, 
+            0x0000000000000010, 0x0000000000001010, 0x0000000000080010, 0x0000000000081010, 
+            0x0000000000000030, 0x0000000000001030, 0x0000000000080030, 0x0000000000081030, 
+            0x0000000000004010, 0x0000000000005010, 0x0000000000084010, 0x0000000000085010, 
+            0x0000000000004030, 0x0000000000005030, 0x0000000000084030, 0x0000000000085030, 
+            0x0000000000000810, 0x0000000000001810, 0x0000000000080810, 0x0000000000081810, 
+            0x0000000000000830, 0x0000000000001830, 0x0000000000080830, 0x0000000000081830, 
+            0x0000000000004810, 0x0000000000005810, 0x0000000000084810, 0x0000000000085810, 
+            0x0000000000004830, 0x0000000000005830, 0x0000000000084830, 0x0000000000085830, 
+            0x0000000000800000, 0x0000000000801000, 0x0000000000880000, 0x0000000000881000, 
+            0x0000000000800020, 0x0000000000801020, 0x0000000000880020, 0x0000000000881020, 
+            0x0000000000804000, 0x0000000000805000, 0x0000000000884000, 0x0000000000885000, 
+            0x0000000000804020, 0x0000000000805020, 0x0000000000884020, 0x0000000000885020, 
+            0x0000000000800800, 0x0000000000801800, 0x0000000000880800, 0x0000000000881800, 
+            0x0000000000800820, 0x0000000000801820, 0x0000000000880820, 0x0000000000881820, 
+            0x0000000000804800, 0x0000000000805800, 0x0000000000884800, 0x0000000000885800, 
+            0x0000000000804820, 0x0000000000805820, 0x0000000000884820, 0x0000000000885820, 
+            0x0000000000800000, 0x0000000000801000, 0x0000000000880000, 0x0000000000881000, 
+            0x0000000000800020, 0x0000000000801020, 0x0000000000880020, 0x0000000000881020, 
+            0x0000000000804000, 0x0000000000805000, 0x0000000000884000, 0x0000000000885000, 
+            0x0000000000804020, 0x0000000000805020, 0x0000000000884020, 0x0000000000885020, 
+            0x0000000000800800, 0x0000000000801800, 0x0000000000880800, 0x0000000000881800, 
+            0x0000000000800820, 0x0000000000801820, 0x0000000000880820, 0x0000000000881820, 
+            0x0000000000804800, 0x0000000000805800, 0x0000000000884800, 0x0000000000885800, 
+            0x0000000000804820, 0x0000000000805820, 0x0000000000884820, 0x0000000000885820, 
+            0x0000000000800010, 0x0000000000801010, 0x0000000000880010, 0x0000000000881010, 
+            0x0000000000800030, 0x0000000000801030, 0x0000000000880030, 0x0000000000881030, 
+            0x0000000000804010, 0x0000000000805010, 0x0000000000884010, 0x0000000000885010, 
+            0x0000000000804030, 0x0000000000805030, 0x0000000000884030, 0x0000000000885030, 
+            0x0000000000800810, 0x0000000000801810, 0x0000000000880810, 0x0000000000881810, 
+            0x0000000000800830, 0x0000000000801830, 0x0000000000880830, 0x0000000000881830, 
+            0x0000000000804810, 0x0000000000805810, 0x0000000000884810, 0x0000000000885810, 
+            0x0000000000804830, 0x0000000000805830, 0x0000000000884830, 0x0000000000885830, 
+            0x0000000000800010, 0x0000000000801010, 0x0000000000880010, 0x0000000000881010, 
+            0x0000000000800030, 0x0000000000801030, 0x0000000000880030, 0x0000000000881030, 
+            0x0000000000804010, 0x0000000000805010, 0x0000000000884010, 0x0000000000885010, 
+            0x0000000000804030, 0x0000000000805030, 0x0000000000884030, 0x0000000000885030, 
+            0x0000000000800810, 0x0000000000801810, 0x0000000000880810, 0x0000000000881810, 
+            0x0000000000800830, 0x0000000000801830, 0x0000000000880830, 0x0000000000881830, 
+            0x0000000000804810, 0x0000000000805810, 0x0000000000884810, 0x0000000000885810, 
+            0x0000000000804830, 0x0000000000805830, 0x0000000000884830, 0x0000000000885830
+        }, 
+        //byte 2
+        {
+            0x0000000000000000, 0x0000000000010000, 0x0000000000000200, 0x0000000000010200, 
+            0x0000000000000000, 0x0000000000010000, 0x0000000000000200, 0x0000000000010200, 
+            0x0000000000100000, 0x0000000000110000, 0x0000000000100200, 0x0000000000110200, 
+            0x0000000000100000, 0x0000000000110000, 0x0000000000100200, 0x0000000000110200, 
+            0x0000000000000004, 0x0000000000010004, 0x0000000000000204, 0x0000000000010204, 
+            0x0000000000000004, 0x0000000000010004, 0x0000000000000204, 0x0000000000010204, 
+            0x0000000000100004, 0x0000000000110004, 0x0000000000100204, 0x0000000000110204, 
+            0x0000000000100004, 0x0000000000110004, 0x0000000000100204, 0x0000000000110204, 
+            0x0000000000000000, 0x0000000000010000, 0x0000000000000200, 0x0000000000010200, 
+            0x0000000000000000, 0x0000000000010000, 0x0000000000000200, 0x0000000000010200, 
+            0x0000000000100000, 0x0000000000110000, 0x0000000000100200, 0x0000000000110200, 
+            0x0000000000100000, 0x0000000000110000, 0x0000000000100200, 0x0000000000110200, 
+            0x0000000000000004, 0x0000000000010004, 0x0000000000000204, 0x0000000000010204, 
+            0x0000000000000004, 0x0000000000010004, 0x0000000000000204, 0x0000000000010204, 
+            0x0000000000100004, 0x0000000000110004, 0x0000000000100204, 0x0000000000110204, 
+            0x0000000000100004, 0x0000000000110004, 0x0000000000100204, 0x0000000000110204, 
+            0x0000000000000080, 0x0000000000010080, 0x0000000000000280, 0x0000000000010280, 
+            0x0000000000000080, 0x0000000000010080, 0x0000000000000280, 0x0000000000010280, 
+            0x0000000000100080, 0x0000000000110080, 0x0000000000100280, 0x0000000000110280, 
+            0x0000000000100080, 0x0000000000110080, 0x0000000000100280, 0x0000000000110280, 
+            0x0000000000000084, 0x0000000000010084, 0x0000000000000284, 0x0000000000010284, 
+            0x0000000000000084, 0x0000000000010084, 0x0000000000000284, 0x0000000000010284, 
+            0x0000000000100084, 0x0000000000110084, 0x0000000000100284, 0x0000000000110284, 
+            0x0000000000100084, 0x0000000000110084, 0x0000000000100284, 0x0000000000110284, 
+            0x0000000000000080, 0x0000000000010080, 0x0000000000000280, 0x0000000000010280, 
+            0x0000000000000080, 0x0000000000010080, 0x0000000000000280, 0x0000000000010280, 
+            0x0000000000100080, 0x0000000000110080, 0x0000000000100280, 0x0000000000110280, 
+            0x0000000000100080, 0x0000000000110080, 0x0000000000100280, 0x0000000000110280, 
+            0x0000000000000084, 0x0000000000010084, 0x0000000000000284, 0x0000000000010284, 
+            0x0000000000000084, 0x0000000000010084, 0x0000000000000284, 0x0000000000010284, 
+            0x0000000000100084, 0x0000000000110084, 0x0000000000100284, 0x0000000000110284, 
+            0x0000000000100084, 0x0000000000110084, 0x0000000000100284, 0x0000000000110284, 
+            0x0000000000002000, 0x0000000000012000, 0x0000000000002200, 0x0000000000012200, 
+            0x0000000000002000, 0x0000000000012000, 0x0000000000002200, 0x0000000000012200, 
+            0x0000000000102000, 0x0000000000112000, 0x0000000000102200, 0x0000000000112200, 
+            0x0000000000102000, 0x0000000000112000, 0x0000000000102200, 0x0000000000112200, 
+            0x0000000000002004, 0x0000000000012004, 0x0000000000002204, 0x0000000000012204, 
+            0x0000000000002004, 0x0000000000012004, 0x0000000000002204, 0x0000000000012204, 
+            0x0000000000102004, 0x0000000000112004, 0x0000000000102204, 0x0000000000112204, 
+            0x0000000000102004, 0x0000000000112004, 0x0000000000102204, 0x0000000000112204, 
+            0x0000000000002000, 0x0000000000012000, 0x0000000000002200, 0x0000000000012200, 
+            0x0000000000002000, 0x0000000000012000, 0x0000000000002200, 0x0000000000012200, 
+            0x0000000000102000, 0x0000000000112000, 0x0000000000102200, 0x0000000000112200, 
+            0x0000000000102000, 0x0000000000112000, 0x0000000000102200, 0x0000000000112200, 
+            0x0000000000002004, 0x0000000000012004, 0x0000000000002204, 0x0000000000012204, 
+            0x0000000000002004, 0x0000000000012004, 0x0000000000002204, 0x0000000000012204, 
+            0x0000000000102004, 0x0000000000112004, 0x0000000000102204, 0x0000000000112204, 
+            0x0000000000102004, 0x0000000000112004, 0x0000000000102204, 0x0000000000112204, 
+            0x0000000000002080, 0x0000000000012080, 0x0000000000002280, 0x0000000000012280, 
+            0x0000000000002080, 0x0000000000012080, 0x0000000000002280, 0x0000000000012280, 
+            0x0000000000102080, 0x0000000000112080, 0x0000000000102280, 0x0000000000112280, 
+            0x0000000000102080, 0x0000000000112080, 0x0000000000102280, 0x0000000000112280, 
+            0x0000000000002084, 0x0000000000012084, 0x0000000000002284, 0x0000000000012284, 
+            0x0000000000002084, 0x0000000000012084, 0x0000000000002284, 0x0000000000012284, 
+            0x0000000000102084, 0x0000000000112084, 0x0000000000102284, 0x0000000000112284, 
+            0x0000000000102084, 0x0000000000112084, 0x0000000000102284, 0x0000000000112284, 
+            0x0000000000002080, 0x0000000000012080, 0x0000000000002280, 0x0000000000012280, 
+            0x0000000000002080, 0x0000000000012080, 0x0000000000002280, 0x0000000000012280, 
+            0x0000000000102080, 0x0000000000112080, 0x0000000000102280, 0x0000000000112280, 
+            0x0000000000102080, 0x0000000000112080, 0x0000000000102280, 0x0000000000112280, 
+            0x0000000000002084, 0x0000000000012084, 0x0000000000002284, 0x0000000000012284, 
+            0x0000000000002084, 0x0000000000012084, 0x0000000000002284, 0x0000000000012284, 
+            0x0000000000102084, 0x0000000000112084, 0x0000000000102284, 0x0000000000112284, 
+            0x0000000000102084, 0x0000000000112084, 0x0000000000102284, 0x0000000000112284
+        }, 
+        //byte 3
+        {
+            0x0000000000000000, 0x0000000000000001, 0x0000000000200000, 0x0000000000200001, 
+            0x0000000000020000, 0x0000000000020001, 0x0000000000220000, 0x0000000000220001, 
+            0x0000000000000002, 0x0000000000000003, 0x0000000000200002, 0x0000000000200003, 
+            0x0000000000020002, 0x0000000000020003, 0x0000000000220002, 0x0000000000220003, 
+            0x0000010000000000, 0x0000010000000001, 0x0000010000200000, 0x0000010000200001, 
+            0x0000010000020000, 0x0000010000020001, 0x0000010000220000, 0x0000010000220001, 
+            0x0000010000000002, 0x0000010000000003, 0x0000010000200002, 0x0000010000200003, 
+            0x0000010000020002, 0x0000010000020003, 0x0000010000220002, 0x0000010000220003, 
+            0x0000000008000000, 0x0000000008000001, 0x0000000008200000, 0x0000000008200001, 
+            0x0000000008020000, 0x0000000008020001, 0x0000000008220000, 0x0000000008220001, 
+            0x0000000008000002, 0x0000000008000003, 0x0000000008200002, 0x0000000008200003, 
+            0x0000000008020002, 0x0000000008020003, 0x0000000008220002, 0x0000000008220003, 
+            0x0000010008000000, 0x0000010008000001, 0x0000010008200000, 0x0000010008200001, 
+            0x0000010008020000, 0x0000010008020001, 0x0000010008220000, 0x0000010008220001, 
+            0x0000010008000002, 0x0000010008000003, 0x0000010008200002, 0x0000010008200003, 
+            0x0000010008020002, 0x0000010008020003, 0x0000010008220002, 0x0000010008220003, 
+            0x0000000080000000, 0x0000000080000001, 0x0000000080200000, 0x0000000080200001, 
+            0x0000000080020000, 0x0000000080020001, 0x0000000080220000, 0x0000000080220001, 
+            0x0000000080000002, 0x0000000080000003, 0x0000000080200002, 0x0000000080200003, 
+            0x0000000080020002, 0x0000000080020003, 0x0000000080220002, 0x0000000080220003, 
+            0x0000010080000000, 0x0000010080000001, 0x0000010080200000, 0x0000010080200001, 
+            0x0000010080020000, 0x0000010080020001, 0x0000010080220000, 0x0000010080220001, 
+            0x0000010080000002, 0x0000010080000003, 0x0000010080200002, 0x0000010080200003, 
+            0x0000010080020002, 0x0000010080020003, 0x0000010080220002, 0x0000010080220003, 
+            0x0000000088000000, 0x0000000088000001, 0x0000000088200000, 0x0000000088200001, 
+            0x0000000088020000, 0x0000000088020001, 0x0000000088220000, 0x0000000088220001, 
+            0x0000000088000002, 0x0000000088000003, 0x0000000088200002, 0x0000000088200003, 
+            0x0000000088020002, 0x0000000088020003, 0x0000000088220002, 0x0000000088220003, 
+            0x0000010088000000, 0x0000010088000001, 0x0000010088200000, 0x0000010088200001, 
+            0x0000010088020000, 0x0000010088020001, 0x0000010088220000, 0x0000010088220001, 
+            0x0000010088000002, 0x0000010088000003, 0x0000010088200002, 0x0000010088200003, 
+            0x0000010088020002, 0x0000010088020003, 0x0000010088220002, 0x0000010088220003, 
+            0x0000000000000000, 0x0000000000000001, 0x0000000000200000, 0x0000000000200001, 
+            0x0000000000020000, 0x0000000000020001, 0x0000000000220000, 0x0000000000220001, 
+            0x0000000000000002, 0x0000000000000003, 0x0000000000200002, 0x0000000000200003, 
+            0x0000000000020002, 0x0000000000020003, 0x0000000000220002, 0x0000000000220003, 
+            0x0000010000000000, 0x0000010000000001, 0x0000010000200000, 0x0000010000200001, 
+            0x0000010000020000, 0x0000010000020001, 0x0000010000220000, 0x0000010000220001, 
+            0x0000010000000002, 0x0000010000000003, 0x0000010000200002, 0x0000010000200003, 
+            0x0000010000020002, 0x0000010000020003, 0x0000010000220002, 0x0000010000220003, 
+            0x0000000008000000, 0x0000000008000001, 0x0000000008200000, 0x0000000008200001, 
+            0x0000000008020000, 0x0000000008020001, 0x0000000008220000, 0x0000000008220001, 
+            0x0000000008000002, 0x0000000008000003, 0x0000000008200002, 0x0000000008200003, 
+            0x0000000008020002, 0x0000000008020003, 0x0000000008220002, 0x0000000008220003, 
+            0x0000010008000000, 0x0000010008000001, 0x0000010008200000, 0x0000010008200001, 
+            0x0000010008020000, 0x0000010008020001, 0x0000010008220000, 0x0000010008220001, 
+            0x0000010008000002, 0x0000010008000003, 0x0000010008200002, 0x0000010008200003, 
+            0x0000010008020002, 0x0000010008020003, 0x0000010008220002, 0x0000010008220003, 
+            0x0000000080000000, 0x0000000080000001, 0x0000000080200000, 0x0000000080200001, 
+            0x0000000080020000, 0x0000000080020001, 0x0000000080220000, 0x0000000080220001, 
+            0x0000000080000002, 0x0000000080000003, 0x0000000080200002, 0x0000000080200003, 
+            0x0000000080020002, 0x0000000080020003, 0x0000000080220002, 0x0000000080220003, 
+            0x0000010080000000, 0x0000010080000001, 0x0000010080200000, 0x0000010080200001, 
+            0x0000010080020000, 0x0000010080020001, 0x0000010080220000, 0x0000010080220001, 
+            0x0000010080000002, 0x0000010080000003, 0x0000010080200002, 0x0000010080200003, 
+            0x0000010080020002, 0x0000010080020003, 0x0000010080220002, 0x0000010080220003, 
+            0x0000000088000000, 0x0000000088000001, 0x0000000088200000, 0x0000000088200001, 
+            0x0000000088020000, 0x0000000088020001, 0x0000000088220000, 0x0000000088220001, 
+            0x0000000088000002, 0x0000000088000003, 0x0000000088200002, 0x0000000088200003, 
+            0x0000000088020002, 0x0000000088020003, 0x0000000088220002, 0x0000000088220003, 
+            0x0000010088000000, 0x0000010088000001, 0x0000010088200000, 0x0000010088200001, 
+            0x0000010088020000, 0x0000010088020001, 0x0000010088220000, 0x0000010088220001, 
+            0x0000010088000002, 0x0000010088000003, 0x0000010088200002, 0x0000010088200003, 
+            0x0000010088020002, 0x0000010088020003, 0x0000010088220002, 0x0000010088220003
+        }, 
+        //byte 4
+        {
+            0x0000000000000000, 0x0000100000000000, 0x0000000800000000, 0x0000100800000000, 
+            0x0000000000000000, 0x0000100000000000, 0x0000000800000000, 0x0000100800000000, 
+            0x0000002000000000, 0x0000102000000000, 0x0000002800000000, 0x0000102800000000, 
+            0x0000002000000000, 0x0000102000000000, 0x0000002800000000, 0x0000102800000000, 
+            0x0000000004000000, 0x0000100004000000, 0x0000000804000000, 0x0000100804000000, 
+            0x0000000004000000, 0x0000100004000000, 0x0000000804000000, 0x0000100804000000, 
+            0x0000002004000000, 0x0000102004000000, 0x0000002804000000, 0x0000102804000000, 
+            0x0000002004000000, 0x0000102004000000, 0x0000002804000000, 0x0000102804000000, 
+            0x0000000400000000, 0x0000100400000000, 0x0000000c00000000, 0x0000100c00000000, 
+            0x0000000400000000, 0x0000100400000000, 0x0000000c00000000, 0x0000100c00000000, 
+            0x0000002400000000, 0x0000102400000000, 0x0000002c00000000, 0x0000102c00000000, 
+            0x0000002400000000, 0x0000102400000000, 0x0000002c00000000, 0x0000102c00000000, 
+            0x0000000404000000, 0x0000100404000000, 0x0000000c04000000, 0x0000100c04000000, 
+            0x0000000404000000, 0x0000100404000000, 0x0000000c04000000, 0x0000100c04000000, 
+            0x0000002404000000, 0x0000102404000000, 0x0000002c04000000, 0x0000102c04000000, 
+            0x0000002404000000, 0x0000102404000000, 0x0000002c04000000, 0x0000102c04000000, 
+            0x0000000000000000, 0x0000100000000000, 0x0000000800000000, 0x0000100800000000, 
+            0x0000000000000000, 0x0000100000000000, 0x0000000800000000, 0x0000100800000000, 
+            0x0000002000000000, 0x0000102000000000, 0x0000002800000000, 0x0000102800000000, 
+            0x0000002000000000, 0x0000102000000000, 0x0000002800000000, 0x0000102800000000, 
+            0x0000000004000000, 0x0000100004000000, 0x0000000804000000, 0x0000100804000000, 
+            0x0000000004000000, 0x0000100004000000, 0x0000000804000000, 0x0000100804000000, 
+            0x0000002004000000, 0x0000102004000000, 0x0000002804000000, 0x0000102804000000, 
+            0x0000002004000000, 0x0000102004000000, 0x0000002804000000, 0x0000102804000000, 
+            0x0000000400000000, 0x0000100400000000, 0x0000000c00000000, 0x0000100c00000000, 
+            0x0000000400000000, 0x0000100400000000, 0x0000000c00000000, 0x0000100c00000000, 
+            0x0000002400000000, 0x0000102400000000, 0x0000002c00000000, 0x0000102c00000000, 
+            0x0000002400000000, 0x0000102400000000, 0x0000002c00000000, 0x0000102c00000000, 
+            0x0000000404000000, 0x0000100404000000, 0x0000000c04000000, 0x0000100c04000000, 
+            0x0000000404000000, 0x0000100404000000, 0x0000000c04000000, 0x0000100c04000000, 
+            0x0000002404000000, 0x0000102404000000, 0x0000002c04000000, 0x0000102c04000000, 
+            0x0000002404000000, 0x0000102404000000, 0x0000002c04000000, 0x0000102c04000000, 
+            0x0000400000000000, 0x0000500000000000, 0x0000400800000000, 0x0000500800000000, 
+            0x0000400000000000, 0x0000500000000000, 0x0000400800000000, 0x0000500800000000, 
+            0x0000402000000000, 0x0000502000000000, 0x0000402800000000, 0x0000502800000000, 
+            0x0000402000000000, 0x0000502000000000, 0x0000402800000000, 0x0000502800000000, 
+            0x0000400004000000, 0x0000500004000000, 0x0000400804000000, 0x0000500804000000, 
+            0x0000400004000000, 0x0000500004000000, 0x0000400804000000, 0x0000500804000000, 
+            0x0000402004000000, 0x0000502004000000, 0x0000402804000000, 0x0000502804000000, 
+            0x0000402004000000, 0x0000502004000000, 0x0000402804000000, 0x0000502804000000, 
+            0x0000400400000000, 0x0000500400000000, 0x0000400c00000000, 0x0000500c00000000, 
+            0x0000400400000000, 0x0000500400000000, 0x0000400c00000000, 0x0000500c00000000, 
+            0x0000402400000000, 0x0000502400000000, 0x0000402c00000000, 0x0000502c00000000, 
+            0x0000402400000000, 0x0000502400000000, 0x0000402c00000000, 0x0000502c00000000, 
+            0x0000400404000000, 0x0000500404000000, 0x0000400c04000000, 0x0000500c04000000, 
+            0x0000400404000000, 0x0000500404000000, 0x0000400c04000000, 0x0000500c04000000, 
+            0x0000402404000000, 0x0000502404000000, 0x0000402c04000000, 0x0000502c04000000, 
+            0x0000402404000000, 0x0000502404000000, 0x0000402c04000000, 0x0000502c04000000, 
+            0x0000400000000000, 0x0000500000000000, 0x0000400800000000, 0x0000500800000000, 
+            0x0000400000000000, 0x0000500000000000, 0x0000400800000000, 0x0000500800000000, 
+            0x0000402000000000, 0x0000502000000000, 0x0000402800000000, 0x0000502800000000, 
+            0x0000402000000000, 0x0000502000000000, 0x0000402800000000, 0x0000502800000000, 
+            0x0000400004000000, 0x0000500004000000, 0x0000400804000000, 0x0000500804000000, 
+            0x0000400004000000, 0x0000500004000000, 0x0000400804000000, 0x0000500804000000, 
+            0x0000402004000000, 0x0000502004000000, 0x0000402804000000, 0x0000502804000000, 
+            0x0000402004000000, 0x0000502004000000, 0x0000402804000000, 0x0000502804000000, 
+            0x0000400400000000, 0x0000500400000000, 0x0000400c00000000, 0x0000500c00000000, 
+            0x0000400400000000, 0x0000500400000000, 0x0000400c00000000, 0x0000500c00000000, 
+            0x0000402400000000, 0x0000502400000000, 0x0000402c00000000, 0x0000502c00000000, 
+            0x0000402400000000, 0x0000502400000000, 0x0000402c00000000, 0x0000502c00000000, 
+            0x0000400404000000, 0x0000500404000000, 0x0000400c04000000, 0x0000500c04000000, 
+            0x0000400404000000, 0x0000500404000000, 0x0000400c04000000, 0x0000500c04000000, 
+            0x0000402404000000, 0x0000502404000000, 0x0000402c04000000, 0x0000502c04000000, 
+            0x0000402404000000, 0x0000502404000000, 0x0000402c04000000, 0x0000502c04000000
+        }, 
+        //byte 5
+        {
+            0x0000000000000000, 0x0000000020000000, 0x0000008000000000, 0x0000008020000000, 
+            0x0000800000000000, 0x0000800020000000, 0x0000808000000000, 0x0000808020000000, 
+            0x0000000002000000, 0x0000000022000000, 0x0000008002000000, 0x0000008022000000, 
+            0x0000800002000000, 0x0000800022000000, 0x0000808002000000, 0x0000808022000000, 
+            0x0000000200000000, 0x0000000220000000, 0x0000008200000000, 0x0000008220000000, 
+            0x0000800200000000, 0x0000800220000000, 0x0000808200000000, 0x0000808220000000, 
+            0x0000000202000000, 0x0000000222000000, 0x0000008202000000, 0x0000008222000000, 
+            0x0000800202000000, 0x0000800222000000, 0x0000808202000000, 0x0000808222000000, 
+            0x0000200000000000, 0x0000200020000000, 0x0000208000000000, 0x0000208020000000, 
+            0x0000a00000000000, 0x0000a00020000000, 0x0000a08000000000, 0x0000a08020000000, 
+            0x0000200002000000, 0x0000200022000000, 0x0000208002000000, 0x0000208022000000, 
+            0x0000a00002000000, 0x0000a00022000000, 0x0000a08002000000, 0x0000a08022000000, 
+            0x0000200200000000, 0x0000200220000000, 0x0000208200000000, 0x0000208220000000, 
+            0x0000a00200000000, 0x0000a00220000000, 0x0000a08200000000, 0x0000a08220000000, 
+            0x0000200202000000, 0x0000200222000000, 0x0000208202000000, 0x0000208222000000, 
+            0x0000a00202000000, 0x0000a00222000000, 0x0000a08202000000, 0x0000a08222000000, 
+            0x0000001000000000, 0x0000001020000000, 0x0000009000000000, 0x0000009020000000, 
+            0x0000801000000000, 0x0000801020000000, 0x0000809000000000, 0x0000809020000000, 
+            0x0000001002000000, 0x0000001022000000, 0x0000009002000000, 0x0000009022000000, 
+            0x0000801002000000, 0x0000801022000000, 0x0000809002000000, 0x0000809022000000, 
+            0x0000001200000000, 0x0000001220000000, 0x0000009200000000, 0x0000009220000000, 
+            0x0000801200000000, 0x0000801220000000, 0x0000809200000000, 0x0000809220000000, 
+            0x0000001202000000, 0x0000001222000000, 0x0000009202000000, 0x0000009222000000, 
+            0x0000801202000000, 0x0000801222000000, 0x0000809202000000, 0x0000809222000000, 
+            0x0000201000000000, 0x0000201020000000, 0x0000209000000000, 0x0000209020000000, 
+            0x0000a01000000000, 0x0000a01020000000, 0x0000a09000000000, 0x0000a09020000000, 
+            0x0000201002000000, 0x0000201022000000, 0x0000209002000000, 0x0000209022000000, 
+            0x0000a01002000000, 0x0000a01022000000, 0x0000a09002000000, 0x0000a09022000000, 
+            0x0000201200000000, 0x0000201220000000, 0x0000209200000000, 0x0000209220000000, 
+            0x0000a01200000000, 0x0000a01220000000, 0x0000a09200000000, 0x0000a09220000000, 
+            0x0000201202000000, 0x0000201222000000, 0x0000209202000000, 0x0000209222000000, 
+            0x0000a01202000000, 0x0000a01222000000, 0x0000a09202000000, 0x0000a09222000000, 
+            0x0000000000000000, 0x0000000020000000, 0x0000008000000000, 0x0000008020000000, 
+            0x0000800000000000, 0x0000800020000000, 0x0000808000000000, 0x0000808020000000, 
+            0x0000000002000000, 0x0000000022000000, 0x0000008002000000, 0x0000008022000000, 
+            0x0000800002000000, 0x0000800022000000, 0x0000808002000000, 0x0000808022000000, 
+            0x0000000200000000, 0x0000000220000000, 0x0000008200000000, 0x0000008220000000, 
+            0x0000800200000000, 0x0000800220000000, 0x0000808200000000, 0x0000808220000000, 
+            0x0000000202000000, 0x0000000222000000, 0x0000008202000000, 0x0000008222000000, 
+            0x0000800202000000, 0x0000800222000000, 0x0000808202000000, 0x0000808222000000, 
+            0x0000200000000000, 0x0000200020000000, 0x0000208000000000, 0x0000208020000000, 
+            0x0000a00000000000, 0x0000a00020000000, 0x0000a08000000000, 0x0000a08020000000, 
+            0x0000200002000000, 0x0000200022000000, 0x0000208002000000, 0x0000208022000000, 
+            0x0000a00002000000, 0x0000a00022000000, 0x0000a08002000000, 0x0000a08022000000, 
+            0x0000200200000000, 0x0000200220000000, 0x0000208200000000, 0x0000208220000000, 
+            0x0000a00200000000, 0x0000a00220000000, 0x0000a08200000000, 0x0000a08220000000, 
+            0x0000200202000000, 0x0000200222000000, 0x0000208202000000, 0x0000208222000000, 
+            0x0000a00202000000, 0x0000a00222000000, 0x0000a08202000000, 0x0000a08222000000, 
+            0x0000001000000000, 0x0000001020000000, 0x0000009000000000, 0x0000009020000000, 
+            0x0000801000000000, 0x0000801020000000, 0x0000809000000000, 0x0000809020000000, 
+            0x0000001002000000, 0x0000001022000000, 0x0000009002000000, 0x0000009022000000, 
+            0x0000801002000000, 0x0000801022000000, 0x0000809002000000, 0x0000809022000000, 
+            0x0000001200000000, 0x0000001220000000, 0x0000009200000000, 0x0000009220000000, 
+            0x0000801200000000, 0x0000801220000000, 0x0000809200000000, 0x0000809220000000, 
+            0x0000001202000000, 0x0000001222000000, 0x0000009202000000, 0x0000009222000000, 
+            0x0000801202000000, 0x0000801222000000, 0x0000809202000000, 0x0000809222000000, 
+            0x0000201000000000, 0x0000201020000000, 0x0000209000000000, 0x0000209020000000, 
+            0x0000a01000000000, 0x0000a01020000000, 0x0000a09000000000, 0x0000a09020000000, 
+            0x0000201002000000, 0x0000201022000000, 0x0000209002000000, 0x0000209022000000, 
+            0x0000a01002000000, 0x0000a01022000000, 0x0000a09002000000, 0x0000a09022000000, 
+            0x0000201200000000, 0x0000201220000000, 0x0000209200000000, 0x0000209220000000, 
+            0x0000a01200000000, 0x0000a01220000000, 0x0000a09200000000, 0x0000a09220000000, 
+            0x0000201202000000, 0x0000201222000000, 0x0000209202000000, 0x0000209222000000, 
+            0x0000a01202000000, 0x0000a01222000000, 0x0000a09202000000, 0x0000a09222000000
+        }, 
+        //byte 6
+        {
+            0x0000000000000000, 0x0000000040000000, 0x0000000010000000, 0x0000000050000000, 
+            0x0000004000000000, 0x0000004040000000, 0x0000004010000000, 0x0000004050000000, 
+            0x0000040000000000, 0x0000040040000000, 0x0000040010000000, 0x0000040050000000, 
+            0x0000044000000000, 0x0000044040000000, 0x0000044010000000, 0x0000044050000000, 
+            0x0000000100000000, 0x0000000140000000, 0x0000000110000000, 0x0000000150000000, 
+            0x0000004100000000, 0x0000004140000000, 0x0000004110000000, 0x0000004150000000, 
+            0x0000040100000000, 0x0000040140000000, 0x0000040110000000, 0x0000040150000000, 
+            0x0000044100000000, 0x0000044140000000, 0x0000044110000000, 0x0000044150000000, 
+            0x0000020000000000, 0x0000020040000000, 0x0000020010000000, 0x0000020050000000, 
+            0x0000024000000000, 0x0000024040000000, 0x0000024010000000, 0x0000024050000000, 
+            0x0000060000000000, 0x0000060040000000, 0x0000060010000000, 0x0000060050000000, 
+            0x0000064000000000, 0x0000064040000000, 0x0000064010000000, 0x0000064050000000, 
+            0x0000020100000000, 0x0000020140000000, 0x0000020110000000, 0x0000020150000000, 
+            0x0000024100000000, 0x0000024140000000, 0x0000024110000000, 0x0000024150000000, 
+            0x0000060100000000, 0x0000060140000000, 0x0000060110000000, 0x0000060150000000, 
+            0x0000064100000000, 0x0000064140000000, 0x0000064110000000, 0x0000064150000000, 
+            0x0000000001000000, 0x0000000041000000, 0x0000000011000000, 0x0000000051000000, 
+            0x0000004001000000, 0x0000004041000000, 0x0000004011000000, 0x0000004051000000, 
+            0x0000040001000000, 0x0000040041000000, 0x0000040011000000, 0x0000040051000000, 
+            0x0000044001000000, 0x0000044041000000, 0x0000044011000000, 0x0000044051000000, 
+            0x0000000101000000, 0x0000000141000000, 0x0000000111000000, 0x0000000151000000, 
+            0x0000004101000000, 0x0000004141000000, 0x0000004111000000, 0x0000004151000000, 
+            0x0000040101000000, 0x0000040141000000, 0x0000040111000000, 0x0000040151000000, 
+            0x0000044101000000, 0x0000044141000000, 0x0000044111000000, 0x0000044151000000, 
+            0x0000020001000000, 0x0000020041000000, 0x0000020011000000, 0x0000020051000000, 
+            0x0000024001000000, 0x0000024041000000, 0x0000024011000000, 0x0000024051000000, 
+            0x0000060001000000, 0x0000060041000000, 0x0000060011000000, 0x0000060051000000, 
+            0x0000064001000000, 0x0000064041000000, 0x0000064011000000, 0x0000064051000000, 
+            0x0000020101000000, 0x0000020141000000, 0x0000020111000000, 0x0000020151000000, 
+            0x0000024101000000, 0x0000024141000000, 0x0000024111000000, 0x0000024151000000, 
+            0x0000060101000000, 0x0000060141000000, 0x0000060111000000, 0x0000060151000000, 
+            0x0000064101000000, 0x0000064141000000, 0x0000064111000000, 0x0000064151000000, 
+            0x0000080000000000, 0x0000080040000000, 0x0000080010000000, 0x0000080050000000, 
+            0x0000084000000000, 0x0000084040000000, 0x0000084010000000, 0x0000084050000000, 
+            0x00000c0000000000, 0x00000c0040000000, 0x00000c0010000000, 0x00000c0050000000, 
+            0x00000c4000000000, 0x00000c4040000000, 0x00000c4010000000, 0x00000c4050000000, 
+            0x0000080100000000, 0x0000080140000000, 0x0000080110000000, 0x0000080150000000, 
+            0x0000084100000000, 0x0000084140000000, 0x0000084110000000, 0x0000084150000000, 
+            0x00000c0100000000, 0x00000c0140000000, 0x00000c0110000000, 0x00000c0150000000, 
+            0x00000c4100000000, 0x00000c4140000000, 0x00000c4110000000, 0x00000c4150000000, 
+            0x00000a0000000000, 0x00000a0040000000, 0x00000a0010000000, 0x00000a0050000000, 
+            0x00000a4000000000, 0x00000a4040000000, 0x00000a4010000000, 0x00000a4050000000, 
+            0x00000e0000000000, 0x00000e0040000000, 0x00000e0010000000, 0x00000e0050000000, 
+            0x00000e4000000000, 0x00000e4040000000, 0x00000e4010000000, 0x00000e4050000000, 
+            0x00000a0100000000, 0x00000a0140000000, 0x00000a0110000000, 0x00000a0150000000, 
+            0x00000a4100000000, 0x00000a4140000000, 0x00000a4110000000, 0x00000a4150000000, 
+            0x00000e0100000000, 0x00000e0140000000, 0x00000e0110000000, 0x00000e0150000000, 
+            0x00000e4100000000, 0x00000e4140000000, 0x00000e4110000000, 0x00000e4150000000, 
+            0x0000080001000000, 0x0000080041000000, 0x0000080011000000, 0x0000080051000000, 
+            0x0000084001000000, 0x0000084041000000, 0x0000084011000000, 0x0000084051000000, 
+            0x00000c0001000000, 0x00000c0041000000, 0x00000c0011000000, 0x00000c0051000000, 
+            0x00000c4001000000, 0x00000c4041000000, 0x00000c4011000000, 0x00000c4051000000, 
+            0x0000080101000000, 0x0000080141000000, 0x0000080111000000, 0x0000080151000000, 
+            0x0000084101000000, 0x0000084141000000, 0x0000084111000000, 0x0000084151000000, 
+            0x00000c0101000000, 0x00000c0141000000, 0x00000c0111000000, 0x00000c0151000000, 
+            0x00000c4101000000, 0x00000c4141000000, 0x00000c4111000000, 0x00000c4151000000, 
+            0x00000a0001000000, 0x00000a0041000000, 0x00000a0011000000, 0x00000a0051000000, 
+            0x00000a4001000000, 0x00000a4041000000, 0x00000a4011000000, 0x00000a4051000000, 
+            0x00000e0001000000, 0x00000e0041000000, 0x00000e0011000000, 0x00000e0051000000, 
+            0x00000e4001000000, 0x00000e4041000000, 0x00000e4011000000, 0x00000e4051000000, 
+            0x00000a0101000000, 0x00000a0141000000, 0x00000a0111000000, 0x00000a0151000000, 
+            0x00000a4101000000, 0x00000a4141000000, 0x00000a4111000000, 0x00000a4151000000, 
+            0x00000e0101000000, 0x00000e0141000000, 0x00000e0111000000, 0x00000e0151000000, 
+            0x00000e4101000000, 0x00000e4141000000, 0x00000e4111000000, 0x00000e4151000000
+        }
+    }
+};
+
+#endif
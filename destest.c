@@ -0,0 +1,1337 @@
+/**
+ * FILE:   destest.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Known answer and differential tests of every DES backend. 
+ *
+ *     destest [-b backend] [-n pairs] [-t threads] [-s seed] 
+ *
+ * The known answer tests are the DES vectors of NIST SP 800-17: variable 
+ * plain text, variable key, permutation operation and substitution table. 
+ * The differential tests encrypt and decrypt random key and block pairs 
+ * with des_enc() and des_dec() as the reference, and check that every 
+ * other backend gives the same result, on the given number of threads, 
+ * one for every CPU by default. The modes of operation are checked against 
+ * chaining built on the reference, file and pipe jobs on the job queue 
+ * have to match the modes on whole messages, and the key search has to 
+ * find keys planted near random key indexes. With DES_STATS the counters 
+ * have to count known calls. The packed bit vectors have to match the bit 
+ * strings they pack. A million pairs are tested by default. 
+ * The known answer, mode and key search tests run on every CPU backend 
+ * the machine supports, the differential tests on the given backend, the 
+ * one picked by descpu.h by default. 
+ *
+ * C99, POSIX threads
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "des.h"
+#include "deskcache.h"
+#include "desbs.h"
+#include "desmode.h"
+#include "despar.h"
+#include "desjob.h"
+#include "dessearch.h"
+#include "descpu.h"
+#include "desstats.h"
+#include "desinline.h"
+#include "bitvec.h"
+
+#define BATCH 1024              //the most blocks per differential batch
+
+/**
+ * A known answer vector. 
+ */
+typedef struct Vector {
+    uint64_t key;               //the 64-bit key
+    uint64_t pt;                //the plain text block
+    uint64_t ct;                //the cipher text block
+} Vector;
+
+/**
+ * A backend function, encrypting or decrypting blocks under one key. 
+ */
+typedef void (*BackendFunc)(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+
+/**
+ * A named backend. 
+ */
+typedef struct Backend {
+    const char *name;           //name of the backend
+    BackendFunc func;           //the backend function
+} Backend;
+
+/**
+ * The state of a differential test thread. 
+ */
+typedef struct Tester {
+    pthread_t thread;           //the thread
+    uint64_t seed;              //seed of the random numbers
+} Tester;
+
+/**
+ * The variable plain text known answer test of SP 800-17 (64). 
+ */
+static const Vector VAR_TEXT[] = {
+    { 0x0101010101010101ULL, 0x8000000000000000ULL, 0x95f8a5e5dd31d900ULL },
+    { 0x0101010101010101ULL, 0x4000000000000000ULL, 0xdd7f121ca5015619ULL },
+    { 0x0101010101010101ULL, 0x2000000000000000ULL, 0x2e8653104f3834eaULL },
+    { 0x0101010101010101ULL, 0x1000000000000000ULL, 0x4bd388ff6cd81d4fULL },
+    { 0x0101010101010101ULL, 0x0800000000000000ULL, 0x20b9e767b2fb1456ULL },
+    { 0x0101010101010101ULL, 0x0400000000000000ULL, 0x55579380d77138efULL },
+    { 0x0101010101010101ULL, 0x0200000000000000ULL, 0x6cc5defaaf04512fULL },
+    { 0x0101010101010101ULL, 0x0100000000000000ULL, 0x0d9f279ba5d87260ULL },
+    { 0x0101010101010101ULL, 0x0080000000000000ULL, 0xd9031b0271bd5a0aULL },
+    { 0x0101010101010101ULL, 0x0040000000000000ULL, 0x424250b37c3dd951ULL },
+    { 0x0101010101010101ULL, 0x0020000000000000ULL, 0xb8061b7ecd9a21e5ULL },
+    { 0x0101010101010101ULL, 0x0010000000000000ULL, 0xf15d0f286b65bd28ULL },
+    { 0x0101010101010101ULL, 0x0008000000000000ULL, 0xadd0cc8d6e5deba1ULL },
+    { 0x0101010101010101ULL, 0x0004000000000000ULL, 0xe6d5f82752ad63d1ULL },
+    { 0x0101010101010101ULL, 0x0002000000000000ULL, 0xecbfe3bd3f591a5eULL },
+    { 0x0101010101010101ULL, 0x0001000000000000ULL, 0xf356834379d165cdULL },
+    { 0x0101010101010101ULL, 0x0000800000000000ULL, 0x2b9f982f20037fa9ULL },
+    { 0x0101010101010101ULL, 0x0000400000000000ULL, 0x889de068a16f0be6ULL },
+    { 0x0101010101010101ULL, 0x0000200000000000ULL, 0xe19e275d846a1298ULL },
+    { 0x0101010101010101ULL, 0x0000100000000000ULL, 0x329a8ed523d71aecULL },
+    { 0x0101010101010101ULL, 0x0000080000000000ULL, 0xe7fce22557d23c97ULL },
+    { 0x0101010101010101ULL, 0x0000040000000000ULL, 0x12a9f5817ff2d65dULL },
+    { 0x0101010101010101ULL, 0x0000020000000000ULL, 0xa484c3ad38dc9c19ULL },
+    { 0x0101010101010101ULL, 0x0000010000000000ULL, 0xfbe00a8a1ef8ad72ULL },
+    { 0x0101010101010101ULL, 0x0000008000000000ULL, 0x750d079407521363ULL },
+    { 0x0101010101010101ULL, 0x0000004000000000ULL, 0x64feed9c724c2fafULL },
+    { 0x0101010101010101ULL, 0x0000002000000000ULL, 0xf02b263b328e2b60ULL },
+    { 0x0101010101010101ULL, 0x0000001000000000ULL, 0x9d64555a9a10b852ULL },
+    { 0x0101010101010101ULL, 0x0000000800000000ULL, 0xd106ff0bed5255d7ULL },
+    { 0x0101010101010101ULL, 0x0000000400000000ULL, 0xe1652c6b138c64a5ULL },
+    { 0x0101010101010101ULL, 0x0000000200000000ULL, 0xe428581186ec8f46ULL },
+    { 0x0101010101010101ULL, 0x0000000100000000ULL, 0xaeb5f5ede22d1a36ULL },
+    { 0x0101010101010101ULL, 0x0000000080000000ULL, 0xe943d7568aec0c5cULL },
+    { 0x0101010101010101ULL, 0x0000000040000000ULL, 0xdf98c8276f54b04bULL },
+    { 0x0101010101010101ULL, 0x0000000020000000ULL, 0xb160e4680f6c696fULL },
+    { 0x0101010101010101ULL, 0x0000000010000000ULL, 0xfa0752b07d9c4ab8ULL },
+    { 0x0101010101010101ULL, 0x0000000008000000ULL, 0xca3a2b036dbc8502ULL },
+    { 0x0101010101010101ULL, 0x0000000004000000ULL, 0x5e0905517bb59bcfULL },
+    { 0x0101010101010101ULL, 0x0000000002000000ULL, 0x814eeb3b91d90726ULL },
+    { 0x0101010101010101ULL, 0x0000000001000000ULL, 0x4d49db1532919c9fULL },
+    { 0x0101010101010101ULL, 0x0000000000800000ULL, 0x25eb5fc3f8cf0621ULL },
+    { 0x0101010101010101ULL, 0x0000000000400000ULL, 0xab6a20c0620d1c6fULL },
+    { 0x0101010101010101ULL, 0x0000000000200000ULL, 0x79e90dbc98f92ccaULL },
+    { 0x0101010101010101ULL, 0x0000000000100000ULL, 0x866ecedd8072bb0eULL },
+    { 0x0101010101010101ULL, 0x0000000000080000ULL, 0x8b54536f2f3e64a8ULL },
+    { 0x0101010101010101ULL, 0x0000000000040000ULL, 0xea51d3975595b86bULL },
+    { 0x0101010101010101ULL, 0x0000000000020000ULL, 0xcaffc6ac4542de31ULL },
+    { 0x0101010101010101ULL, 0x0000000000010000ULL, 0x8dd45a2ddf90796cULL },
+    { 0x0101010101010101ULL, 0x0000000000008000ULL, 0x1029d55e880ec2d0ULL },
+    { 0x0101010101010101ULL, 0x0000000000004000ULL, 0x5d86cb23639dbea9ULL },
+    { 0x0101010101010101ULL, 0x0000000000002000ULL, 0x1d1ca853ae7c0c5fULL },
+    { 0x0101010101010101ULL, 0x0000000000001000ULL, 0xce332329248f3228ULL },
+    { 0x0101010101010101ULL, 0x0000000000000800ULL, 0x8405d1abe24fb942ULL },
+    { 0x0101010101010101ULL, 0x0000000000000400ULL, 0xe643d78090ca4207ULL },
+    { 0x0101010101010101ULL, 0x0000000000000200ULL, 0x48221b9937748a23ULL },
+    { 0x0101010101010101ULL, 0x0000000000000100ULL, 0xdd7c0bbd61fafd54ULL },
+    { 0x0101010101010101ULL, 0x0000000000000080ULL, 0x2fbc291a570db5c4ULL },
+    { 0x0101010101010101ULL, 0x0000000000000040ULL, 0xe07c30d7e4e26e12ULL },
+    { 0x0101010101010101ULL, 0x0000000000000020ULL, 0x0953e2258e8e90a1ULL },
+    { 0x0101010101010101ULL, 0x0000000000000010ULL, 0x5b711bc4ceebf2eeULL },
+    { 0x0101010101010101ULL, 0x0000000000000008ULL, 0xcc083f1e6d9e85f6ULL },
+    { 0x0101010101010101ULL, 0x0000000000000004ULL, 0xd2fd8867d50d2dfeULL },
+    { 0x0101010101010101ULL, 0x0000000000000002ULL, 0x06e7ea22ce92708fULL },
+    { 0x0101010101010101ULL, 0x0000000000000001ULL, 0x166b40b44aba4bd6ULL }
+};
+
+/**
+ * The variable key known answer test of SP 800-17 (56). 
+ */
+static const Vector VAR_KEY[] = {
+    { 0x8101010101010101ULL, 0x0000000000000000ULL, 0x95a8d72813daa94dULL },
+    { 0x4101010101010101ULL, 0x0000000000000000ULL, 0x0eec1487dd8c26d5ULL },
+    { 0x2101010101010101ULL, 0x0000000000000000ULL, 0x7ad16ffb79c45926ULL },
+    { 0x1101010101010101ULL, 0x0000000000000000ULL, 0xd3746294ca6a6cf3ULL },
+    { 0x0901010101010101ULL, 0x0000000000000000ULL, 0x809f5f873c1fd761ULL },
+    { 0x0501010101010101ULL, 0x0000000000000000ULL, 0xc02faffec989d1fcULL },
+    { 0x0301010101010101ULL, 0x0000000000000000ULL, 0x4615aa1d33e72f10ULL },
+    { 0x0181010101010101ULL, 0x0000000000000000ULL, 0x2055123350c00858ULL },
+    { 0x0141010101010101ULL, 0x0000000000000000ULL, 0xdf3b99d6577397c8ULL },
+    { 0x0121010101010101ULL, 0x0000000000000000ULL, 0x31fe17369b5288c9ULL },
+    { 0x0111010101010101ULL, 0x0000000000000000ULL, 0xdfdd3cc64dae1642ULL },
+    { 0x0109010101010101ULL, 0x0000000000000000ULL, 0x178c83ce2b399d94ULL },
+    { 0x0105010101010101ULL, 0x0000000000000000ULL, 0x50f636324a9b7f80ULL },
+    { 0x0103010101010101ULL, 0x0000000000000000ULL, 0xa8468ee3bc18f06dULL },
+    { 0x0101810101010101ULL, 0x0000000000000000ULL, 0xa2dc9e92fd3cde92ULL },
+    { 0x0101410101010101ULL, 0x0000000000000000ULL, 0xcac09f797d031287ULL },
+    { 0x0101210101010101ULL, 0x0000000000000000ULL, 0x90ba680b22aeb525ULL },
+    { 0x0101110101010101ULL, 0x0000000000000000ULL, 0xce7a24f350e280b6ULL },
+    { 0x0101090101010101ULL, 0x0000000000000000ULL, 0x882bff0aa01a0b87ULL },
+    { 0x0101050101010101ULL, 0x0000000000000000ULL, 0x25610288924511c2ULL },
+    { 0x0101030101010101ULL, 0x0000000000000000ULL, 0xc71516c29c75d170ULL },
+    { 0x0101018101010101ULL, 0x0000000000000000ULL, 0x5199c29a52c9f059ULL },
+    { 0x0101014101010101ULL, 0x0000000000000000ULL, 0xc22f0a294a71f29fULL },
+    { 0x0101012101010101ULL, 0x0000000000000000ULL, 0xee371483714c02eaULL },
+    { 0x0101011101010101ULL, 0x0000000000000000ULL, 0xa81fbd448f9e522fULL },
+    { 0x0101010901010101ULL, 0x0000000000000000ULL, 0x4f644c92e192dfedULL },
+    { 0x0101010501010101ULL, 0x0000000000000000ULL, 0x1afa9a66a6df92aeULL },
+    { 0x0101010301010101ULL, 0x0000000000000000ULL, 0xb3c1cc715cb879d8ULL },
+    { 0x0101010181010101ULL, 0x0000000000000000ULL, 0x19d032e64ab0bd8bULL },
+    { 0x0101010141010101ULL, 0x0000000000000000ULL, 0x3cfaa7a7dc8720dcULL },
+    { 0x0101010121010101ULL, 0x0000000000000000ULL, 0xb7265f7f447ac6f3ULL },
+    { 0x0101010111010101ULL, 0x0000000000000000ULL, 0x9db73b3c0d163f54ULL },
+    { 0x0101010109010101ULL, 0x0000000000000000ULL, 0x8181b65babf4a975ULL },
+    { 0x0101010105010101ULL, 0x0000000000000000ULL, 0x93c9b64042eaa240ULL },
+    { 0x0101010103010101ULL, 0x0000000000000000ULL, 0x5570530829705592ULL },
+    { 0x0101010101810101ULL, 0x0000000000000000ULL, 0x8638809e878787a0ULL },
+    { 0x0101010101410101ULL, 0x0000000000000000ULL, 0x41b9a79af79ac208ULL },
+    { 0x0101010101210101ULL, 0x0000000000000000ULL, 0x7a9be42f2009a892ULL },
+    { 0x0101010101110101ULL, 0x0000000000000000ULL, 0x29038d56ba6d2745ULL },
+    { 0x0101010101090101ULL, 0x0000000000000000ULL, 0x5495c6abf1e5df51ULL },
+    { 0x0101010101050101ULL, 0x0000000000000000ULL, 0xae13dbd561488933ULL },
+    { 0x0101010101030101ULL, 0x0000000000000000ULL, 0x024d1ffa8904e389ULL },
+    { 0x0101010101018101ULL, 0x0000000000000000ULL, 0xd1399712f99bf02eULL },
+    { 0x0101010101014101ULL, 0x0000000000000000ULL, 0x14c1d7c1cffec79eULL },
+    { 0x0101010101012101ULL, 0x0000000000000000ULL, 0x1de5279dae3bed6fULL },
+    { 0x0101010101011101ULL, 0x0000000000000000ULL, 0xe941a33f85501303ULL },
+    { 0x0101010101010901ULL, 0x0000000000000000ULL, 0xda99dbbc9a03f379ULL },
+    { 0x0101010101010501ULL, 0x0000000000000000ULL, 0xb7fc92f91d8e92e9ULL },
+    { 0x0101010101010301ULL, 0x0000000000000000ULL, 0xae8e5caa3ca04e85ULL },
+    { 0x0101010101010181ULL, 0x0000000000000000ULL, 0x9cc62df43b6eed74ULL },
+    { 0x0101010101010141ULL, 0x0000000000000000ULL, 0xd863dbb5c59a91a0ULL },
+    { 0x0101010101010121ULL, 0x0000000000000000ULL, 0xa1ab2190545b91d7ULL },
+    { 0x0101010101010111ULL, 0x0000000000000000ULL, 0x0875041e64c570f7ULL },
+    { 0x0101010101010109ULL, 0x0000000000000000ULL, 0x5a594528bebef1ccULL },
+    { 0x0101010101010105ULL, 0x0000000000000000ULL, 0xfcdb3291de21f0c0ULL },
+    { 0x0101010101010103ULL, 0x0000000000000000ULL, 0x869efd7f9f265a09ULL }
+};
+
+/**
+ * The permutation operation known answer test of SP 800-17 (32). 
+ */
+static const Vector PERM_OP[] = {
+    { 0x1046913489980131ULL, 0x0000000000000000ULL, 0x88d55e54f54c97b4ULL },
+    { 0x1007103489988020ULL, 0x0000000000000000ULL, 0x0c0cc00c83ea48fdULL },
+    { 0x10071034c8980120ULL, 0x0000000000000000ULL, 0x83bc8ef3a6570183ULL },
+    { 0x1046103489988020ULL, 0x0000000000000000ULL, 0xdf725dcad94ea2e9ULL },
+    { 0x1086911519190101ULL, 0x0000000000000000ULL, 0xe652b53b550be8b0ULL },
+    { 0x1086911519580101ULL, 0x0000000000000000ULL, 0xaf527120c485cbb0ULL },
+    { 0x5107b01519580101ULL, 0x0000000000000000ULL, 0x0f04ce393db926d5ULL },
+    { 0x1007b01519190101ULL, 0x0000000000000000ULL, 0xc9f00ffc74079067ULL },
+    { 0x3107915498080101ULL, 0x0000000000000000ULL, 0x7cfd82a593252b4eULL },
+    { 0x3107919498080101ULL, 0x0000000000000000ULL, 0xcb49a2f9e91363e3ULL },
+    { 0x10079115b9080140ULL, 0x0000000000000000ULL, 0x00b588be70d23f56ULL },
+    { 0x3107911598080140ULL, 0x0000000000000000ULL, 0x406a9a6ab43399aeULL },
+    { 0x1007d01589980101ULL, 0x0000000000000000ULL, 0x6cb773611dca9adaULL },
+    { 0x9107911589980101ULL, 0x0000000000000000ULL, 0x67fd21c17dbb5d70ULL },
+    { 0x9107d01589190101ULL, 0x0000000000000000ULL, 0x9592cb4110430787ULL },
+    { 0x1007d01598980120ULL, 0x0000000000000000ULL, 0xa6b7ff68a318ddd3ULL },
+    { 0x1007940498190101ULL, 0x0000000000000000ULL, 0x4d102196c914ca16ULL },
+    { 0x0107910491190401ULL, 0x0000000000000000ULL, 0x2dfa9f4573594965ULL },
+    { 0x0107910491190101ULL, 0x0000000000000000ULL, 0xb46604816c0e0774ULL },
+    { 0x0107940491190401ULL, 0x0000000000000000ULL, 0x6e7e6221a4f34e87ULL },
+    { 0x19079210981a0101ULL, 0x0000000000000000ULL, 0xaa85e74643233199ULL },
+    { 0x1007911998190801ULL, 0x0000000000000000ULL, 0x2e5a19db4d1962d6ULL },
+    { 0x10079119981a0801ULL, 0x0000000000000000ULL, 0x23a866a809d30894ULL },
+    { 0x1007921098190101ULL, 0x0000000000000000ULL, 0xd812d961f017d320ULL },
+    { 0x100791159819010bULL, 0x0000000000000000ULL, 0x055605816e58608fULL },
+    { 0x1004801598190101ULL, 0x0000000000000000ULL, 0xabd88e8b1b7716f1ULL },
+    { 0x1004801598190102ULL, 0x0000000000000000ULL, 0x537ac95be69da1e1ULL },
+    { 0x1004801598190108ULL, 0x0000000000000000ULL, 0xaed0f6ae3c25cdd8ULL },
+    { 0x1002911498100104ULL, 0x0000000000000000ULL, 0xb3e35a5ee53e7b8dULL },
+    { 0x1002911598190104ULL, 0x0000000000000000ULL, 0x61c79c71921a2ef8ULL },
+    { 0x1002911598100201ULL, 0x0000000000000000ULL, 0xe2f5728f0995013cULL },
+    { 0x1002911698100101ULL, 0x0000000000000000ULL, 0x1aeac39a61f0a464ULL }
+};
+
+/**
+ * The substitution table known answer test of SP 800-17 (19). 
+ */
+static const Vector SBOX[] = {
+    { 0x7ca110454a1a6e57ULL, 0x01a1d6d039776742ULL, 0x690f5b0d9a26939bULL },
+    { 0x0131d9619dc1376eULL, 0x5cd54ca83def57daULL, 0x7a389d10354bd271ULL },
+    { 0x07a1133e4a0b2686ULL, 0x0248d43806f67172ULL, 0x868ebb51cab4599aULL },
+    { 0x3849674c2602319eULL, 0x51454b582ddf440aULL, 0x7178876e01f19b2aULL },
+    { 0x04b915ba43feb5b6ULL, 0x42fd443059577fa2ULL, 0xaf37fb421f8c4095ULL },
+    { 0x0113b970fd34f2ceULL, 0x059b5e0851cf143aULL, 0x86a560f10ec6d85bULL },
+    { 0x0170f175468fb5e6ULL, 0x0756d8e0774761d2ULL, 0x0cd3da020021dc09ULL },
+    { 0x43297fad38e373feULL, 0x762514b829bf486aULL, 0xea676b2cb7db2b7aULL },
+    { 0x07a7137045da2a16ULL, 0x3bdd119049372802ULL, 0xdfd64a815caf1a0fULL },
+    { 0x04689104c2fd3b2fULL, 0x26955f6835af609aULL, 0x5c513c9c4886c088ULL },
+    { 0x37d06bb516cb7546ULL, 0x164d5e404f275232ULL, 0x0a2aeeae3ff4ab77ULL },
+    { 0x1f08260d1ac2465eULL, 0x6b056e18759f5ccaULL, 0xef1bf03e5dfa575aULL },
+    { 0x584023641aba6176ULL, 0x004bd6ef09176062ULL, 0x88bf0db6d70dee56ULL },
+    { 0x025816164629b007ULL, 0x480d39006ee762f2ULL, 0xa1f9915541020b56ULL },
+    { 0x49793ebc79b3258fULL, 0x437540c8698f3cfaULL, 0x6fbf1cafcffd0556ULL },
+    { 0x4fb05e1515ab73a7ULL, 0x072d43a077075292ULL, 0x2f22e49bab7ca1acULL },
+    { 0x49e95d6d4ca229bfULL, 0x02fe55778117f12aULL, 0x5a6b612cc26cce4aULL },
+    { 0x018310dc409b26d6ULL, 0x1d9d5c5018f728c2ULL, 0x5f4c038ed12b2e41ULL },
+    { 0x1c587f1c13924fefULL, 0x305532286d6f295aULL, 0x63fac0d034d9f793ULL }
+};
+
+static des_pool *pool = NULL;       //pool of the parallel backend
+static des_jobq *jobq = NULL;       //queue of the job backend
+static size_t remaining = 0;        //differential pairs left to claim
+static unsigned long failures = 0;  //failed checks
+static pthread_mutex_t print_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void run_string_r(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+static void run_block(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+static void run_inline(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+static void run_kcache(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+static void run_tdes_block(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+static void run_batch(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+static void run_tdes_batch(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+static void run_batch_keys(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+static void run_bytes(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+static void run_mode(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+static void run_parallel(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+static void run_job(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec);
+static uint64_t ref_block(uint64_t block, uint64_t key, _Bool dec);
+static size_t test_kat(const char *name, const Vector *v, size_t n);
+static void *test_diff(void *arg);
+static size_t test_modes(uint64_t seed);
+static size_t test_jobs(uint64_t seed);
+static size_t test_search(uint64_t seed);
+static size_t test_stats(void);
+static size_t test_bitvec(uint64_t seed);
+static _Bool check_bvec(const char *func, const bitvec *v, const char *want,
+        size_t arg);
+static void *stats_thread(void *arg);
+static _Bool search_report(const des_search *s, const des_search_stats *st,
+        void *user);
+static _Bool check(const char *test, const char *backend, uint64_t key,
+        uint64_t in, uint64_t got, uint64_t want);
+static uint64_t next_rand(uint64_t *state);
+static int usage(const char *prog);
+
+static const Backend BACKENDS[] = {
+    { "des_enc_r", &run_string_r },
+    { "des_enc_block", &run_block },
+    { "des_enc_block_inline", &run_inline },
+    { "des_kcache_setup", &run_kcache },
+    { "tdes_enc_block", &run_tdes_block },
+    { "des_enc_batch", &run_batch },
+    { "tdes_enc_batch", &run_tdes_batch },
+    { "des_enc_batch_keys", &run_batch_keys },
+    { "des_encrypt_bytes", &run_bytes },
+    { "des_mode_update", &run_mode },
+    { "des_mode_parallel", &run_parallel },
+    { "des_jobq", &run_job }
+};
+
+#define NBACKENDS (sizeof BACKENDS / sizeof *BACKENDS)
+
+/**
+ * Parses the arguments, then runs every test. 
+ *
+ * PARAMETERS: 
+ * argc - the number of arguments
+ * argv - the arguments
+ *
+ * RETURNS: 
+ * 0 if every test passed, 1 otherwise. 
+ */
+int main(int argc, char **argv) {
+    unsigned long long pairs = 1000000, seed = 0x5eed;
+    long threads = 0;
+    des_backend backend = des_backend_get();
+
+    int opt;
+    char *end;
+    while ((opt = getopt(argc, argv, "b:n:t:s:")) != -1) {
+        switch (opt) {
+        case 'b':
+            if (!des_backend_find(optarg, &backend))
+                return usage(argv[0]);
+            if (!des_backend_supported(backend)) {
+                fprintf(stderr, "%s: %s not supported\n", argv[0], optarg);
+                return 1;
+            }
+            break;
+        case 'n':
+            pairs = strtoull(optarg, &end, 10);
+            if (*end != '\0')
+                return usage(argv[0]);
+            break;
+        case 't':
+            threads = strtol(optarg, &end, 10);
+            if (*end != '\0' || threads < 0)
+                return usage(argv[0]);
+            break;
+        case 's':
+            seed = strtoull(optarg, &end, 0);
+            if (*end != '\0')
+                return usage(argv[0]);
+            break;
+        default:
+            return usage(argv[0]);
+        }
+    }
+    if (optind != argc)
+        return usage(argv[0]);
+    if (threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0 ? cpus : 1);
+    }
+
+    pool = des_pool_new(0);
+    jobq = des_jobq_new(0);
+    if (pool == NULL || jobq == NULL) {
+        fprintf(stderr, "%s: cannot start threads\n", argv[0]);
+        return 1;
+    }
+
+    printf("bit vectors: %zu checks\n", test_bitvec(seed));
+    printf("stats [%s]: %zu counters\n",
+            (des_stats_enabled() ? "enabled" : "disabled"), test_stats());
+    printf("jobs: %zu files and pipes\n", test_jobs(seed));
+    for (int b = DES_BACKEND_SCALAR; b < DES_BACKEND_COUNT; b++) {
+        if (!des_backend_set((des_backend)b))
+            continue;           //not supported by the CPU
+        size_t n = 0;
+        n += test_kat("variable plain text", VAR_TEXT,
+                sizeof VAR_TEXT / sizeof *VAR_TEXT);
+        n += test_kat("variable key", VAR_KEY,
+                sizeof VAR_KEY / sizeof *VAR_KEY);
+        n += test_kat("permutation operation", PERM_OP,
+                sizeof PERM_OP / sizeof *PERM_OP);
+        n += test_kat("substitution table", SBOX, sizeof SBOX / sizeof *SBOX);
+        printf("known answer [%s]: %zu vectors, %zu entry points\n",
+                des_backend_name((des_backend)b), n, NBACKENDS + 1);
+        printf("modes [%s]: %zu messages\n", des_backend_name((des_backend)b),
+                test_modes(seed));
+        printf("key search [%s]: %zu searches\n",
+                des_backend_name((des_backend)b), test_search(seed));
+    }
+    des_backend_set(backend);
+
+    Tester *testers = calloc((size_t)threads, sizeof *testers);
+    if (testers == NULL)
+        return 1;
+    remaining = (size_t)pairs;
+    long started = 0;
+    for (; started < threads; started++) {
+        testers[started].seed = seed + 0x9e3779b97f4a7c15ULL *
+                (uint64_t)(started + 1);
+        if (pthread_create(&testers[started].thread, NULL, &test_diff,
+                &testers[started]) != 0)
+            break;
+    }
+    if (started == 0)
+        test_diff(&testers[0]);     //no thread, test on this one
+    for (long i = 0; i < started; i++)
+        pthread_join(testers[i].thread, NULL);
+    printf("differential [%s]: %llu pairs, %ld threads\n",
+            des_backend_name(des_backend_get()), pairs,
+            (started > 0 ? started : 1));
+
+    free(testers);
+    des_jobq_free(jobq);
+    des_pool_free(pool);
+    printf("%s: %lu failures\n", (failures == 0 ? "PASS" : "FAIL"),
+            failures);
+    return failures == 0 ? 0 : 1;
+}
+
+/**
+ * Runs des_enc_r() or des_dec_r() on every block. 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the input blocks
+ * n   - the number of blocks
+ * key - the 64-bit key
+ * dec - whether to decrypt
+ */
+static void run_string_r(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec) {
+    char msg[65], k64[65], res[65];
+    for (int i = 0; i < 64; i++)
+        k64[i] = (char)('0' + ((key >> (63 - i)) & 1));
+    k64[64] = '\0';
+    for (size_t j = 0; j < n; j++) {
+        for (int i = 0; i < 64; i++)
+            msg[i] = (char)('0' + ((in[j] >> (63 - i)) & 1));
+        msg[64] = '\0';
+        uint64_t v = 0;
+        if ((dec ? des_dec_r : des_enc_r)(msg, k64, res, sizeof res) != NULL)
+            for (int i = 0; i < 64; i++)
+                v = (v << 1) | (uint64_t)(res[i] == '1');
+        out[j] = v;
+    }
+}
+
+/**
+ * Runs des_enc_block() or des_dec_block() on every block. 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the input blocks
+ * n   - the number of blocks
+ * key - the 64-bit key
+ * dec - whether to decrypt
+ */
+static void run_block(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec) {
+    des_key_schedule ks;
+    des_key_setup(&ks, key);
+    for (size_t i = 0; i < n; i++)
+        out[i] = (dec ? des_dec_block(in[i], &ks) : des_enc_block(in[i], &ks));
+}
+
+/**
+ * Runs the header-only des_enc_block_inline() or des_dec_block_inline() 
+ * on every block. 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the input blocks
+ * n   - the number of blocks
+ * key - the 64-bit key
+ * dec - whether to decrypt
+ */
+static void run_inline(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec) {
+    des_key_schedule ks;
+    des_key_setup(&ks, key);
+    for (size_t i = 0; i < n; i++)
+        out[i] = (dec ? des_dec_block_inline(in[i], &ks) :
+                des_enc_block_inline(in[i], &ks));
+}
+
+/**
+ * Runs des_enc_block() or des_dec_block() with a cached key schedule. 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the input blocks
+ * n   - the number of blocks
+ * key - the 64-bit key
+ * dec - whether to decrypt
+ */
+static void run_kcache(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec) {
+    des_key_schedule ks;
+    des_kcache_setup(&ks, key);
+    for (size_t i = 0; i < n; i++)
+        out[i] = (dec ? des_dec_block(in[i], &ks) : des_enc_block(in[i], &ks));
+}
+
+/**
+ * Runs triple DES with three equal keys, the same as DES. 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the input blocks
+ * n   - the number of blocks
+ * key - the 64-bit key
+ * dec - whether to decrypt
+ */
+static void run_tdes_block(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec) {
+    tdes_key_schedule ks;
+    tdes_key_setup(&ks, key, key, key);
+    for (size_t i = 0; i < n; i++)
+        out[i] = (dec ? tdes_dec_block(in[i], &ks) :
+                tdes_enc_block(in[i], &ks));
+}
+
+/**
+ * Runs the bitsliced des_enc_batch() or des_dec_batch(). 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the input blocks
+ * n   - the number of blocks
+ * key - the 64-bit key
+ * dec - whether to decrypt
+ */
+static void run_batch(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec) {
+    des_key_schedule ks;
+    des_key_setup(&ks, key);
+    (dec ? des_dec_batch : des_enc_batch)(out, in, n, &ks);
+}
+
+/**
+ * Runs the key-agile des_enc_batch_keys() or des_dec_batch_keys() with the 
+ * same key for every block. 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the input blocks
+ * n   - the number of blocks
+ * key - the 64-bit key
+ * dec - whether to decrypt
+ */
+static void run_batch_keys(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec) {
+    uint64_t keys[BATCH];
+    for (size_t i = 0; i < n; i++)
+        keys[i] = key;
+    (dec ? des_dec_batch_keys : des_enc_batch_keys)(out, in, keys, n);
+}
+
+/**
+ * Runs the bitsliced triple DES with three equal keys. 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the input blocks
+ * n   - the number of blocks
+ * key - the 64-bit key
+ * dec - whether to decrypt
+ */
+static void run_tdes_batch(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec) {
+    tdes_key_schedule ks;
+    tdes_key_setup(&ks, key, key, key);
+    (dec ? tdes_dec_batch : tdes_enc_batch)(out, in, n, &ks);
+}
+
+/**
+ * Runs des_encrypt_bytes() or des_decrypt_bytes() on big endian bytes. 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the input blocks
+ * n   - the number of blocks
+ * key - the 64-bit key
+ * dec - whether to decrypt
+ */
+static void run_bytes(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec) {
+    uint8_t b[8 * BATCH];
+    des_key_schedule ks;
+    des_key_setup(&ks, key);
+    for (size_t i = 0; i < n; i++)
+        des_store64(b + 8 * i, in[i]);
+    (dec ? des_decrypt_bytes : des_encrypt_bytes)(b, b, 8 * n, &ks);
+    for (size_t i = 0; i < n; i++)
+        out[i] = des_load64(b + 8 * i);
+}
+
+/**
+ * Runs des_mode_update() in ECB mode without padding. 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the input blocks
+ * n   - the number of blocks
+ * key - the 64-bit key
+ * dec - whether to decrypt
+ */
+static void run_mode(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec) {
+    uint8_t b[8 * BATCH];
+    des_mode_ctx ctx;
+    size_t len = 0;
+    des_mode_init(&ctx, DES_ECB, dec, key, 0, false);
+    for (size_t i = 0; i < n; i++)
+        des_store64(b + 8 * i, in[i]);
+    des_mode_update(&ctx, b, &len, b, 8 * n);
+    for (size_t i = 0; i < n; i++)
+        out[i] = (8 * i < len ? des_load64(b + 8 * i) : 0);
+}
+
+/**
+ * Runs des_mode_parallel() in ECB mode on the shared pool. 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the input blocks
+ * n   - the number of blocks
+ * key - the 64-bit key
+ * dec - whether to decrypt
+ */
+static void run_parallel(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec) {
+    uint8_t b[8 * BATCH];
+    des_mode_ctx ctx;
+    size_t len = 0;
+    des_mode_init(&ctx, DES_ECB, dec, key, 0, false);
+    for (size_t i = 0; i < n; i++)
+        des_store64(b + 8 * i, in[i]);
+    des_mode_parallel(pool, &ctx, b, &len, b, 8 * n);
+    for (size_t i = 0; i < n; i++)
+        out[i] = (8 * i < len ? des_load64(b + 8 * i) : 0);
+}
+
+/**
+ * Runs an ECB buffer job on the shared queue and waits for it. Jobs of 
+ * other threads may complete first, so the wait is repeated until this 
+ * one is done. 
+ *
+ * PARAMETERS: 
+ * out - the result blocks
+ * in  - the input blocks
+ * n   - the number of blocks
+ * key - the 64-bit key
+ * dec - whether to decrypt
+ */
+static void run_job(uint64_t *out, const uint64_t *in, size_t n,
+        uint64_t key, _Bool dec) {
+    uint8_t b[8 * BATCH], r[8 * BATCH + 16];
+    des_job job;
+    memset(&job, 0, sizeof job);
+    des_mode_init(&job.ctx, DES_ECB, dec, key, 0, false);
+    for (size_t i = 0; i < n; i++)
+        des_store64(b + 8 * i, in[i]);
+    job.in = b;
+    job.inlen = 8 * n;
+    job.out = r;
+    job.infd = job.outfd = -1;
+
+    _Bool done = false;
+    job.user = &done;
+    des_jobq_submit(jobq, &job);
+    while (!__atomic_load_n(&done, __ATOMIC_ACQUIRE)) {
+        des_job *j = des_jobq_wait(jobq);
+        if (j != NULL)
+            __atomic_store_n((_Bool *)j->user, true, __ATOMIC_RELEASE);
+    }
+    for (size_t i = 0; i < n; i++)
+        out[i] = (job.ok && 8 * i < job.outlen ? des_load64(r + 8 * i) : 0);
+}
+
+/**
+ * Encrypts or decrypts the specified block with the reference, des_enc() 
+ * or des_dec() on bit strings. 
+ *
+ * PARAMETERS: 
+ * block - the 64-bit block
+ * key   - the 64-bit key
+ * dec   - whether to decrypt
+ *
+ * RETURNS: 
+ * The result block. 
+ */
+static uint64_t ref_block(uint64_t block, uint64_t key, _Bool dec) {
+    char msg[65], k64[65];
+    for (int i = 0; i < 64; i++) {
+        msg[i] = (char)('0' + ((block >> (63 - i)) & 1));
+        k64[i] = (char)('0' + ((key >> (63 - i)) & 1));
+    }
+    msg[64] = k64[64] = '\0';
+
+    char *res = (dec ? des_dec : des_enc)(msg, k64);
+    uint64_t v = 0;
+    for (int i = 0; res != NULL && i < 64; i++)
+        v = (v << 1) | (uint64_t)(res[i] == '1');
+    bstr_free(res);
+    return v;
+}
+
+/**
+ * Runs the specified known answer vectors through the reference and every 
+ * backend, both ways. Consecutive vectors sharing a key are passed to the 
+ * backends together. 
+ *
+ * PARAMETERS: 
+ * name - the name of the table
+ * v    - the vectors
+ * n    - the number of vectors
+ *
+ * RETURNS: 
+ * The number of vectors. 
+ */
+static size_t test_kat(const char *name, const Vector *v, size_t n) {
+    uint64_t pt[BATCH], ct[BATCH], got[BATCH];
+    for (size_t i = 0; i < n; i++) {
+        check(name, "des_enc", v[i].key, v[i].pt,
+                ref_block(v[i].pt, v[i].key, false), v[i].ct);
+        check(name, "des_dec", v[i].key, v[i].ct,
+                ref_block(v[i].ct, v[i].key, true), v[i].pt);
+    }
+
+    for (size_t i = 0; i < n;) {
+        size_t m = 0;
+        for (; i + m < n && m < BATCH && v[i + m].key == v[i].key; m++) {
+            pt[m] = v[i + m].pt;
+            ct[m] = v[i + m].ct;
+        }
+        for (size_t b = 0; b < NBACKENDS; b++) {
+            BACKENDS[b].func(got, pt, m, v[i].key, false);
+            for (size_t j = 0; j < m; j++)
+                check(name, BACKENDS[b].name, v[i].key, pt[j], got[j], ct[j]);
+            BACKENDS[b].func(got, ct, m, v[i].key, true);
+            for (size_t j = 0; j < m; j++)
+                check(name, BACKENDS[b].name, v[i].key, ct[j], got[j], pt[j]);
+        }
+        i += m;
+    }
+    return n;
+}
+
+/**
+ * The differential test thread function. Claims batches of random pairs 
+ * until none are left, checking every backend against the reference. 
+ * Every batch has its own random key and length, and is also checked with 
+ * a random key for every block. 
+ *
+ * PARAMETERS: 
+ * arg - the tester
+ *
+ * RETURNS: 
+ * NULL. 
+ */
+static void *test_diff(void *arg) {
+    Tester *t = arg;
+    uint64_t state = t->seed;
+    uint64_t pt[BATCH], ct[BATCH], got[BATCH], keys[BATCH];
+    for (;;) {
+        size_t n = (size_t)(next_rand(&state) % BATCH) + 1;
+        size_t left = __atomic_load_n(&remaining, __ATOMIC_RELAXED);
+        do {
+            if (left == 0)
+                return NULL;
+            if (n > left)
+                n = left;
+        } while (!__atomic_compare_exchange_n(&remaining, &left, left - n,
+                true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+        uint64_t key = next_rand(&state);
+        for (size_t i = 0; i < n; i++) {
+            pt[i] = next_rand(&state);
+            ct[i] = ref_block(pt[i], key, false);
+            check("differential", "des_dec", key, ct[i],
+                    ref_block(ct[i], key, true), pt[i]);
+        }
+        for (size_t b = 0; b < NBACKENDS; b++) {
+            BACKENDS[b].func(got, pt, n, key, false);
+            for (size_t i = 0; i < n; i++)
+                check("differential", BACKENDS[b].name, key, pt[i], got[i],
+                        ct[i]);
+            BACKENDS[b].func(got, ct, n, key, true);
+            for (size_t i = 0; i < n; i++)
+                check("differential", BACKENDS[b].name, key, ct[i], got[i],
+                        pt[i]);
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            keys[i] = next_rand(&state);
+            ct[i] = ref_block(pt[i], keys[i], false);
+        }
+        des_enc_batch_keys(got, pt, keys, n);
+        for (size_t i = 0; i < n; i++)
+            check("differential", "des_enc_batch_keys", keys[i], pt[i],
+                    got[i], ct[i]);
+        des_dec_batch_keys(got, ct, keys, n);
+        for (size_t i = 0; i < n; i++)
+            check("differential", "des_dec_batch_keys", keys[i], ct[i],
+                    got[i], pt[i]);
+    }
+}
+
+/**
+ * Checks CBC and CTR, serial and on the pool, against chaining built on 
+ * the reference, for random messages of whole blocks. 
+ *
+ * PARAMETERS: 
+ * seed - the seed of the random numbers
+ *
+ * RETURNS: 
+ * The number of messages. 
+ */
+static size_t test_modes(uint64_t seed) {
+    static const des_mode MODES[] = { DES_CBC, DES_CTR };
+    static const char *NAMES[] = { "cbc", "ctr" };
+    uint64_t state = seed + 0x9e3779b97f4a7c15ULL;     //never 0
+    size_t count = 0;
+    for (int run = 0; run < 16; run++) {
+        size_t n = (size_t)(next_rand(&state) % 2048) + 1;
+        uint64_t key = next_rand(&state), iv = next_rand(&state);
+        uint8_t *pt = malloc(8 * n), *ct = malloc(8 * n);
+        uint8_t *got = malloc(8 * n + 8);
+        if (pt == NULL || ct == NULL || got == NULL)
+            return count;
+        for (size_t i = 0; i < n; i++)
+            des_store64(pt + 8 * i, next_rand(&state));
+
+        for (int m = 0; m < 2; m++) {
+            uint64_t chain = iv;
+            for (size_t i = 0; i < n; i++) {
+                uint64_t p = des_load64(pt + 8 * i), c;
+                if (MODES[m] == DES_CBC)
+                    c = chain = ref_block(p ^ chain, key, false);
+                else
+                    c = p ^ ref_block(chain++, key, false);
+                des_store64(ct + 8 * i, c);
+            }
+
+            for (int par = 0; par < 2; par++) {
+                for (int dec = 0; dec < 2; dec++) {
+                    des_mode_ctx ctx;
+                    size_t len = 0;
+                    des_mode_init(&ctx, MODES[m], dec, key, iv, false);
+                    const uint8_t *in = (dec ? ct : pt);
+                    const uint8_t *want = (dec ? pt : ct);
+                    if (par)
+                        des_mode_parallel(pool, &ctx, got, &len, in, 8 * n);
+                    else
+                        des_mode_update(&ctx, got, &len, in, 8 * n);
+                    const char *backend = (par ? "des_mode_parallel" :
+                            "des_mode_update");
+                    for (size_t i = 0; i < n; i++) {
+                        uint64_t g = (8 * i < len ? des_load64(got + 8 * i) :
+                                0);
+                        if (!check(NAMES[m], backend, key,
+                                des_load64(in + 8 * i), g,
+                                des_load64(want + 8 * i)))
+                            break;  //the rest of the message follows
+                    }
+                }
+            }
+            count++;
+        }
+        free(pt);
+        free(ct);
+        free(got);
+    }
+    return count;
+}
+
+/**
+ * Submits file jobs to the shared queue all at once, reading regular 
+ * files and pipes and writing regular files, in CBC with padding and in 
+ * CTR. The pipes are fed in order of submission once every job is queued. 
+ * The output of every job has to match des_mode_update() and 
+ * des_mode_final() on the whole message. 
+ *
+ * PARAMETERS: 
+ * seed - the seed of the random numbers
+ *
+ * RETURNS: 
+ * The number of jobs. 
+ */
+static size_t test_jobs(uint64_t seed) {
+    enum { NJOBS = 3 * DES_JOB_DEPTH / 2 };
+    uint64_t state = seed + 0xdaa66d2c7ddf743fULL;     //never 0
+    des_job jobs[NJOBS];
+    des_mode_ctx ref[NJOBS];    //the contexts before the jobs ran
+    uint8_t *msg[NJOBS] = {NULL};
+    size_t len[NJOBS];
+    FILE *in[NJOBS] = {NULL}, *out[NJOBS] = {NULL};
+    uint64_t key[NJOBS];
+    int feed[NJOBS][2];         //the input pipe, or -1
+    size_t count = 0;
+
+    for (; count < NJOBS; count++) {
+        size_t i = count;
+        len[i] = (size_t)(next_rand(&state) % (3 * DES_JOB_BUF)) + 1;
+        key[i] = next_rand(&state);
+        feed[i][0] = feed[i][1] = -1;
+        if ((msg[i] = malloc(len[i])) == NULL || (out[i] = tmpfile()) == NULL)
+            break;
+        for (size_t j = 0; j < len[i]; j++)
+            msg[i][j] = (uint8_t)next_rand(&state);
+
+        des_job *job = &jobs[i];
+        memset(job, 0, sizeof *job);
+        des_mode mode = (i & 1 ? DES_CTR : DES_CBC);
+        des_mode_init(&job->ctx, mode, false, key[i], next_rand(&state),
+                mode == DES_CBC);
+        ref[i] = job->ctx;
+        job->outfd = fileno(out[i]);
+        if (i % 3 == 0) {       //a pipe, fed after submitting every job
+            if (pipe(feed[i]) != 0)
+                break;
+            job->infd = feed[i][0];
+        } else {
+            if ((in[i] = tmpfile()) == NULL ||
+                    fwrite(msg[i], 1, len[i], in[i]) != len[i] ||
+                    fflush(in[i]) != 0)
+                break;
+            rewind(in[i]);
+            job->infd = fileno(in[i]);
+        }
+        des_jobq_submit(jobq, job);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (feed[i][1] < 0)
+            continue;
+        for (size_t off = 0; off < len[i];) {
+            ssize_t n = write(feed[i][1], msg[i] + off, len[i] - off);
+            if (n <= 0)
+                break;
+            off += (size_t)n;
+        }
+        close(feed[i][1]);
+    }
+    for (size_t i = 0; i < count; i++)
+        des_jobq_wait(jobq);
+
+    for (size_t i = 0; i < count; i++) {
+        const char *backend = (i % 3 == 0 ? "des_jobq pipe" : "des_jobq file");
+        uint8_t *want = malloc(len[i] + 16), *got = malloc(len[i] + 16);
+        size_t wlen = 0, fin = 0, glen = 0;
+        if (want != NULL && got != NULL) {
+            des_mode_update(&ref[i], want, &wlen, msg[i], len[i]);
+            des_mode_final(&ref[i], want + wlen, &fin);
+            wlen += fin;
+            rewind(out[i]);
+            glen = fread(got, 1, len[i] + 16, out[i]);
+        }
+        size_t diff = 0;        //the first byte that differs
+        while (diff < wlen && diff < glen && got[diff] == want[diff])
+            diff++;
+        check("jobs", backend, key[i], i, jobs[i].ok, 1);
+        check("jobs", backend, key[i], i, glen, wlen);
+        check("jobs", backend, key[i], i, diff, wlen);
+        free(want);
+        free(got);
+    }
+
+    for (size_t i = 0; i < NJOBS && i <= count; i++) {
+        if (feed[i][0] >= 0)
+            close(feed[i][0]);
+        if (in[i] != NULL)
+            fclose(in[i]);
+        if (out[i] != NULL)
+            fclose(out[i]);
+        free(msg[i]);
+    }
+    check("jobs", "des_jobq", 0, 0, count, NJOBS);
+    return count;
+}
+
+/**
+ * Plants keys near random key indexes and checks that des_search_batch() 
+ * finds exactly them, with and without the complementation property, and 
+ * that des_search_run() finds them across partitions and threads, also 
+ * after stopping and resuming. 
+ *
+ * PARAMETERS: 
+ * seed - the seed of the random numbers
+ *
+ * RETURNS: 
+ * The number of searches. 
+ */
+static size_t test_search(uint64_t seed) {
+    uint64_t state = seed + 0x3c6ef372fe94f82bULL;     //never 0
+    size_t count = 0;
+    for (int run = 0; run < 16; run++, count++) {
+        _Bool comp = run & 1;
+        uint64_t index = next_rand(&state) >> 8;
+        if (comp)
+            index >>= 1;        //below 2 ^ 55
+        uint64_t key = des_index_key(index);
+        if (comp && run & 2)
+            key = ~key;         //found through the complement
+        uint64_t pt = next_rand(&state);
+        uint64_t ct[2] = { ref_block(pt, key, false),
+                ~ref_block(~pt, key, false) };
+
+        uint64_t first = index - next_rand(&state) % 3000;
+        uint64_t n = 4096 + next_rand(&state) % 3000;
+        des_key_match m[2] = { { 0, -1 }, { 0, -1 } };
+        size_t found = des_search_batch(m, 2, first, n, pt, ct, comp ? 2 : 1);
+        int target = (key == des_index_key(index) ? 0 : 1);
+        check("key search", "des_search_batch", key, pt, found, 1);
+        check("key search", "des_search_batch", key, pt, m[0].index, index);
+        check("key search", "des_search_batch", key, pt,
+                (uint64_t)m[0].target, (uint64_t)target);
+    }
+
+    uint64_t ct = ref_block(0, des_index_key(0), false);
+    des_key_match m;                //the range wraps back to key index 0
+    check("key search", "des_search_batch", 0, 0,
+            des_search_batch(&m, 1, ((uint64_t)1 << 56) - 64, 128, 0, &ct, 1),
+            0);
+    count++;
+
+    for (int run = 0; run < 4; run++, count++) {
+        uint64_t index = next_rand(&state) >> 44;
+        uint64_t key = des_index_key(index);
+        if (run == 2)
+            key = ~key;         //found through the complement
+        uint64_t pt = next_rand(&state);
+        des_search s;
+        des_search_init(&s, pt, ref_block(pt, key, false));
+        s.ct2 = ref_block(~s.pt, key, false);
+        s.comp = (run == 1 || run == 2);
+        s.chunk = 1 << 12;
+        s.threads = 2;
+        s.interval = 1;
+        s.report = &search_report;
+        des_search_partition(&s, index / s.chunk % 3, 3);
+
+        uint64_t last = 0, got = 0;     //stop at the first report
+        s.user = &last;
+        if (run == 3 && des_search_run(&s, &got, NULL))
+            got = key;          //found before the first report
+        last = index / s.chunk / 3 + 1; //resume, give up past the key
+        if (got == 0 && !des_search_run(&s, &got, NULL))
+            got = 0;
+        check("key search", "des_search_run", key, s.pt, got, key);
+    }
+    return count;
+}
+
+/**
+ * Stops a key search that went past the chunk where the key was planted. 
+ *
+ * PARAMETERS: 
+ * s    - the search
+ * st   - the progress
+ * user - the last chunk to search
+ *
+ * RETURNS: 
+ * 1 (true) to continue, 0 (false) to stop. 
+ */
+static _Bool search_report(const des_search *s, const des_search_stats *st,
+        void *user) {
+    (void)s;
+    return st->next <= *(const uint64_t *)user;
+}
+
+/**
+ * Checks a result, printing the failure if it is wrong. 
+ *
+ * PARAMETERS: 
+ * test    - the name of the test
+ * backend - the name of the backend
+ * key     - the key used
+ * in      - the input block
+ * got     - the result of the backend
+ * want    - the expected result
+ *
+ * RETURNS: 
+ * 1 (true) if the result is right, 0 (false) otherwise. 
+ */
+static _Bool check(const char *test, const char *backend, uint64_t key,
+        uint64_t in, uint64_t got, uint64_t want) {
+    if (got == want)
+        return true;
+
+    unsigned long n = __atomic_add_fetch(&failures, 1, __ATOMIC_RELAXED);
+    if (n <= 20) {              //enough to find the fault
+        pthread_mutex_lock(&print_lock);
+        printf("%s: %s key %016llx in %016llx got %016llx want %016llx\n",
+                test, backend, (unsigned long long)key,
+                (unsigned long long)in, (unsigned long long)got,
+                (unsigned long long)want);
+        pthread_mutex_unlock(&print_lock);
+    }
+    return false;
+}
+
+/**
+ * Checks the counters after known calls on this thread and on a thread 
+ * that exits before the snapshot. Without DES_STATS every counter has to 
+ * stay 0. No other thread may use the library meanwhile. 
+ *
+ * RETURNS: 
+ * The number of counters checked. 
+ */
+static size_t test_stats(void) {
+    des_stats a, b;
+    uint64_t on = des_stats_enabled();
+    size_t n = 0;
+    des_stats_reset();
+    des_stats_snapshot(&a);
+    for (int i = 0; i < DES_STAT_COUNT; i++, n++)
+        check("stats reset", des_stat_name((des_stat_id)i), 0, 0,
+                a.func[i].calls, 0);
+
+    des_key_schedule ks;
+    uint64_t blocks[512] = {0};
+    for (int i = 0; i < 3; i++)
+        des_key_setup(&ks, 0x133457799bbcdff1ULL);
+    for (int i = 0; i < 5; i++)
+        blocks[i] = des_dec_block(des_enc_block(blocks[i], &ks), &ks);
+    des_enc_batch(blocks, blocks, 512, &ks);
+    bstr_free(bstr_new("stats"));       //41 bytes
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, &stats_thread, NULL) == 0)
+        pthread_join(thread, NULL);     //retired once joined
+    else
+        stats_thread(NULL);
+    des_stats_snapshot(&b);
+
+    check("stats", "key_setup", 0, 0, b.func[DES_STAT_KEY_SETUP].calls,
+            10 * on);
+    check("stats", "block", 0, 0, b.func[DES_STAT_BLOCK].calls, 10 * on);
+    check("stats", "f_func", 0, 0, b.func[DES_STAT_F_FUNC].calls, 160 * on);
+    check("stats", "batch", 0, 0, b.func[DES_STAT_BATCH].calls, on);
+    check("stats", des_backend_name(b.backend), 0, 0,
+            b.backend_blocks[b.backend], 512 * on);
+    check("stats", "allocs", 0, 0, b.allocs, on);
+    check("stats", "alloc bytes", 0, 0, b.alloc_bytes, 41 * on);
+    check("stats", "cycles", 0, 0, b.func[DES_STAT_BLOCK].cycles > 0, on);
+    n += 8;
+
+    uint8_t bytes[64] = {0};
+    des_encrypt_bytes(bytes, bytes, sizeof bytes, &ks);
+    des_stats_snapshot(&a);
+    check("stats", "ecb bytes", 0, 0, a.mode_bytes[DES_ECB] -
+            b.mode_bytes[DES_ECB], sizeof bytes * on);
+    des_stats_reset();
+    des_stats_snapshot(&a);
+    check("stats reset", "key_setup", 0, 0,
+            a.func[DES_STAT_KEY_SETUP].calls, 0);
+    return n + 2;
+}
+
+/**
+ * Expands a key 7 times for test_stats(), then exits. 
+ *
+ * PARAMETERS: 
+ * arg - not used
+ *
+ * RETURNS: 
+ * NULL. 
+ */
+static void *stats_thread(void *arg) {
+    (void)arg;
+    des_key_schedule ks;
+    for (int i = 0; i < 7; i++)
+        des_key_setup(&ks, 0x0123456789abcdefULL);
+    return NULL;
+}
+
+/**
+ * Checks every bit vector operation against the same operation on bit 
+ * strings, for random bits of lengths within a word, on word boundaries 
+ * and across several words. The rotations run every amount up to twice 
+ * the length, so the three reversals and the single word rotation both 
+ * meet every offset. 
+ *
+ * PARAMETERS: 
+ * seed - the seed of the random numbers
+ *
+ * RETURNS: 
+ * The number of checks. 
+ */
+static size_t test_bitvec(uint64_t seed) {
+    static const size_t LENS[] = { 28, 56, 64, 65, 127, 128, 200 };
+    uint64_t state = seed + 0x5851f42d4c957f2dULL;     //never 0
+    size_t count = 0;
+    for (size_t t = 0; t < sizeof LENS / sizeof *LENS; t++) {
+        size_t len = LENS[t];
+        char a[201], b[201], want[201];
+        uint64_t wa[BVEC_WORDS(200)], wb[BVEC_WORDS(200)];
+        uint8_t bytes[25];
+        bitvec va, vb;
+        for (size_t i = 0; i < len; i++) {
+            a[i] = (char)('0' + (next_rand(&state) & 1));
+            b[i] = (char)('0' + (next_rand(&state) & 1));
+        }
+        a[len] = b[len] = '\0';
+        bvec_init(&va, wa, len);
+        bvec_init(&vb, wb, len);
+
+        bvec_from_bstr(&va, a);
+        count += check_bvec("bvec_from_bstr", &va, a, 0);
+        for (size_t n = 0; n <= 2 * len; n++) {
+            bvec_from_bstr(&va, a);
+            bvec_lrot(&va, n);
+            bstr_lrot_r(a, (uint32_t)n, want, sizeof want);
+            count += check_bvec("bvec_lrot", &va, want, n);
+            bvec_from_bstr(&va, a);
+            bvec_rrot(&va, n);
+            bstr_rrot_r(a, (uint32_t)n, want, sizeof want);
+            count += check_bvec("bvec_rrot", &va, want, n);
+        }
+
+        bvec_from_bstr(&va, a);
+        bvec_from_bstr(&vb, b);
+        bvec_xor(&va, &vb);
+        bstr_xor_r(a, b, want, sizeof want);
+        count += check_bvec("bvec_xor", &va, want, 0);
+        bvec_flip(&va);
+        bstr_flip(want);
+        count += check_bvec("bvec_flip", &va, want, 0);
+        if (len % 2 == 0) {
+            bvec_swap(&va);
+            bstr_swap(want);
+            count += check_bvec("bvec_swap", &va, want, 0);
+        }
+
+        bvec_from_bstr(&va, a);
+        memset(bytes, 0xff, sizeof bytes);
+        bvec_to_bytes(&va, bytes);
+        for (size_t k = 0; k < (len + 7) / 8; k++) {
+            uint64_t byte = 0;
+            for (size_t i = 8 * k; i < 8 * k + 8; i++)
+                byte = (byte << 1) | (i < len ? (uint64_t)(a[i] - '0') : 0);
+            check("bit vector", "bvec_to_bytes", len, k, bytes[k], byte);
+        }
+        count++;
+        bytes[(len - 1) / 8] |= 0xff >> ((len - 1) % 8 + 1);  //past the end
+        bvec_from_bytes(&vb, bytes);
+        count += check_bvec("bvec_from_bytes", &vb, a, 0);
+    }
+    return count;
+}
+
+/**
+ * Checks that the specified bit vector holds the specified bit string, and 
+ * that the unused bits of its last word are 0. 
+ *
+ * PARAMETERS: 
+ * func - the bit vector function checked
+ * v    - the bit vector
+ * want - the bit string it has to hold
+ * arg  - the argument of the function, the shifts of a rotation
+ *
+ * RETURNS: 
+ * 1 (true) if the bit vector matches, 0 (false) otherwise. 
+ */
+static _Bool check_bvec(const char *func, const bitvec *v, const char *want,
+        size_t arg) {
+    char got[201];
+    _Bool same = bvec_to_bstr(v, got, sizeof got) != NULL &&
+            strcmp(got, want) == 0;
+    if (v->len % 64 != 0)
+        same = same && (v->words[v->len / 64] << v->len % 64) == 0;
+    return check("bit vector", func, v->len, arg, same, true);
+}
+
+/**
+ * Returns the next random number of the specified xorshift64* state. 
+ *
+ * PARAMETERS: 
+ * state - the state, never 0
+ *
+ * RETURNS: 
+ * The random number. 
+ */
+static uint64_t next_rand(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545f4914f6cdd1dULL;
+}
+
+/**
+ * Prints the usage of the program. 
+ *
+ * PARAMETERS: 
+ * prog - the name of the program
+ *
+ * RETURNS: 
+ * 1, the exit status for bad arguments. 
+ */
+static int usage(const char *prog) {
+    fprintf(stderr, "usage: %s [-b backend] [-n pairs] [-t threads] "
+            "[-s seed]\n", prog);
+    return 1;
+}
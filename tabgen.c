@@ -0,0 +1,561 @@
+/**
+ * FILE:   tabgen.c
+ * AUTHOR: PotatoMaster101
+ * DATE:   16/10/2026
+ * 
+ * Generates the lookup tables used by the DES cipher (destab.h), the 
+ * combined s-box tables (dessp.h) and the bitsliced s-box circuits 
+ * (desbsbox.h) from the standard DES tables. The 
+ * standard permutations are compiled with des_perm_compile() here, so the 
+ * cipher needs no setup at run time. The s-box circuits are searched for 
+ * with the multiplexer method of Kwan, which takes a few seconds per 
+ * s-box. Built with desperm.c and descpu.c. 
+ * Run as: tabgen > destab.h, tabgen sp > dessp.h, tabgen bs > desbsbox.h 
+ *
+ * C99
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "desstd.h"
+#include "desperm.h"
+
+#define MAX_GATES 512           //the most gates of a circuit being searched
+#define LOOKAHEAD 4             //levels of the search trying every choice
+
+/**
+ * The operations of the gates of a bitsliced s-box circuit. ANDN is 
+ * a & ~b, a single instruction on x86 vectors and BMI1. 
+ */
+typedef enum GateOp { GATE_IN, GATE_AND, GATE_OR, GATE_XOR, GATE_ANDN,
+        GATE_NOT } GateOp;
+
+/**
+ * A circuit being searched. Every gate keeps its truth table over the 64 
+ * s-box inputs, bit x being the value of the gate for the 6-bit input x. 
+ * The first 6 gates are the inputs. 
+ */
+typedef struct Circuit {
+    uint64_t tt[MAX_GATES];     //truth table of every gate
+    GateOp op[MAX_GATES];       //operation of every gate
+    int a[MAX_GATES];           //first operand, or the input number
+    int b[MAX_GATES];           //second operand, -1 if none
+    int n;                      //number of gates
+} Circuit;
+
+static _Bool check_exp(void);
+static uint32_t sp_value(int sbox, int b);
+static void print_sp(FILE *out);
+static _Bool print_perm(FILE *out, const char *name, const char *desc,
+        const int p[], size_t len, size_t inlen);
+static _Bool print_tab(FILE *out);
+static void print_sp_tab(FILE *out);
+static void print_bs(FILE *out);
+static void print_bs_sbox(FILE *out, int sbox);
+static void circuit_init(Circuit *c);
+static int gate_add(Circuit *c, GateOp op, int a, int b);
+static int gate_find(Circuit *c, uint64_t t, uint64_t mask);
+static int gate_pair(Circuit *c, uint64_t t, uint64_t mask);
+static int circuit_build(Circuit *c, uint64_t t, uint64_t mask, int used,
+        int depth);
+static int circuit_split(Circuit *c, uint64_t t, uint64_t mask, int used,
+        int sel, int form, int depth);
+
+int main(int argc, char *argv[]) {
+    if (!check_exp()) {
+        fprintf(stderr, "tabgen: EXP is not the standard expansion\n");
+        return EXIT_FAILURE;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "bs") == 0)
+        print_bs(stdout);
+    else if (argc > 1 && strcmp(argv[1], "sp") == 0)
+        print_sp_tab(stdout);
+    else if (!print_tab(stdout))
+        return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Checks that the expansion permutation takes 6-bit chunks starting 4 bits 
+ * apart, so that the f-function can read every chunk with a rotation 
+ * instead of a table driven permutation. 
+ *
+ * RETURNS: 
+ * 1 (true) if the expansion has the standard layout, 0 (false) otherwise. 
+ */
+static _Bool check_exp(void) {
+    for (int i = 0; i < 48; i++) {
+        int bit = ((i / 6) * 4 + (i % 6) + 31) % 32 + 1;    //bit 0 wraps to 32
+        if (EXP[i] != bit)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Looks up the specified s-box and shuffles its output with the 
+ * permutation P, placing the 4-bit result at the position of the s-box in 
+ * the 32-bit f-function output. 
+ *
+ * PARAMETERS: 
+ * sbox - the s-box to use, from 0 to 7
+ * b    - the 6-bit s-box input
+ *
+ * RETURNS: 
+ * The s-box value after the permutation P. 
+ */
+static uint32_t sp_value(int sbox, int b) {
+    int row = ((b >> 4) & 2) | (b & 1);
+    int col = (b >> 1) & 0xf;
+    uint32_t val = (uint32_t)SBOX[sbox][16 * row + col] << (28 - 4 * sbox);
+
+    uint32_t result = 0;
+    for (int i = 0; i < 32; i++)
+        result = (result << 1) | ((val >> (32 - P[i])) & 1);
+    return result;
+}
+
+/**
+ * Prints the combined s-box and permutation P tables. 
+ *
+ * PARAMETERS: 
+ * out - the file to print to
+ */
+static void print_sp(FILE *out) {
+    fprintf(out, "/**\n");
+    fprintf(out, " * The 8 s-boxes combined with the permutation P, 64 numbers "
+            "each. \n");
+    fprintf(out, " * Indexed by the 6-bit s-box input, not by s-box row and "
+            "column. \n");
+    fprintf(out, " */\n");
+    fprintf(out, "static const uint32_t SP[8][64] = {\n");
+    for (int i = 0; i < 8; i++) {
+        fprintf(out, "    //sbox %d\n    {\n", i + 1);
+        for (int j = 0; j < 64; j++) {
+            fprintf(out, "%s0x%08lx", (j % 4 == 0 ? "        " : ", "),
+                    (unsigned long)sp_value(i, j));
+            if (j % 4 == 3)
+                fprintf(out, "%s\n", (j == 63 ? "" : ", "));
+        }
+        fprintf(out, "    }%s\n", (i == 7 ? "" : ", "));
+    }
+    fprintf(out, "};\n");
+}
+
+/**
+ * Compiles the specified permutation and prints it as a des_perm constant. 
+ * Only the lookup tables of the input bytes are printed, the others are 
+ * left zero by the initialiser. 
+ *
+ * PARAMETERS: 
+ * out   - the file to print to
+ * name  - the name of the constant
+ * desc  - the description of the constant
+ * p     - the permutation mapping
+ * len   - the length of the permutation mapping
+ * inlen - the number of input bits
+ *
+ * RETURNS: 
+ * 1 (true) if the permutation is printed, 0 (false) if it is invalid. 
+ */
+static _Bool print_perm(FILE *out, const char *name, const char *desc,
+        const int p[], size_t len, size_t inlen) {
+    des_perm pm;
+    if (!des_perm_compile(&pm, p, len, inlen)) {
+        fprintf(stderr, "tabgen: %s is not a valid permutation\n", name);
+        return false;
+    }
+    for (int i = pm.ngroups; i < DES_PERM_GROUPS; i++)
+        pm.inmask[i] = pm.outmask[i] = 0;   //unused masks print as zero
+
+    fprintf(out, "\n/**\n");
+    fprintf(out, " * %s, compiled by des_perm_compile(). \n", desc);
+    fprintf(out, " */\n");
+    fprintf(out, "static const des_perm %s = {\n", name);
+    fprintf(out, "    %zu, %zu, %zu, %d, \n", pm.inlen, pm.outlen, pm.nbytes,
+            pm.ngroups);
+    for (int m = 0; m < 2; m++) {
+        const uint64_t *mask = (m == 0 ? pm.inmask : pm.outmask);
+        fprintf(out, "    //%s bits of every PEXT/PDEP group\n    {\n",
+                (m == 0 ? "input" : "output"));
+        for (int i = 0; i < DES_PERM_GROUPS; i++) {
+            fprintf(out, "%s0x%016llx", (i % 4 == 0 ? "        " : ", "),
+                    (unsigned long long)mask[i]);
+            if (i % 4 == 3)
+                fprintf(out, "%s\n", (i == DES_PERM_GROUPS - 1 ? "" : ", "));
+        }
+        fprintf(out, "    }, \n");
+    }
+    fprintf(out, "    {\n");
+    for (size_t j = 0; j < pm.nbytes; j++) {
+        fprintf(out, "        //byte %zu\n        {\n", j);
+        for (int v = 0; v < 256; v++) {
+            fprintf(out, "%s0x%016llx", (v % 4 == 0 ? "            " : ", "),
+                    (unsigned long long)pm.lut[j][v]);
+            if (v % 4 == 3)
+                fprintf(out, "%s\n", (v == 255 ? "" : ", "));
+        }
+        fprintf(out, "        }%s\n", (j == pm.nbytes - 1 ? "" : ", "));
+    }
+    fprintf(out, "    }\n");
+    fprintf(out, "};\n");
+    return true;
+}
+
+/**
+ * Prints the lookup table header, destab.h. 
+ *
+ * PARAMETERS: 
+ * out - the file to print to
+ *
+ * RETURNS: 
+ * 1 (true) if the header is printed, 0 (false) if a table is invalid. 
+ */
+static _Bool print_tab(FILE *out) {
+    fprintf(out, "/**\n");
+    fprintf(out, " * FILE:   destab.h\n");
+    fprintf(out, " * AUTHOR: PotatoMaster101\n");
+    fprintf(out, " * \n");
+    fprintf(out, " * Lookup tables for the DES cipher. Generated by tabgen.c, "
+            "do not edit. \n");
+    fprintf(out, " *\n");
+    fprintf(out, " * C99\n");
+    fprintf(out, " */\n\n");
+    fprintf(out, "#ifndef __destab_h__\n");
+    fprintf(out, "#define __destab_h__\n");
+    fprintf(out, "#include <stdint.h>\n");
+    fprintf(out, "#include \"desperm.h\"\n\n");
+    if (!print_perm(out, "STD_IP", "The initial permutation IP", IP, 64, 64) ||
+            !print_perm(out, "STD_IP_INV", "The final permutation IP_INV",
+                IP_INV, 64, 64) ||
+            !print_perm(out, "STD_PC1", "The permuted choice PC1", PC1, 56,
+                64) ||
+            !print_perm(out, "STD_PC2", "The permuted choice PC2", PC2, 48,
+                56))
+        return false;
+    fprintf(out, "\n#endif\n");
+    return true;
+}
+
+/**
+ * Prints the combined s-box table header, dessp.h. The SP tables are kept 
+ * apart from the compiled permutations of destab.h, so the header-only 
+ * single block path of desinline.h only pulls in the 2 KB it reads. 
+ *
+ * PARAMETERS: 
+ * out - the file to print to
+ */
+static void print_sp_tab(FILE *out) {
+    fprintf(out, "/**\n");
+    fprintf(out, " * FILE:   dessp.h\n");
+    fprintf(out, " * AUTHOR: PotatoMaster101\n");
+    fprintf(out, " * \n");
+    fprintf(out, " * Combined s-box and permutation P tables for the DES "
+            "cipher. Generated \n");
+    fprintf(out, " * by tabgen.c, do not edit. \n");
+    fprintf(out, " *\n");
+    fprintf(out, " * C99\n");
+    fprintf(out, " */\n\n");
+    fprintf(out, "#ifndef __dessp_h__\n");
+    fprintf(out, "#define __dessp_h__\n");
+    fprintf(out, "#include <stdint.h>\n\n");
+    print_sp(out);
+    fprintf(out, "\n#endif\n");
+}
+
+/**
+ * Prints the bitsliced s-box header, desbsbox.h. The header has no include 
+ * guard, it is included once for every bitslice width with BS_T set to 
+ * the slice type and BS_NAME() set to add the width to the names. 
+ *
+ * PARAMETERS: 
+ * out - the file to print to
+ */
+static void print_bs(FILE *out) {
+    fprintf(out, "/**\n");
+    fprintf(out, " * FILE:   desbsbox.h\n");
+    fprintf(out, " * AUTHOR: PotatoMaster101\n");
+    fprintf(out, " * \n");
+    fprintf(out, " * Bitsliced s-box circuits for the DES cipher. Generated by "
+            "tabgen.c, do \n");
+    fprintf(out, " * not edit. Included by desbsimpl.h with BS_T and BS_NAME() "
+            "defined. \n");
+    fprintf(out, " *\n");
+    fprintf(out, " * C99\n");
+    fprintf(out, " */\n");
+    for (int i = 0; i < 8; i++)
+        print_bs_sbox(out, i);
+}
+
+/**
+ * Prints the bitsliced circuit of the specified s-box. The 4 output bits 
+ * are built one after the other by circuit_build(), sharing the gates of 
+ * the earlier bits, and the order of the outputs giving the fewest gates 
+ * is printed. Every gate is one operation on two slices. 
+ *
+ * PARAMETERS: 
+ * out  - the file to print to
+ * sbox - the s-box to print, from 0 to 7
+ */
+static void print_bs_sbox(FILE *out, int sbox) {
+    uint64_t target[4] = {0};
+    for (int x = 0; x < 64; x++) {
+        int row = ((x >> 4) & 2) | (x & 1), col = (x >> 1) & 0xf;
+        for (int j = 0; j < 4; j++)
+            if ((SBOX[sbox][16 * row + col] >> (3 - j)) & 1)
+                target[j] |= (uint64_t)1 << x;
+    }
+
+    static Circuit c, best;
+    int outs[4], best_outs[4];
+    best.n = MAX_GATES + 1;
+    for (int p = 0; p < 24; p++) {      //every order of the 4 outputs
+        circuit_init(&c);
+        int order[4] = { 0, 1, 2, 3 };
+        for (int j = 0, rest = p; j < 4; j++) {     //the p-th permutation
+            int k = j + rest % (4 - j);
+            rest /= 4 - j;
+            int t = order[j];
+            order[j] = order[k];
+            order[k] = t;
+        }
+        _Bool ok = true;
+        for (int j = 0; ok && j < 4; j++) {
+            int o = order[j];
+            outs[o] = circuit_build(&c, target[o], ~(uint64_t)0, 0, 0);
+            ok = outs[o] >= 0 && c.tt[outs[o]] == target[o];
+        }
+        if (ok && c.n < best.n) {
+            best = c;
+            memcpy(best_outs, outs, sizeof outs);
+        }
+    }
+
+    static const char *OPS[] = { "", "& ", "| ", "^ ", "& ~" };
+    fprintf(out, "\n/**\n");
+    fprintf(out, " * Bitsliced s-box %d, %d gates. Input a[0] is the first bit "
+            "of the \n", sbox + 1, best.n - 6);
+    fprintf(out, " * 6-bit chunk, output o[0] is the first bit of the 4-bit "
+            "result. \n");
+    fprintf(out, " */\n");
+    fprintf(out, "static inline void BS_NAME(sbox%d)(const BS_T a[6], "
+            "BS_T o[4]) {\n", sbox + 1);
+    for (int i = 6; i < best.n; i++) {
+        char x[16], y[16];
+        for (int k = 0; k < 2; k++) {
+            int g = (k == 0 ? best.a[i] : best.b[i]);
+            char *name = (k == 0 ? x : y);
+            if (g < 0)
+                name[0] = '\0';
+            else if (g < 6)
+                sprintf(name, "a[%d]", best.a[g]);
+            else
+                sprintf(name, "t%d", g - 6);
+        }
+        if (best.op[i] == GATE_NOT)
+            fprintf(out, "    BS_T t%d = ~%s;\n", i - 6, x);
+        else
+            fprintf(out, "    BS_T t%d = %s %s%s;\n", i - 6, x,
+                    OPS[best.op[i]], y);
+    }
+    for (int j = 0; j < 4; j++)
+        fprintf(out, "    o[%d] = t%d;\n", j, best_outs[j] - 6);
+    fprintf(out, "}\n");
+}
+
+/**
+ * Starts a circuit with the 6 inputs of an s-box as its first gates. 
+ *
+ * PARAMETERS: 
+ * c - the circuit
+ */
+static void circuit_init(Circuit *c) {
+    c->n = 0;
+    for (int i = 0; i < 6; i++) {
+        uint64_t tt = 0;
+        for (int x = 0; x < 64; x++)
+            if ((x >> (5 - i)) & 1)
+                tt |= (uint64_t)1 << x;
+        c->tt[i] = tt;
+        c->op[i] = GATE_IN;
+        c->a[i] = i;
+        c->b[i] = -1;
+    }
+    c->n = 6;
+}
+
+/**
+ * Adds a gate to the specified circuit. 
+ *
+ * PARAMETERS: 
+ * c  - the circuit
+ * op - the operation
+ * a  - the first operand
+ * b  - the second operand, -1 for GATE_NOT
+ *
+ * RETURNS: 
+ * The new gate. 
+ */
+static int gate_add(Circuit *c, GateOp op, int a, int b) {
+    uint64_t x = c->tt[a], y = (b >= 0 ? c->tt[b] : 0);
+    c->tt[c->n] = (op == GATE_AND ? x & y : op == GATE_OR ? x | y :
+            op == GATE_XOR ? x ^ y : op == GATE_ANDN ? x & ~y : ~x);
+    c->op[c->n] = op;
+    c->a[c->n] = a;
+    c->b[c->n] = b;
+    return c->n++;
+}
+
+/**
+ * Finds a gate computing the specified function, on the inputs where the 
+ * mask is set. The other inputs are don't cares. 
+ *
+ * PARAMETERS: 
+ * c    - the circuit
+ * t    - the truth table of the function
+ * mask - the inputs the gate has to match
+ *
+ * RETURNS: 
+ * The gate, or -1 if there is none. 
+ */
+static int gate_find(Circuit *c, uint64_t t, uint64_t mask) {
+    for (int i = 0; i < c->n; i++)
+        if (((c->tt[i] ^ t) & mask) == 0)
+            return i;
+    return -1;
+}
+
+/**
+ * Adds a single gate computing the specified function from the gates of 
+ * the circuit, on the inputs where the mask is set. 
+ *
+ * PARAMETERS: 
+ * c    - the circuit
+ * t    - the truth table of the function
+ * mask - the inputs the gate has to match
+ *
+ * RETURNS: 
+ * The new gate, or -1 if no single gate computes the function. 
+ */
+static int gate_pair(Circuit *c, uint64_t t, uint64_t mask) {
+    for (int i = 0; i < c->n; i++) {
+        uint64_t x = c->tt[i];
+        if (((~x ^ t) & mask) == 0)
+            return gate_add(c, GATE_NOT, i, -1);
+        for (int j = 0; j < c->n; j++) {
+            uint64_t y = c->tt[j];
+            if (j < i && (((x & y) ^ t) & mask) == 0)
+                return gate_add(c, GATE_AND, i, j);
+            if (j < i && (((x | y) ^ t) & mask) == 0)
+                return gate_add(c, GATE_OR, i, j);
+            if (j < i && (((x ^ y) ^ t) & mask) == 0)
+                return gate_add(c, GATE_XOR, i, j);
+            if (j != i && (((x & ~y) ^ t) & mask) == 0)
+                return gate_add(c, GATE_ANDN, i, j);
+        }
+    }
+    return -1;
+}
+
+/**
+ * Builds the specified function into the circuit, on the inputs where the 
+ * mask is set, reusing gates already in the circuit. If no gate or pair of 
+ * gates computes it, the function is split on an input not used yet, and 
+ * the two halves are built recursively and joined with one or two gates. 
+ * The first LOOKAHEAD levels try every input and every way to join, 
+ * keeping the one adding the fewest gates, deeper levels take the first 
+ * that works. 
+ *
+ * PARAMETERS: 
+ * c     - the circuit
+ * t     - the truth table of the function
+ * mask  - the inputs the function has to match
+ * used  - the inputs already split on, a bit for each
+ * depth - the level of the split
+ *
+ * RETURNS: 
+ * The gate computing the function, or -1 if the circuit is full. 
+ */
+static int circuit_build(Circuit *c, uint64_t t, uint64_t mask, int used,
+        int depth) {
+    int g = gate_find(c, t, mask);
+    if (g >= 0)
+        return g;
+    if (c->n > MAX_GATES - 64)
+        return -1;
+    if ((g = gate_pair(c, t, mask)) >= 0)
+        return g;
+
+    int n = c->n, best = MAX_GATES, sel = -1, form = -1;
+    for (int s = 0; s < 6; s++) {
+        for (int f = 0; f < 6 && !(used & (1 << s)); f++) {
+            if (depth >= LOOKAHEAD && sel >= 0)
+                break;
+            if (circuit_split(c, t, mask, used, s, f, depth) >= 0 &&
+                    c->n - n < best) {
+                best = c->n - n;
+                sel = s;
+                form = f;
+            }
+            c->n = n;           //undo the trial
+        }
+    }
+    return (sel < 0 ? -1 : circuit_split(c, t, mask, used, sel, form, depth));
+}
+
+/**
+ * Builds the specified function by splitting it on an input. Forms 0 to 3 
+ * apply when the function is constant on one half: s & g, g & ~s, s | g 
+ * and ~(s & ~g), g built for the other half. Forms 4 and 5 build g on one 
+ * half with the other half as don't cares, then correct the other half: 
+ * g ^ (s & h) and g ^ (h & ~s). 
+ *
+ * PARAMETERS: 
+ * c     - the circuit
+ * t     - the truth table of the function
+ * mask  - the inputs the function has to match
+ * used  - the inputs already split on, a bit for each
+ * sel   - the input to split on
+ * form  - the way to join the halves, from 0 to 5
+ * depth - the level of the split
+ *
+ * RETURNS: 
+ * The gate computing the function, or -1 if the form does not apply. 
+ */
+static int circuit_split(Circuit *c, uint64_t t, uint64_t mask, int used,
+        int sel, int form, int depth) {
+    uint64_t m0 = mask & ~c->tt[sel], m1 = mask & c->tt[sel];
+    int u = used | (1 << sel), g, h;
+    switch (form) {
+    case 0:
+        if ((t & m0) != 0 || (g = circuit_build(c, t, m1, u, depth + 1)) < 0)
+            return -1;
+        return gate_add(c, GATE_AND, sel, g);
+    case 1:
+        if ((t & m1) != 0 || (g = circuit_build(c, t, m0, u, depth + 1)) < 0)
+            return -1;
+        return gate_add(c, GATE_ANDN, g, sel);
+    case 2:
+        if ((~t & m1) != 0 || (g = circuit_build(c, t, m0, u, depth + 1)) < 0)
+            return -1;
+        return gate_add(c, GATE_OR, sel, g);
+    case 3:
+        if ((~t & m0) != 0 || (g = circuit_build(c, t, m1, u, depth + 1)) < 0)
+            return -1;
+        return gate_add(c, GATE_NOT, gate_add(c, GATE_ANDN, sel, g), -1);
+    case 4:
+        if ((g = circuit_build(c, t, m0, u, depth + 1)) < 0 ||
+                (h = circuit_build(c, t ^ c->tt[g], m1, u, depth + 1)) < 0)
+            return -1;
+        return gate_add(c, GATE_XOR, g, gate_add(c, GATE_AND, sel, h));
+    default:
+        if ((g = circuit_build(c, t, m1, u, depth + 1)) < 0 ||
+                (h = circuit_build(c, t ^ c->tt[g], m0, u, depth + 1)) < 0)
+            return -1;
+        return gate_add(c, GATE_XOR, g, gate_add(c, GATE_ANDN, h, sel));
+    }
+}